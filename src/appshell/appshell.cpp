@@ -234,6 +234,15 @@ int AppShell::run(int argc, char** argv)
 
     PROFILER_PRINT;
 
+    QString traceFilePath = commandLine.traceFilePath();
+    if (!traceFilePath.isEmpty()) {
+        if (haw::profiler::Profiler::instance()->saveTrace(traceFilePath.toStdString())) {
+            LOGI() << "trace saved: " << traceFilePath;
+        } else {
+            LOGE() << "failed to save trace: " << traceFilePath;
+        }
+    }
+
     // Wait Thread Poll
 #ifndef Q_OS_WASM
     QThreadPool* globalThreadPool = QThreadPool::globalInstance();
@@ -273,6 +282,11 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     io::path stylePath = task.params[CommandLineController::ParamKey::StylePath].toString();
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
 
+    io::path layoutStatisticsPath = task.params[CommandLineController::ParamKey::LayoutStatisticsPath].toString();
+    if (!layoutStatisticsPath.empty()) {
+        converter()->setLayoutStatisticsEnabled(true);
+    }
+
     switch (task.type) {
     case CommandLineController::ConvertType::Batch:
         ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
@@ -304,11 +318,21 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
         std::string scoreSource = task.params[CommandLineController::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
     } break;
+    case CommandLineController::ConvertType::AudioBenchmark:
+        ret = converter()->audioBenchmark(task.inputFile, stylePath, forceMode);
+        break;
     }
 
     if (!ret) {
         LOGE() << "failed convert, error: " << ret.toString();
     }
 
+    if (!layoutStatisticsPath.empty()) {
+        Ret statRet = converter()->saveLayoutStatistics(layoutStatisticsPath);
+        if (!statRet) {
+            LOGE() << "failed save layout statistics, error: " << statRet.toString();
+        }
+    }
+
     return ret.code();
 }
@@ -51,6 +51,10 @@ void CommandLineController::parse(const QStringList& args)
 
     m_parser.addOption(QCommandLineOption("session-type", "Startup with given session type", "type")); // see StartupScenario::sessionTypeTromString
 
+    m_parser.addOption(QCommandLineOption("trace",
+                                          "Record a timeline trace of the profiled functions and save it to 'file' on exit, "
+                                          "in the Chrome trace event format", "file"));
+
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
@@ -76,6 +80,17 @@ void CommandLineController::parse(const QStringList& args)
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
+    m_parser.addOption(QCommandLineOption("layout-statistics",
+                                          "Save the work done by the layout, MIDI rendering and painting of each converted score "
+                                          "to a JSON file", "file"));
+
+    m_parser.addOption(QCommandLineOption("audio-benchmark",
+                                          "Play the given score, or the scores of the given directory, with the null audio driver "
+                                          "and print the audio engine timings. Use with '-o <file>.wav' to write the played audio"));
+    m_parser.addOption(QCommandLineOption("audio-benchmark-speed",
+                                          "Use with '--audio-benchmark', sets the speed of the simulated audio device, 1 - real time",
+                                          "factor"));
+
     //! NOTE Currently only implemented `full` mode
     m_parser.addOption(QCommandLineOption("migration", "Whether to do migration with given mode, `full` - full migration", "mode"));
 
@@ -122,6 +137,11 @@ void CommandLineController::apply()
         haw::logger::Logger::instance()->setLevel(haw::logger::Debug);
     }
 
+    if (m_parser.isSet("trace")) {
+        m_traceFilePath = m_parser.value("trace");
+        haw::profiler::Profiler::instance()->setTraceEnabled(true);
+    }
+
     if (m_parser.isSet("D")) {
         std::optional<double> val = doubleValue("D");
         if (val) {
@@ -247,6 +267,34 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("audio-benchmark")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::AudioBenchmark;
+        if (scorefiles.size() < 1) {
+            LOGE() << "Option: --audio-benchmark no input file specified";
+        } else {
+            m_converterTask.inputFile = scorefiles[0];
+        }
+
+        audio::INullAudioDriver::Options options;
+        options.enabled = true;
+
+        if (m_parser.isSet("o")) {
+            options.wavFilePath = m_parser.value("o");
+        }
+
+        if (m_parser.isSet("audio-benchmark-speed")) {
+            std::optional<double> val = doubleValue("audio-benchmark-speed");
+            if (val && val.value() > 0) {
+                options.speed = val.value();
+            } else {
+                LOGE() << "Option: --audio-benchmark-speed not recognized speed value: " << m_parser.value("audio-benchmark-speed");
+            }
+        }
+
+        nullAudioDriver()->setOptions(options);
+    }
+
     if (m_parser.isSet("F") || m_parser.isSet("R")) {
         configuration()->revertToFactorySettings(m_parser.isSet("R"));
     }
@@ -259,6 +307,10 @@ void CommandLineController::apply()
         m_converterTask.params[CommandLineController::ParamKey::StylePath] = m_parser.value("S");
     }
 
+    if (m_parser.isSet("layout-statistics")) {
+        m_converterTask.params[CommandLineController::ParamKey::LayoutStatisticsPath] = m_parser.value("layout-statistics");
+    }
+
     if (application()->runMode() == IApplication::RunMode::Converter) {
         project::MigrationOptions migration;
         migration.appVersion = Ms::MSCVERSION;
@@ -292,6 +344,11 @@ CommandLineController::ConverterTask CommandLineController::converterTask() cons
     return m_converterTask;
 }
 
+QString CommandLineController::traceFilePath() const
+{
+    return m_traceFilePath;
+}
+
 void CommandLineController::printLongVersion() const
 {
     if (Version::unstable()) {
@@ -35,6 +35,7 @@
 #include "internal/istartupscenario.h"
 #include "notation/inotationconfiguration.h"
 #include "project/iprojectconfiguration.h"
+#include "audio/inullaudiodriver.h"
 
 namespace mu::appshell {
 class CommandLineController
@@ -48,6 +49,7 @@ class CommandLineController
     INJECT(appshell, IStartupScenario, startupScenario)
     INJECT(appshell, notation::INotationConfiguration, notationConfiguration)
     INJECT(appshell, project::IProjectConfiguration, projectConfiguration)
+    INJECT(appshell, audio::INullAudioDriver, nullAudioDriver)
 
 public:
     CommandLineController() = default;
@@ -61,7 +63,8 @@ public:
         ExportScoreParts,
         ExportScorePartsPdf,
         ExportScoreTranspose,
-        SourceUpdate
+        SourceUpdate,
+        AudioBenchmark
     };
 
     enum class ParamKey {
@@ -69,7 +72,8 @@ public:
         StylePath,
         ScoreSource,
         ScoreTransposeOptions,
-        ForceMode
+        ForceMode,
+        LayoutStatisticsPath
     };
 
     struct ConverterTask {
@@ -85,12 +89,14 @@ public:
     void apply();
 
     ConverterTask converterTask() const;
+    QString traceFilePath() const;
 
 private:
     void printLongVersion() const;
 
     QCommandLineParser m_parser;
     ConverterTask m_converterTask;
+    QString m_traceFilePath;
 };
 }
 
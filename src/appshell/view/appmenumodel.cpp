@@ -344,6 +344,7 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
 
     MenuItemList engravingItems {
         makeMenuItem("diagnostic-show-engraving-elements"),
+        makeMenuItem("diagnostic-show-layout-statistics"),
     };
 
     MenuItemList autobotItems {
@@ -39,6 +39,8 @@ enum class Err {
 
     OutFileFailedOpen = 1330,
     OutFileFailedWrite = 1331,
+
+    AudioBenchmarkFailed = 1340,
 };
 
 inline Ret make_ret(Err e)
@@ -51,6 +51,12 @@ public:
                                      const io::path& stylePath = io::path(), bool forceMode = false) = 0;
 
     virtual Ret updateSource(const io::path& in, const std::string& newSource, bool forceMode = false) = 0;
+
+    virtual Ret audioBenchmark(const io::path& in, const io::path& stylePath = io::path(), bool forceMode = false) = 0;
+
+    //! NOTE The layout statistics are collected only after they are enabled
+    virtual void setLayoutStatisticsEnabled(bool enabled) = 0;
+    virtual Ret saveLayoutStatistics(const io::path& out) const = 0;
 };
 }
 
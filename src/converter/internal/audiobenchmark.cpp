@@ -0,0 +1,208 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audiobenchmark.h"
+
+#include <thread>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include "log.h"
+#include "convertercodes.h"
+
+#include "notation/imasternotation.h"
+#include "notation/inotationplayback.h"
+#include "notation/imasternotationmididata.h"
+
+using namespace mu::converter;
+using namespace mu::project;
+using namespace mu::notation;
+using namespace mu::audio;
+
+static const std::chrono::milliseconds ASYNC_TIMEOUT(10000);
+
+static qint64 toMicroseconds(std::chrono::nanoseconds ns)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(ns).count();
+}
+
+template<typename Predicate>
+bool AudioBenchmark::processEventsUntil(Predicate done, std::chrono::milliseconds timeout) const
+{
+    //! NOTE The audio engine answers through the main thread event loop
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+
+        QCoreApplication::processEvents();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return true;
+}
+
+mu::Ret AudioBenchmark::run(const io::path& in, const io::path& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(nullAudioDriver() && nullAudioDriver()->options().enabled) {
+        return make_ret(Err::AudioBenchmarkFailed);
+    }
+
+    io::paths scores;
+    QFileInfo inInfo(in.toQString());
+    if (inInfo.isDir()) {
+        QDir dir(in.toQString());
+        for (const QString& name : dir.entryList({ "*.mscx", "*.mscz" }, QDir::Files, QDir::Name)) {
+            scores.push_back(io::path(dir.filePath(name)));
+        }
+    } else {
+        scores.push_back(in);
+    }
+
+    QJsonArray results;
+    for (const io::path& path : scores) {
+        RetVal<QJsonObject> result = playScore(path, stylePath, forceMode);
+        if (!result.ret) {
+            LOGE() << "failed play score, err: " << result.ret.toString() << ", path: " << path;
+            return result.ret;
+        }
+
+        results.append(result.val);
+    }
+
+    QFile out;
+    if (!out.open(stdout, QFile::WriteOnly)) {
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    out.write(QJsonDocument(results).toJson());
+    out.close();
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::RetVal<QJsonObject> AudioBenchmark::playScore(const io::path& path, const io::path& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    RetVal<QJsonObject> result;
+
+    INotationProjectPtr project = notationCreator()->newProject();
+    IF_ASSERT_FAILED(project) {
+        result.ret = make_ret(Err::UnknownError);
+        return result;
+    }
+
+    Ret ret = project->load(path, stylePath, forceMode);
+    if (!ret) {
+        result.ret = make_ret(Err::InFileFailedLoad);
+        return result;
+    }
+
+    IMasterNotationPtr masterNotation = project->masterNotation();
+
+    // Add the sequence and its tracks, as the playback controller does for the opened score
+    TrackSequenceId sequenceId = -1;
+    playback()->addSequence().onResolve(this, [&sequenceId](TrackSequenceId id) {
+        sequenceId = id;
+    });
+
+    if (!processEventsUntil([&sequenceId]() { return sequenceId != -1; }, ASYNC_TIMEOUT)) {
+        result.ret = make_ret(Err::AudioBenchmarkFailed, "failed add sequence");
+        return result;
+    }
+
+    size_t tracksCount = 0;
+    size_t addedTracksCount = 0;
+    for (const Part* part : masterNotation->parts()->partList()) {
+        AudioParams params;
+        params.in = audioConfiguration()->defaultAudioInputParams();
+
+        playback()->tracks()->addTrack(sequenceId, part->partName().toStdString(),
+                                       masterNotation->midiData()->trackMidiData(part->id()), std::move(params))
+        .onResolve(this, [&addedTracksCount](TrackId, AudioParams) {
+            ++addedTracksCount;
+        });
+
+        ++tracksCount;
+    }
+
+    if (!processEventsUntil([&]() { return addedTracksCount == tracksCount; }, ASYNC_TIMEOUT)) {
+        playback()->removeSequence(sequenceId);
+        result.ret = make_ret(Err::AudioBenchmarkFailed, "failed add tracks");
+        return result;
+    }
+
+    // Play it through, the clock of the sequence pauses at the end
+    const msecs_t duration = masterNotation->notation()->playback()->totalPlayTime();
+    bool finished = false;
+
+    playback()->player()->playbackStatusChanged().onReceive(this, [sequenceId, &finished](TrackSequenceId id, PlaybackStatus status) {
+        if (id == sequenceId && status != PlaybackStatus::Running) {
+            finished = true;
+        }
+    });
+
+    playback()->player()->setDuration(sequenceId, duration);
+    nullAudioDriver()->resetStatistics();
+    playback()->player()->play(sequenceId);
+
+    const auto expectedTime = std::chrono::milliseconds(static_cast<int64_t>(duration / nullAudioDriver()->options().speed));
+    bool played = processEventsUntil([&finished]() { return finished; }, expectedTime * 2 + ASYNC_TIMEOUT);
+
+    INullAudioDriver::Statistics statistics = nullAudioDriver()->statistics();
+
+    playback()->player()->playbackStatusChanged().resetOnReceive(this);
+    playback()->player()->stop(sequenceId);
+    playback()->removeSequence(sequenceId);
+
+    if (!played) {
+        result.ret = make_ret(Err::AudioBenchmarkFailed, "playback timeout");
+        return result;
+    }
+
+    QJsonObject obj;
+    obj["score"] = path.toQString();
+    obj["tracks"] = static_cast<int>(tracksCount);
+    obj["durationMs"] = static_cast<qint64>(duration);
+    obj["realtimeMode"] = audioConfiguration()->isRealtimeModeEnabled();
+    obj["blocks"] = static_cast<qint64>(statistics.blocks);
+    obj["underruns"] = static_cast<qint64>(statistics.underruns);
+    obj["missedDeadlines"] = static_cast<qint64>(statistics.missedDeadlines);
+    obj["renderedBlocks"] = static_cast<qint64>(statistics.renderedBlocks);
+    obj["avgRenderTimeUs"] = statistics.renderedBlocks
+                             ? toMicroseconds(statistics.totalRenderTime) / static_cast<qint64>(statistics.renderedBlocks) : 0;
+    obj["maxRenderTimeUs"] = toMicroseconds(statistics.maxRenderTime);
+    obj["minDeadlineSlackUs"] = statistics.blocks ? toMicroseconds(statistics.minDeadlineSlack) : 0;
+
+    result.ret = make_ret(Ret::Code::Ok);
+    result.val = obj;
+    return result;
+}
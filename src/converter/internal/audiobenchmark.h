@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_AUDIOBENCHMARK_H
+#define MU_CONVERTER_AUDIOBENCHMARK_H
+
+#include <chrono>
+
+#include <QJsonObject>
+
+#include "modularity/ioc.h"
+#include "async/asyncable.h"
+#include "retval.h"
+#include "io/path.h"
+
+#include "project/iprojectcreator.h"
+#include "audio/iplayback.h"
+#include "audio/iaudioconfiguration.h"
+#include "audio/inullaudiodriver.h"
+
+namespace mu::converter {
+//! NOTE Plays scores through the full audio engine driven by the null audio driver
+//! and reports how the engine kept up with the simulated device
+class AudioBenchmark : public async::Asyncable
+{
+    INJECT(converter, project::IProjectCreator, notationCreator)
+    INJECT(converter, audio::IPlayback, playback)
+    INJECT(converter, audio::IAudioConfiguration, audioConfiguration)
+    INJECT(converter, audio::INullAudioDriver, nullAudioDriver)
+
+public:
+    //! NOTE The input is a score file or a directory of scores
+    Ret run(const io::path& in, const io::path& stylePath = io::path(), bool forceMode = false);
+
+private:
+    RetVal<QJsonObject> playScore(const io::path& path, const io::path& stylePath, bool forceMode);
+
+    template<typename Predicate>
+    bool processEventsUntil(Predicate done, std::chrono::milliseconds timeout) const;
+};
+}
+
+#endif // MU_CONVERTER_AUDIOBENCHMARK_H
@@ -621,10 +621,10 @@ RetVal<QByteArray> BackendApi::scorePartJson(Ms::Score* score, const std::string
     mscWriter.open();
 
     bool ok = compat::ScoreAccess::exportPart(mscWriter, score);
+    ok = mscWriter.close() && ok;
     if (!ok) {
         LOGW() << "Error save mscz file";
     }
-    mscWriter.close();
 
     RetVal<QByteArray> result;
     result.ret = ok ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
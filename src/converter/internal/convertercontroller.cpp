@@ -31,14 +31,37 @@
 #include "convertercodes.h"
 #include "stringutils.h"
 #include "compat/backendapi.h"
+#include "audiobenchmark.h"
+#include "engraving/layout/layoutstatistics.h"
 
 using namespace mu::converter;
 using namespace mu::project;
 using namespace mu::notation;
+using namespace mu::engraving;
 
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 
+static QJsonObject layoutStatisticsToJson(const LayoutStatistics::Values& values, const LayoutStatistics::Values& base)
+{
+    QJsonObject counters;
+    for (size_t i = 0; i < LayoutStatistics::COUNTERS_COUNT; ++i) {
+        const char* name = LayoutStatistics::counterName(static_cast<LayoutStatistics::Counter>(i));
+        counters[name] = static_cast<qint64>(values.counters[i] - base.counters[i]);
+    }
+
+    QJsonObject times;
+    for (size_t i = 0; i < LayoutStatistics::PHASES_COUNT; ++i) {
+        const char* name = LayoutStatistics::phaseName(static_cast<LayoutStatistics::Phase>(i));
+        times[name] = static_cast<double>(values.phaseTimesNs[i] - base.phaseTimesNs[i]) / 1000000.0;
+    }
+
+    QJsonObject obj;
+    obj["counters"] = counters;
+    obj["timesMs"] = times;
+    return obj;
+}
+
 mu::Ret ConverterController::batchConvert(const io::path& batchJobFile, const io::path& stylePath, bool forceMode)
 {
     TRACEFUNC;
@@ -77,18 +100,31 @@ mu::Ret ConverterController::fileConvert(const io::path& in, const io::path& out
         return make_ret(Err::ConvertTypeUnknown);
     }
 
+    LayoutStatistics::Values beforeLoad = LayoutStatistics::total();
+
     Ret ret = notationProject->load(in, stylePath, forceMode);
     if (!ret) {
         LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
         return make_ret(Err::InFileFailedLoad);
     }
 
+    LayoutStatistics::Values afterLoad = LayoutStatistics::total();
+
     if (isConvertPageByPage(suffix)) {
         ret = convertPageByPage(writer, notationProject->masterNotation()->notation(), out);
     } else {
         ret = convertFullNotation(writer, notationProject->masterNotation()->notation(), out);
     }
 
+    if (LayoutStatistics::isEnabled()) {
+        QJsonObject statistics;
+        statistics["in"] = in.toQString();
+        statistics["out"] = out.toQString();
+        statistics["load"] = layoutStatisticsToJson(afterLoad, beforeLoad);
+        statistics["export"] = layoutStatisticsToJson(LayoutStatistics::total(), afterLoad);
+        m_layoutStatistics.append(statistics);
+    }
+
     return make_ret(Ret::Code::Ok);
 }
 
@@ -125,6 +161,30 @@ mu::Ret ConverterController::convertScoreParts(const mu::io::path& in, const mu:
     return make_ret(Ret::Code::Ok);
 }
 
+void ConverterController::setLayoutStatisticsEnabled(bool enabled)
+{
+    LayoutStatistics::setEnabled(enabled);
+}
+
+mu::Ret ConverterController::saveLayoutStatistics(const io::path& out) const
+{
+    TRACEFUNC;
+
+    QJsonObject root;
+    root["scores"] = m_layoutStatistics;
+    root["total"] = layoutStatisticsToJson(LayoutStatistics::total(), LayoutStatistics::Values());
+
+    QFile file(out.toQString());
+    if (!file.open(QFile::WriteOnly)) {
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    file.write(QJsonDocument(root).toJson());
+    file.close();
+
+    return make_ret(Ret::Code::Ok);
+}
+
 mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(const io::path& batchJobFile) const
 {
     TRACEFUNC;
@@ -322,3 +382,11 @@ mu::Ret ConverterController::updateSource(const io::path& in, const std::string&
 
     return BackendApi::updateSource(in, newSource, forceMode);
 }
+
+mu::Ret ConverterController::audioBenchmark(const io::path& in, const io::path& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    AudioBenchmark benchmark;
+    return benchmark.run(in, stylePath, forceMode);
+}
@@ -24,6 +24,8 @@
 
 #include <list>
 
+#include <QJsonArray>
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -57,6 +59,11 @@ public:
 
     Ret updateSource(const io::path& in, const std::string& newSource, bool forceMode = false) override;
 
+    Ret audioBenchmark(const io::path& in, const io::path& stylePath = io::path(), bool forceMode = false) override;
+
+    void setLayoutStatisticsEnabled(bool enabled) override;
+    Ret saveLayoutStatistics(const io::path& out) const override;
+
 private:
 
     struct Job {
@@ -74,6 +81,8 @@ private:
 
     Ret convertScorePartsToPdf(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation, const io::path& out) const;
     Ret convertScorePartsToPngs(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation, const io::path& out) const;
+
+    QJsonArray m_layoutStatistics;
 };
 }
 
@@ -48,6 +48,7 @@
 #include "view/diagnosticaccessiblemodel.h"
 
 #include "view/engraving/engravingelementsmodel.h"
+#include "view/engraving/layoutstatisticsmodel.h"
 
 #include "devtools/crashhandlerdevtoolsmodel.h"
 
@@ -80,6 +81,7 @@ void DiagnosticsModule::resolveImports()
         ir->registerQmlUri(Uri("musescore://diagnostics/navigation/tree"), "MuseScore/Diagnostics/DiagnosticNavigationDialog.qml");
         ir->registerQmlUri(Uri("musescore://diagnostics/accessible/tree"), "MuseScore/Diagnostics/DiagnosticAccessibleDialog.qml");
         ir->registerQmlUri(Uri("musescore://diagnostics/engraving/elements"), "MuseScore/Diagnostics/EngravingElementsDialog.qml");
+        ir->registerQmlUri(Uri("musescore://diagnostics/engraving/layoutstatistics"), "MuseScore/Diagnostics/LayoutStatisticsDialog.qml");
     }
 
     auto ar = ioc()->resolve<ui::IUiActionsRegister>(moduleName());
@@ -102,6 +104,7 @@ void DiagnosticsModule::registerUiTypes()
     qmlRegisterType<DiagnosticAccessibleModel>("MuseScore.Diagnostics", 1, 0, "DiagnosticAccessibleModel");
 
     qmlRegisterType<EngravingElementsModel>("MuseScore.Diagnostics", 1, 0, "EngravingElementsModel");
+    qmlRegisterType<LayoutStatisticsModel>("MuseScore.Diagnostics", 1, 0, "LayoutStatisticsModel");
 
     qmlRegisterType<CrashHandlerDevToolsModel>("MuseScore.Diagnostics", 1, 0, "CrashHandlerDevToolsModel");
 }
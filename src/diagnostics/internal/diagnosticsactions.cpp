@@ -51,6 +51,10 @@ const UiActionList DiagnosticsActions::m_actions = {
     UiAction("diagnostic-show-engraving-elements",
              mu::context::UiCtxAny,
              QT_TRANSLATE_NOOP("action", "Engraving elements")
+             ),
+    UiAction("diagnostic-show-layout-statistics",
+             mu::context::UiCtxAny,
+             QT_TRANSLATE_NOOP("action", "Layout statistics")
              )
 };
 
@@ -33,6 +33,7 @@ static const mu::UriQuery PROFILER_URI("musescore://diagnostics/system/profiler?
 static const mu::UriQuery NAVIGATION_TREE_URI("musescore://diagnostics/navigation/tree?sync=false&modal=false&floating=true");
 static const mu::UriQuery ACCESSIBLE_TREE_URI("musescore://diagnostics/accessible/tree?sync=false&modal=false&floating=true");
 static const mu::UriQuery ENGRAVING_ELEMENTS_URI("musescore://diagnostics/engraving/elements?sync=false&modal=false&floating=true");
+static const mu::UriQuery LAYOUT_STATISTICS_URI("musescore://diagnostics/engraving/layoutstatistics?sync=false&modal=false&floating=true");
 
 void DiagnosticsActionsController::init()
 {
@@ -42,6 +43,7 @@ void DiagnosticsActionsController::init()
     dispatcher()->reg(this, "diagnostic-show-accessible-tree", [this]() { openUri(ACCESSIBLE_TREE_URI); });
     dispatcher()->reg(this, "diagnostic-accessible-tree-dump", []() { DiagnosticAccessibleModel::dumpTree(); });
     dispatcher()->reg(this, "diagnostic-show-engraving-elements", [this]() { openUri(ENGRAVING_ELEMENTS_URI, false); });
+    dispatcher()->reg(this, "diagnostic-show-layout-statistics", [this]() { openUri(LAYOUT_STATISTICS_URI); });
 }
 
 void DiagnosticsActionsController::openUri(const mu::UriQuery& uri, bool isSingle)
@@ -84,6 +84,18 @@ Rectangle {
                 text: "Print"
                 onClicked: profModel.print()
             }
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: profModel.isTracing ? "Stop trace" : "Start trace"
+                onClicked: profModel.toggleTracing()
+            }
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Save trace"
+                onClicked: profModel.saveTrace()
+            }
         }
     }
 
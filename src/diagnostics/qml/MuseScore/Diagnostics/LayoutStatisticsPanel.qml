@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+import QtQuick 2.15
+
+import MuseScore.Ui 1.0
+import MuseScore.UiComponents 1.0
+import MuseScore.Diagnostics 1.0
+
+Rectangle {
+
+    id: root
+
+    objectName: "DiagnosticLayoutStatisticsPanel"
+    color: ui.theme.backgroundPrimaryColor
+
+    property bool isAutoUpdate: true
+
+    Component.onCompleted: {
+        statModel.reload()
+    }
+
+    LayoutStatisticsModel {
+        id: statModel
+    }
+
+    //! NOTE The current command lasts until the next one begins, so its painting is updated too
+    Timer {
+        interval: 1000
+        repeat: true
+        running: root.isAutoUpdate
+        onTriggered: statModel.reload()
+    }
+
+    Item {
+        id: toolPanel
+        anchors.left: parent.left
+        anchors.right: parent.right
+        height: 48
+
+        CheckBox {
+            anchors.left: parent.left
+            anchors.leftMargin: 16
+            anchors.verticalCenter: parent.verticalCenter
+            text: "Auto update"
+            checked: root.isAutoUpdate
+            onClicked: root.isAutoUpdate = !root.isAutoUpdate
+        }
+
+        Row {
+            anchors.top: parent.top
+            anchors.bottom: parent.bottom
+            anchors.right: parent.right
+            anchors.rightMargin: 16
+            spacing: 8
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Update"
+                onClicked: statModel.reload()
+            }
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Reset"
+                onClicked: statModel.reset()
+            }
+        }
+    }
+
+    Row {
+        id: header
+        anchors.top: toolPanel.bottom
+        anchors.left: parent.left
+        anchors.right: parent.right
+        anchors.leftMargin: 16
+        height: 24
+
+        StyledTextLabel { width: 240; horizontalAlignment: Text.AlignLeft; text: "" }
+        StyledTextLabel { width: 140; horizontalAlignment: Text.AlignLeft; text: "Current command" }
+        StyledTextLabel { width: 140; horizontalAlignment: Text.AlignLeft; text: "Last command" }
+        StyledTextLabel { width: 140; horizontalAlignment: Text.AlignLeft; text: "Total" }
+    }
+
+    ListView {
+        anchors.top: header.bottom
+        anchors.bottom: parent.bottom
+        anchors.left: parent.left
+        anchors.right: parent.right
+        clip: true
+        model: statModel
+        section.property: "groupRole"
+        section.delegate: Rectangle {
+            width: parent.width
+            height: 24
+            color: ui.theme.backgroundSecondaryColor
+            StyledTextLabel {
+                anchors.fill: parent
+                anchors.margins: 2
+                horizontalAlignment: Qt.AlignLeft
+                text: section
+            }
+        }
+
+        delegate: Row {
+            anchors.left: parent ? parent.left : undefined
+            anchors.right: parent ? parent.right : undefined
+            anchors.leftMargin: 16
+            height: 24
+
+            StyledTextLabel { width: 240; height: parent.height; horizontalAlignment: Text.AlignLeft; text: nameRole }
+            StyledTextLabel { width: 140; height: parent.height; horizontalAlignment: Text.AlignLeft; text: currentRole }
+            StyledTextLabel { width: 140; height: parent.height; horizontalAlignment: Text.AlignLeft; text: lastRole }
+            StyledTextLabel { width: 140; height: parent.height; horizontalAlignment: Text.AlignLeft; text: totalRole }
+        }
+    }
+}
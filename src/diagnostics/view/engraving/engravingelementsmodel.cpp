@@ -26,6 +26,7 @@
 #include "engraving/libmscore/engravingobject.h"
 #include "engraving/libmscore/score.h"
 #include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/undo.h"
 #include "dataformatter.h"
 
 #include "log.h"
@@ -354,6 +355,12 @@ void EngravingElementsModel::updateInfo()
         m_summary.clear();
         QTextStream stream(&m_summary);
         stream << "Total: " << elements.size();
+        stream << ", undo: " << (Ms::UndoStack::totalMemoryUsage() / 1024) << " KB";
+        stream << " in " << Ms::UndoStack::totalCommandCount() << " commands";
+
+        const draw::IFontProvider::TextMetricsCacheStats textMetrics = fontProvider()->textMetricsCacheStats();
+        stream << ", text metrics cache: " << textMetrics.size << "/" << textMetrics.capacity;
+        stream << " (hits: " << textMetrics.hits << ", misses: " << textMetrics.misses << ")";
     }
 
     emit infoChanged();
@@ -28,6 +28,7 @@
 #include "modularity/ioc.h"
 #include "iengravingelementsprovider.h"
 #include "actions/iactionsdispatcher.h"
+#include "engraving/infrastructure/draw/ifontprovider.h"
 
 namespace mu::diagnostics {
 class EngravingElementsModel : public QAbstractItemModel
@@ -38,6 +39,7 @@ class EngravingElementsModel : public QAbstractItemModel
 
     INJECT(diagnostics, IEngravingElementsProvider, elementsProvider)
     INJECT(diagnostics, actions::IActionsDispatcher, dispatcher)
+    INJECT(diagnostics, draw::IFontProvider, fontProvider)
 
 public:
     EngravingElementsModel(QObject* parent = 0);
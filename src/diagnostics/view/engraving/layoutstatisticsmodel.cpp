@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutstatisticsmodel.h"
+
+#include "engraving/layout/layoutstatistics.h"
+
+using namespace mu::diagnostics;
+using namespace mu::engraving;
+
+//! NOTE The statistics are collected while the panel is open
+LayoutStatisticsModel::LayoutStatisticsModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+    LayoutStatistics::setEnabled(true);
+}
+
+LayoutStatisticsModel::~LayoutStatisticsModel()
+{
+    LayoutStatistics::setEnabled(false);
+}
+
+QVariant LayoutStatisticsModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid()) {
+        return QVariant();
+    }
+
+    const Item& item = m_items.at(index.row());
+    switch (role) {
+    case rName: return item.name;
+    case rGroup: return item.group;
+    case rCurrent: return item.current;
+    case rLast: return item.last;
+    case rTotal: return item.total;
+    default: break;
+    }
+
+    return QVariant();
+}
+
+int LayoutStatisticsModel::rowCount(const QModelIndex&) const
+{
+    return m_items.count();
+}
+
+QHash<int, QByteArray> LayoutStatisticsModel::roleNames() const
+{
+    static const QHash<int, QByteArray> roles = {
+        { rName, "nameRole" },
+        { rGroup, "groupRole" },
+        { rCurrent, "currentRole" },
+        { rLast, "lastRole" },
+        { rTotal, "totalRole" },
+    };
+    return roles;
+}
+
+void LayoutStatisticsModel::reload()
+{
+    LayoutStatistics::Values current = LayoutStatistics::currentCommand();
+    LayoutStatistics::Values last = LayoutStatistics::lastCommand();
+    LayoutStatistics::Values total = LayoutStatistics::total();
+
+    beginResetModel();
+
+    m_items.clear();
+
+    for (size_t i = 0; i < LayoutStatistics::COUNTERS_COUNT; ++i) {
+        LayoutStatistics::Counter counter = static_cast<LayoutStatistics::Counter>(i);
+
+        Item item;
+        item.group = "Counters";
+        item.name = LayoutStatistics::counterName(counter);
+        item.current = QString::number(current.counter(counter));
+        item.last = QString::number(last.counter(counter));
+        item.total = QString::number(total.counter(counter));
+        m_items << item;
+    }
+
+    for (size_t i = 0; i < LayoutStatistics::PHASES_COUNT; ++i) {
+        LayoutStatistics::Phase phase = static_cast<LayoutStatistics::Phase>(i);
+
+        Item item;
+        item.group = "Time, ms";
+        item.name = LayoutStatistics::phaseName(phase);
+        item.current = QString::number(current.phaseTimeMs(phase), 'f', 3);
+        item.last = QString::number(last.phaseTimeMs(phase), 'f', 3);
+        item.total = QString::number(total.phaseTimeMs(phase), 'f', 3);
+        m_items << item;
+    }
+
+    endResetModel();
+}
+
+void LayoutStatisticsModel::reset()
+{
+    LayoutStatistics::reset();
+    reload();
+}
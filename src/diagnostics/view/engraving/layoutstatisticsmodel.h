@@ -0,0 +1,64 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_LAYOUTSTATISTICSMODEL_H
+#define MU_DIAGNOSTICS_LAYOUTSTATISTICSMODEL_H
+
+#include <QAbstractListModel>
+
+namespace mu::diagnostics {
+class LayoutStatisticsModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit LayoutStatisticsModel(QObject* parent = nullptr);
+    ~LayoutStatisticsModel() override;
+
+    QVariant data(const QModelIndex& index, int role) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    Q_INVOKABLE void reload();
+    Q_INVOKABLE void reset();
+
+private:
+    enum Roles {
+        rName = Qt::UserRole + 1,
+        rGroup,
+        rCurrent,
+        rLast,
+        rTotal
+    };
+
+    struct Item {
+        QString name;
+        QString group;
+        QString current;
+        QString last;
+        QString total;
+    };
+
+    QList<Item> m_items;
+};
+}
+
+#endif // MU_DIAGNOSTICS_LAYOUTSTATISTICSMODEL_H
@@ -121,3 +121,26 @@ void ProfilerViewModel::print()
 {
     PROFILER_PRINT;
 }
+
+bool ProfilerViewModel::isTracing() const
+{
+    return Profiler::isTraceEnabled();
+}
+
+void ProfilerViewModel::toggleTracing()
+{
+    Profiler::instance()->setTraceEnabled(!Profiler::isTraceEnabled());
+    emit isTracingChanged();
+}
+
+void ProfilerViewModel::saveTrace()
+{
+    io::path path = interactive()->selectSavingFile("Save trace", "musescore_trace.json", "Chrome trace (*.json)");
+    if (path.empty()) {
+        return;
+    }
+
+    if (!Profiler::instance()->saveTrace(path.toStdString())) {
+        LOGE() << "failed to save trace: " << path;
+    }
+}
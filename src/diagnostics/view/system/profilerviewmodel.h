@@ -24,10 +24,18 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "iinteractive.h"
+
 namespace mu::diagnostics {
 class ProfilerViewModel : public QAbstractListModel
 {
     Q_OBJECT
+
+    Q_PROPERTY(bool isTracing READ isTracing NOTIFY isTracingChanged)
+
+    INJECT(diagnostics, framework::IInteractive, interactive)
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
 
@@ -40,6 +48,13 @@ public:
     Q_INVOKABLE void clear();
     Q_INVOKABLE void print();
 
+    bool isTracing() const;
+    Q_INVOKABLE void toggleTracing();
+    Q_INVOKABLE void saveTrace();
+
+signals:
+    void isTracingChanged();
+
 private:
 
     enum Roles {
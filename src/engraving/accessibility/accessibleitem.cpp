@@ -21,6 +21,8 @@
  */
 #include "accessibleitem.h"
 
+#include <QAccessible>
+
 #include "accessibleroot.h"
 #include "../libmscore/score.h"
 
@@ -31,6 +33,8 @@ using namespace mu::accessibility;
 using namespace Ms;
 
 bool AccessibleItem::enabled = true;
+bool AccessibleItem::createOnDemand = true;
+std::list<AccessibleItem*> AccessibleItem::s_cache;
 
 AccessibleItem::AccessibleItem(Ms::EngravingItem* e)
     : m_element(e)
@@ -39,6 +43,11 @@ AccessibleItem::AccessibleItem(Ms::EngravingItem* e)
 
 AccessibleItem::~AccessibleItem()
 {
+    if (m_cached) {
+        s_cache.erase(m_cachePos);
+        m_cached = false;
+    }
+
     AccessibleRoot* root = accessibleRoot();
     if (root && root->focusedElement() == this) {
         root->setFocusedElement(nullptr);
@@ -71,6 +80,48 @@ void AccessibleItem::setup()
     m_registred = true;
 }
 
+bool AccessibleItem::accessibilityActive()
+{
+    return AccessibleItem::enabled && QAccessible::isActive();
+}
+
+void AccessibleItem::cache(AccessibleItem* item)
+{
+    if (!item->m_cached) {
+        s_cache.push_front(item);
+        item->m_cachePos = s_cache.begin();
+        item->m_cached = true;
+    } else {
+        item->touch();
+    }
+
+    size_t attempts = s_cache.size();
+    while (s_cache.size() > CACHE_CAPACITY && attempts-- > 0) {
+        AccessibleItem* victim = s_cache.back();
+
+        AccessibleRoot* root = victim->accessibleRoot();
+        if (victim == item || (root && root->focusedElement() == victim)) {
+            victim->touch();
+            continue;
+        }
+
+        // deletes the victim, which removes it from the cache
+        victim->m_element->resetAccessible();
+    }
+}
+
+size_t AccessibleItem::cachedCount()
+{
+    return s_cache.size();
+}
+
+void AccessibleItem::touch() const
+{
+    if (m_cached) {
+        s_cache.splice(s_cache.begin(), s_cache, m_cachePos);
+    }
+}
+
 AccessibleRoot* AccessibleItem::accessibleRoot() const
 {
     if (!m_element) {
@@ -114,13 +165,17 @@ const IAccessible* AccessibleItem::accessibleParent() const
 size_t AccessibleItem::accessibleChildCount() const
 {
     TRACEFUNC;
+    if (!registered()) {
+        return 0;
+    }
+
+    touch();
+
+    //! NOTE The children's accessible objects are not created here, only when asked for
     size_t count = 0;
     for (const EngravingObject* obj : m_element->children()) {
-        if (obj->isEngravingItem()) {
-            AccessibleItem* access = Ms::toEngravingItem(obj)->accessible();
-            if (access && access->registered()) {
-                ++count;
-            }
+        if (obj->isEngravingItem() && Ms::toEngravingItem(obj)->accessibleEnabled()) {
+            ++count;
         }
     }
     return count;
@@ -129,16 +184,20 @@ size_t AccessibleItem::accessibleChildCount() const
 const IAccessible* AccessibleItem::accessibleChild(size_t i) const
 {
     TRACEFUNC;
+    if (!registered()) {
+        return nullptr;
+    }
+
+    touch();
+
     size_t count = 0;
     for (const EngravingObject* obj : m_element->children()) {
-        if (obj->isEngravingItem()) {
-            AccessibleItem* access = Ms::toEngravingItem(obj)->accessible();
-            if (access && access->registered()) {
-                if (count == i) {
-                    return access;
-                }
-                ++count;
+        if (obj->isEngravingItem() && Ms::toEngravingItem(obj)->accessibleEnabled()) {
+            if (count == i) {
+                AccessibleItem* access = Ms::toEngravingItem(obj)->accessible();
+                return access && access->registered() ? access : nullptr;
             }
+            ++count;
         }
     }
     return nullptr;
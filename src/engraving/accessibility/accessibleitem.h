@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_ACCESSIBLEITEM_H
 #define MU_ENGRAVING_ACCESSIBLEITEM_H
 
+#include <list>
+
 #include "accessibility/iaccessible.h"
 #include "modularity/ioc.h"
 #include "accessibility/iaccessibilitycontroller.h"
@@ -72,12 +74,37 @@ public:
 
     static bool enabled;
 
+    //! NOTE Whether an assistive technology may be listening
+    static bool accessibilityActive();
+
+    //! NOTE The accessible objects of score elements are created on demand and kept
+    //! in a bounded cache, the least recently used ones are released.
+    //! A screen reader only visits the elements around the cursor, the capacity
+    //! bounds the memory taken by an assistive technology walking the whole score
+    static constexpr size_t CACHE_CAPACITY = 1000;
+
+    //! NOTE When off, every element gets its accessible object when it is set up,
+    //! and none is released until the element is deleted. Only meant for comparing
+    //! both ways in the load benchmark
+    static bool createOnDemand;
+
+    static void cache(AccessibleItem* item);
+    static size_t cachedCount();
+
 protected:
 
     Ms::EngravingItem* m_element = nullptr;
     bool m_registred = false;
 
     mu::async::Channel<IAccessible::State, bool> m_accessibleStateChanged;
+
+private:
+    static std::list<AccessibleItem*> s_cache;
+
+    void touch() const;
+
+    bool m_cached = false;
+    std::list<AccessibleItem*>::iterator m_cachePos;
 };
 }
 
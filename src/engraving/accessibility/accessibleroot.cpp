@@ -30,6 +30,12 @@ using namespace mu::accessibility;
 AccessibleRoot::AccessibleRoot(RootItem* e)
     : AccessibleItem(e)
 {
+    QAccessible::installActivationObserver(this);
+}
+
+AccessibleRoot::~AccessibleRoot()
+{
+    QAccessible::removeActivationObserver(this);
 }
 
 void AccessibleRoot::setFocusedElement(AccessibleItem* e)
@@ -81,6 +87,26 @@ QString AccessibleRoot::accessibleName() const
     return element()->score()->title();
 }
 
+void AccessibleRoot::accessibilityActiveChanged(bool active)
+{
+    //! NOTE An element selected while no assistive technology was active
+    //! got no accessible object, so it has to be focused now
+    if (!active || m_focusedElement || !AccessibleItem::enabled) {
+        return;
+    }
+
+    Ms::Score* score = element()->score();
+    Ms::EngravingItem* selected = score ? score->selection().element() : nullptr;
+    if (!selected || !selected->accessibleEnabled()) {
+        return;
+    }
+
+    AccessibleItem* access = selected->accessible();
+    if (access && access->accessibleRoot() == this) {
+        setFocusedElement(access);
+    }
+}
+
 void AccessibleRoot::setMapToScreenFunc(const AccessibleMapToScreenFunc& func)
 {
     m_accessibleMapToScreenFunc = func;
@@ -22,16 +22,19 @@
 #ifndef MU_ENGRAVING_ACCESSIBLEROOT_H
 #define MU_ENGRAVING_ACCESSIBLEROOT_H
 
+#include <QAccessible>
+
 #include "accessibleitem.h"
 #include "../libmscore/rootitem.h"
 
 namespace mu::engraving {
 using AccessibleMapToScreenFunc = std::function<RectF(const RectF&)>;
 
-class AccessibleRoot : public AccessibleItem
+class AccessibleRoot : public AccessibleItem, public QAccessible::ActivationObserver
 {
 public:
     AccessibleRoot(RootItem* e);
+    ~AccessibleRoot() override;
 
     void setFocusedElement(AccessibleItem* e);
     AccessibleItem* focusedElement() const;
@@ -43,6 +46,8 @@ public:
     accessibility::IAccessible::Role accessibleRole() const override;
     QString accessibleName() const override;
 
+    void accessibilityActiveChanged(bool active) override;
+
 private:
     AccessibleItem* m_focusedElement = nullptr;
 
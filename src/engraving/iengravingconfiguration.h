@@ -69,6 +69,11 @@ public:
     virtual async::Notification scoreInversionChanged() const = 0;
 
     virtual draw::Color highlightSelectionColor(int voiceIndex = 0) const = 0;
+
+    //! NOTE 0 means no limit
+    virtual size_t undoStackMemoryLimit() const = 0;
+    virtual size_t undoStackCommandLimit() const = 0;
+    virtual int undoStackDepthLimit() const = 0;
 };
 }
 
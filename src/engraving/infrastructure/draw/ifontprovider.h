@@ -60,6 +60,16 @@ public:
     // Score symbols
     virtual RectF symBBox(const Font& f, uint ucs4, qreal DPI_F) const = 0;
     virtual qreal symAdvance(const Font& f, uint ucs4, qreal DPI_F) const = 0;
+
+    // Diagnostics
+    struct TextMetricsCacheStats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+    virtual TextMetricsCacheStats textMetricsCacheStats() const = 0;
 };
 }
 
@@ -65,6 +65,8 @@ else()
         ${CMAKE_CURRENT_LIST_DIR}/internal/qimageprovider.cpp
         ${CMAKE_CURRENT_LIST_DIR}/internal/qfontprovider.cpp
         ${CMAKE_CURRENT_LIST_DIR}/internal/qfontprovider.h
+        ${CMAKE_CURRENT_LIST_DIR}/internal/textmetricscache.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/internal/textmetricscache.h
         ${CMAKE_CURRENT_LIST_DIR}/internal/fontengineft.cpp
         ${CMAKE_CURRENT_LIST_DIR}/internal/fontengineft.h
         ${CMAKE_CURRENT_LIST_DIR}/internal/qimagepainterprovider.cpp
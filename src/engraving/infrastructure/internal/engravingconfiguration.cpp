@@ -37,6 +37,10 @@ static const Settings::Key PART_STYLE_FILE_PATH("engraving", "engraving/style/pa
 
 static const Settings::Key INVERT_SCORE_COLOR("engraving", "engraving/scoreColorInversion");
 
+static const Settings::Key UNDO_MEMORY_LIMIT_MB("engraving", "engraving/undo/memoryLimitMB");
+static const Settings::Key UNDO_COMMAND_LIMIT("engraving", "engraving/undo/commandLimit");
+static const Settings::Key UNDO_DEPTH_LIMIT("engraving", "engraving/undo/depthLimit");
+
 struct VoiceColorKey {
     Settings::Key key;
     Color color;
@@ -54,6 +58,9 @@ void EngravingConfiguration::init()
     };
 
     settings()->setDefaultValue(INVERT_SCORE_COLOR, Val(false));
+    settings()->setDefaultValue(UNDO_MEMORY_LIMIT_MB, Val(512));
+    settings()->setDefaultValue(UNDO_COMMAND_LIMIT, Val(1000000));
+    settings()->setDefaultValue(UNDO_DEPTH_LIMIT, Val(0));
     settings()->valueChanged(INVERT_SCORE_COLOR).onReceive(nullptr, [this](const Val&) {
         m_scoreInversionChanged.notify();
     });
@@ -178,3 +185,19 @@ async::Notification EngravingConfiguration::scoreInversionChanged() const
 {
     return m_scoreInversionChanged;
 }
+
+size_t EngravingConfiguration::undoStackMemoryLimit() const
+{
+    int megabytes = settings()->value(UNDO_MEMORY_LIMIT_MB).toInt();
+    return megabytes > 0 ? size_t(megabytes) * 1024 * 1024 : 0;
+}
+
+size_t EngravingConfiguration::undoStackCommandLimit() const
+{
+    return size_t(qMax(settings()->value(UNDO_COMMAND_LIMIT).toInt(), 0));
+}
+
+int EngravingConfiguration::undoStackDepthLimit() const
+{
+    return qMax(settings()->value(UNDO_DEPTH_LIMIT).toInt(), 0);
+}
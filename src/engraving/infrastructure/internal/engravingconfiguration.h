@@ -67,6 +67,10 @@ public:
 
     async::Notification scoreInversionChanged() const override;
 
+    size_t undoStackMemoryLimit() const override;
+    size_t undoStackCommandLimit() const override;
+    int undoStackDepthLimit() const override;
+
 private:
     async::Channel<int, draw::Color> m_voiceColorChanged;
     async::Notification m_scoreInversionChanged;
@@ -55,12 +55,14 @@ static FontPaintDevice device;
 int QFontProvider::addApplicationFont(const QString& family, const QString& path)
 {
     m_paths[family] = path;
+    m_textMetricsCache.clear();
     return QFontDatabase::addApplicationFont(path);
 }
 
 void QFontProvider::insertSubstitution(const QString& familyName, const QString& substituteName)
 {
     QFont::insertSubstitution(familyName, substituteName);
+    m_textMetricsCache.clear();
 }
 
 qreal QFontProvider::lineSpacing(const Font& f) const
@@ -100,7 +102,9 @@ bool QFontProvider::inFontUcs4(const Font& f, uint ucs4) const
 
 qreal QFontProvider::horizontalAdvance(const Font& f, const QString& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    return m_textMetricsCache.horizontalAdvance(f, string, [&f, &string]() {
+        return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    });
 }
 
 qreal QFontProvider::horizontalAdvance(const Font& f, const QChar& ch) const
@@ -110,7 +114,9 @@ qreal QFontProvider::horizontalAdvance(const Font& f, const QChar& ch) const
 
 RectF QFontProvider::boundingRect(const Font& f, const QString& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    return m_textMetricsCache.boundingRect(f, string, [&f, &string]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    });
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const QChar& ch) const
@@ -125,7 +131,9 @@ RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, cons
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const QString& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    return m_textMetricsCache.tightBoundingRect(f, string, [&f, &string]() {
+        return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    });
 }
 
 // Score symbols
@@ -147,6 +155,19 @@ qreal QFontProvider::symAdvance(const Font& f, uint ucs4, qreal dpi_f) const
     return engine->advance(ucs4, dpi_f);
 }
 
+IFontProvider::TextMetricsCacheStats QFontProvider::textMetricsCacheStats() const
+{
+    const TextMetricsCache::Stats cacheStats = m_textMetricsCache.stats();
+
+    TextMetricsCacheStats stats;
+    stats.hits = cacheStats.hits;
+    stats.misses = cacheStats.misses;
+    stats.size = cacheStats.size;
+    stats.capacity = cacheStats.capacity;
+
+    return stats;
+}
+
 FontEngineFT* QFontProvider::symEngine(const Font& f) const
 {
     QString path = m_paths.value(f.family());
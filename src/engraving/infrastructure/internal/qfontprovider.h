@@ -24,6 +24,7 @@
 
 #include <QHash>
 #include "infrastructure/draw/ifontprovider.h"
+#include "textmetricscache.h"
 
 namespace mu::draw {
 class FontEngineFT;
@@ -57,12 +58,16 @@ public:
     RectF symBBox(const Font& f, uint ucs4, qreal DPI_F) const override;
     qreal symAdvance(const Font& f, uint ucs4, qreal DPI_F) const override;
 
+    // Diagnostics
+    TextMetricsCacheStats textMetricsCacheStats() const override;
+
 private:
 
     FontEngineFT* symEngine(const Font& f) const;
 
     QHash<QString /*family*/, QString /*path*/> m_paths;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+    mutable TextMetricsCache m_textMetricsCache;
 };
 }
 
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "textmetricscache.h"
+
+#include <QHash>
+
+using namespace mu;
+using namespace mu::draw;
+
+size_t TextMetricsCache::KeyHash::operator()(const Key& key) const
+{
+    const Font& f = key.font;
+
+    uint seed = qHash(key.text);
+    seed = qHash(f.family(), seed);
+    //! NOTE The point size is not hashed, Font compares it with a tolerance
+    //! and equal keys must have equal hashes
+    seed = qHash(static_cast<int>(f.weight()), seed);
+    seed = qHash((f.italic() << 0) | (f.underline() << 1) | (f.strike() << 2) | (f.noFontMerging() << 3), seed);
+    seed = qHash(static_cast<int>(f.hinting()), seed);
+
+    return seed;
+}
+
+TextMetricsCache::TextMetricsCache(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+TextMetricsCache::Entry& TextMetricsCache::entry(const Font& f, const QString& text)
+{
+    Key key { f, text };
+
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return m_entries.front();
+    }
+
+    m_entries.push_front(Entry { key });
+    m_index.emplace(std::move(key), m_entries.begin());
+
+    if (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+
+    return m_entries.front();
+}
+
+template<typename T>
+T TextMetricsCache::value(const Font& f, const QString& text, Field field, T Entry::* member,
+                          const std::function<T()>& compute)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Entry& e = entry(f, text);
+    if (e.fields & field) {
+        ++m_hits;
+        return e.*member;
+    }
+
+    ++m_misses;
+    e.*member = compute();
+    e.fields |= field;
+
+    return e.*member;
+}
+
+qreal TextMetricsCache::horizontalAdvance(const Font& f, const QString& text, const std::function<qreal()>& compute)
+{
+    return value<qreal>(f, text, Advance, &Entry::advance, compute);
+}
+
+RectF TextMetricsCache::boundingRect(const Font& f, const QString& text, const std::function<RectF()>& compute)
+{
+    return value<RectF>(f, text, BoundingRect, &Entry::boundingRect, compute);
+}
+
+RectF TextMetricsCache::tightBoundingRect(const Font& f, const QString& text, const std::function<RectF()>& compute)
+{
+    return value<RectF>(f, text, TightBoundingRect, &Entry::tightBoundingRect, compute);
+}
+
+void TextMetricsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_index.clear();
+    m_entries.clear();
+}
+
+size_t TextMetricsCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+TextMetricsCache::Stats TextMetricsCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Stats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.size = m_entries.size();
+    stats.capacity = m_capacity;
+
+    return stats;
+}
+
+void TextMetricsCache::resetStats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_hits = 0;
+    m_misses = 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_TEXTMETRICSCACHE_H
+#define MU_DRAW_TEXTMETRICSCACHE_H
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include <QString>
+
+#include "infrastructure/draw/font.h"
+#include "infrastructure/draw/geometry.h"
+
+namespace mu::draw {
+//! NOTE Bounded LRU cache of the metrics of text runs, keyed by font and string.
+//! Text layout measures the same (font, string) pairs over and over again on
+//! every relayout, so the font provider keeps the results here.
+class TextMetricsCache
+{
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 8192;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+    explicit TextMetricsCache(size_t capacity = DEFAULT_CAPACITY);
+
+    qreal horizontalAdvance(const Font& f, const QString& text, const std::function<qreal()>& compute);
+    RectF boundingRect(const Font& f, const QString& text, const std::function<RectF()>& compute);
+    RectF tightBoundingRect(const Font& f, const QString& text, const std::function<RectF()>& compute);
+
+    void clear();
+    size_t size() const;
+
+    Stats stats() const;
+    void resetStats();
+
+private:
+    enum Field : uint8_t {
+        Advance = 1 << 0,
+        BoundingRect = 1 << 1,
+        TightBoundingRect = 1 << 2
+    };
+
+    struct Key {
+        Font font;
+        QString text;
+
+        bool operator==(const Key& other) const { return text == other.text && font == other.font; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        uint8_t fields = 0;
+        qreal advance = 0.0;
+        RectF boundingRect;
+        RectF tightBoundingRect;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    Entry& entry(const Font& f, const QString& text);
+
+    template<typename T>
+    T value(const Font& f, const QString& text, Field field, T Entry::* member, const std::function<T()>& compute);
+
+    mutable std::mutex m_mutex;
+    size_t m_capacity = 0;
+    EntryList m_entries;
+    std::unordered_map<Key, EntryList::iterator, KeyHash> m_index;
+    size_t m_hits = 0;
+    size_t m_misses = 0;
+};
+}
+
+#endif // MU_DRAW_TEXTMETRICSCACHE_H
@@ -22,6 +22,7 @@
 #include "mscreader.h"
 
 #include <QXmlStreamReader>
+#include <QBuffer>
 #include <QFile>
 #include <QFileInfo>
 #include <QDir>
@@ -112,27 +113,54 @@ QByteArray MscReader::fileData(const QString& fileName) const
     return reader()->fileData(fileName);
 }
 
+QIODevice* MscReader::IReader::openFile(const QString& fileName) const
+{
+    QByteArray data = fileData(fileName);
+    if (data.isEmpty()) {
+        return nullptr;
+    }
+
+    QBuffer* buffer = new QBuffer();
+    buffer->setData(data);
+    buffer->open(QIODevice::ReadOnly);
+    return buffer;
+}
+
 QByteArray MscReader::readStyleFile() const
 {
     return fileData("score_style.mss");
 }
 
-QByteArray MscReader::readScoreFile() const
+QString MscReader::scoreFileName() const
 {
     QString mscxFileName = QFileInfo(m_params.filePath).completeBaseName() + ".mscx";
-    QByteArray data = fileData(mscxFileName);
-    if (data.isEmpty() && reader()->isContainer()) {
-        QStringList files = reader()->fileList();
-        for (const QString& name : files) {
-            // mscx file in the root dir
-            if (!name.contains("/") && name.endsWith(".mscx", Qt::CaseInsensitive)) {
-                mscxFileName = name;
-                break;
-            }
+    if (!reader()->isContainer()) {
+        return mscxFileName;
+    }
+
+    QStringList files = reader()->fileList();
+    if (files.contains(mscxFileName)) {
+        return mscxFileName;
+    }
+
+    for (const QString& name : files) {
+        // mscx file in the root dir
+        if (!name.contains("/") && name.endsWith(".mscx", Qt::CaseInsensitive)) {
+            return name;
         }
     }
 
-    return fileData(mscxFileName);
+    return mscxFileName;
+}
+
+QByteArray MscReader::readScoreFile() const
+{
+    return fileData(scoreFileName());
+}
+
+QIODevice* MscReader::openScoreFile() const
+{
+    return reader()->openFile(scoreFileName());
 }
 
 std::vector<QString> MscReader::excerptNames() const
@@ -299,6 +327,15 @@ QByteArray MscReader::ZipReader::fileData(const QString& fileName) const
     return data;
 }
 
+QIODevice* MscReader::ZipReader::openFile(const QString& fileName) const
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return nullptr;
+    }
+
+    return m_zip->openFile(fileName);
+}
+
 bool MscReader::DirReader::open(QIODevice* device, const QString& filePath)
 {
     if (device) {
@@ -360,6 +397,19 @@ QByteArray MscReader::DirReader::fileData(const QString& fileName) const
     return data;
 }
 
+QIODevice* MscReader::DirReader::openFile(const QString& fileName) const
+{
+    QString filePath = m_rootPath + "/" + fileName;
+    QFile* file = new QFile(filePath);
+    if (!file->open(QIODevice::ReadOnly)) {
+        LOGD() << "failed open file: " << filePath;
+        delete file;
+        return nullptr;
+    }
+
+    return file;
+}
+
 bool MscReader::XmlFileReader::open(QIODevice* device, const QString& filePath)
 {
     m_device = device;
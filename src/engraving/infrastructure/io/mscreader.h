@@ -56,6 +56,9 @@ public:
 
     QByteArray readStyleFile() const;
     QByteArray readScoreFile() const;
+    //! NOTE Reads the score file on demand, for readers that only need its start.
+    //! The caller takes ownership of the returned device.
+    QIODevice* openScoreFile() const;
 
     std::vector<QString> excerptNames() const;
     QByteArray readExcerptStyleFile(const QString& name) const;
@@ -85,6 +88,7 @@ private:
         virtual bool isContainer() const = 0;
         virtual QStringList fileList() const = 0;
         virtual QByteArray fileData(const QString& fileName) const = 0;
+        virtual QIODevice* openFile(const QString& fileName) const;
     };
 
     struct ZipReader : public IReader
@@ -96,6 +100,7 @@ private:
         bool isContainer() const override;
         QStringList fileList() const override;
         QByteArray fileData(const QString& fileName) const override;
+        QIODevice* openFile(const QString& fileName) const override;
     private:
         QIODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
@@ -110,6 +115,7 @@ private:
         bool isContainer() const override;
         QStringList fileList() const override;
         QByteArray fileData(const QString& fileName) const override;
+        QIODevice* openFile(const QString& fileName) const override;
     private:
         QString m_rootPath;
     };
@@ -128,6 +134,7 @@ private:
     };
 
     IReader* reader() const;
+    QString scoreFileName() const;
     QByteArray fileData(const QString& fileName) const;
 
     Params m_params;
@@ -27,7 +27,12 @@
 #include <QDir>
 #include <QBuffer>
 #include <QTextStream>
+#include <QThread>
+#include <QtConcurrent>
 
+#include <algorithm>
+
+#include "thirdparty/qzip/qzipreader_p.h"
 #include "thirdparty/qzip/qzipwriter_p.h"
 
 #include "log.h"
@@ -68,16 +73,24 @@ bool MscWriter::open()
     return writer()->open(m_params.device, m_params.filePath);
 }
 
-void MscWriter::close()
+bool MscWriter::close()
 {
+    bool ok = true;
     if (m_writer) {
         writeMeta();
 
-        m_writer->close();
+        // entries are compressed and written in the background until the writer is closed,
+        // so write errors may only show up here
+        ok = m_writer->close();
+        if (!ok) {
+            LOGE() << "failed write: " << m_params.filePath;
+        }
 
         delete m_writer;
         m_writer = nullptr;
     }
+
+    return ok;
 }
 
 bool MscWriter::isOpened() const
@@ -90,7 +103,7 @@ MscWriter::IWriter* MscWriter::writer() const
     if (!m_writer) {
         switch (m_params.mode) {
         case MscIoMode::Zip:
-            m_writer = new ZipWriter();
+            m_writer = new ZipWriter(m_params.compression, m_params.previousFilePath);
             break;
         case MscIoMode::Dir:
             m_writer = new DirWriter();
@@ -229,8 +242,18 @@ void MscWriter::Meta::addFile(const QString& file)
 // Writers
 // =======================================================================
 
+MscWriter::ZipWriter::ZipWriter(Compression compression, const QString& previousFilePath)
+    : m_compression(compression), m_previousFilePath(previousFilePath)
+{
+}
+
 MscWriter::ZipWriter::~ZipWriter()
 {
+    for (PendingEntry& entry : m_pending) {
+        entry.future.waitForFinished();
+    }
+
+    delete m_previous;
     delete m_zip;
     if (m_selfDeviceOwner) {
         delete m_device;
@@ -254,18 +277,41 @@ bool MscWriter::ZipWriter::open(QIODevice* device, const QString& filePath)
 
     m_zip = new MQZipWriter(m_device);
 
+    if (m_compression != Compression::Store && !m_previousFilePath.isEmpty() && QFileInfo::exists(m_previousFilePath)) {
+        m_previous = new MQZipReader(m_previousFilePath);
+        if (m_previous->isReadable()) {
+            for (const MQZipReader::FileInfo& fi : m_previous->fileInfoList()) {
+                if (fi.isFile) {
+                    m_previousEntries.insert(fi.filePath, { fi.crc, fi.size });
+                }
+            }
+        }
+    }
+
     return true;
 }
 
-void MscWriter::ZipWriter::close()
+bool MscWriter::ZipWriter::close()
 {
+    writePendingEntries(true);
+
+    delete m_previous;
+    m_previous = nullptr;
+    m_previousEntries.clear();
+
     if (m_zip) {
         m_zip->close();
+        if (m_zip->status() != MQZipWriter::NoError) {
+            LOGE() << "failed close zip, status: " << m_zip->status();
+            m_hasError = true;
+        }
     }
 
     if (m_device) {
         m_device->close();
     }
+
+    return !m_hasError;
 }
 
 bool MscWriter::ZipWriter::isOpened() const
@@ -279,11 +325,107 @@ bool MscWriter::ZipWriter::addFileData(const QString& fileName, const QByteArray
         return false;
     }
 
-    m_zip->addFile(fileName, data);
-    if (m_zip->status() != MQZipWriter::NoError) {
-        LOGE() << "failed write files to zip, status: " << m_zip->status();
+    // Entries are deflated concurrently on the thread pool,
+    // and written to the archive in the order they were added
+    PendingEntry entry;
+    entry.fileName = fileName;
+
+    if (copyPreviousEntry(fileName, data, entry.entry)) {
+        // copied as is
+    } else if (m_compression == Compression::Store || data.size() < MIN_COMPRESS_SIZE) {
+        entry.entry = { data, false, MQZipWriter::crc32(data), data.size() };
+    } else {
+        entry.future = QtConcurrent::run(&ZipWriter::compressEntry, data, m_compression);
+        entry.async = true;
+    }
+
+    m_pending.push_back(entry);
+
+    return writePendingEntries(false);
+}
+
+MscWriter::ZipWriter::RawEntry MscWriter::ZipWriter::compressEntry(const QByteArray& data, Compression compression)
+{
+    // zlib levels
+    int level = -1;
+    MQZipWriter::DeflateStrategy strategy = MQZipWriter::DefaultStrategy;
+    switch (compression) {
+    case Compression::Fast:
+        level = 1;
+        break;
+    case Compression::Small:
+        //! NOTE The entries are mostly XML text, the default strategy suits it best:
+        //! the filtered and RLE ones make it bigger
+        level = 9;
+        strategy = MQZipWriter::DefaultStrategy;
+        break;
+    case Compression::Store:
+        level = 0;
+        break;
+    case Compression::Default:
+        break;
+    }
+
+    RawEntry entry;
+    entry.crc = MQZipWriter::crc32(data);
+    entry.size = data.size();
+    entry.data = MQZipWriter::deflateData(data, level, strategy);
+    entry.deflated = true;
+
+    // already compressed data (images, audio) doesn't get smaller
+    if (entry.data.isEmpty() || entry.data.size() >= data.size()) {
+        entry.data = data;
+        entry.deflated = false;
+    }
+
+    return entry;
+}
+
+bool MscWriter::ZipWriter::writePendingEntries(bool wait)
+{
+    static const size_t maxPending = std::max(2, QThread::idealThreadCount() * 2);
+
+    while (!m_pending.empty()) {
+        PendingEntry& entry = m_pending.front();
+        if (entry.async && !wait && !entry.future.isFinished() && m_pending.size() < maxPending) {
+            break;
+        }
+
+        const RawEntry& raw = entry.async ? entry.future.result() : entry.entry;
+        m_zip->addRawFile(entry.fileName, raw.data, raw.deflated, raw.crc, raw.size);
+        m_pending.pop_front();
+
+        if (m_zip->status() != MQZipWriter::NoError) {
+            LOGE() << "failed write files to zip, status: " << m_zip->status();
+            m_hasError = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool MscWriter::ZipWriter::copyPreviousEntry(const QString& fileName, const QByteArray& data, RawEntry& entry)
+{
+    // Copying the compressed bytes of an entry that has not changed since the previous file
+    // is much cheaper than deflating it again
+    auto it = m_previousEntries.constFind(fileName);
+    if (it == m_previousEntries.constEnd() || it->size != data.size()) {
+        return false;
+    }
+
+    uint crc = MQZipWriter::crc32(data);
+    if (crc != it->crc) {
         return false;
     }
+
+    bool deflated = false;
+    QByteArray raw = m_previous->rawFileData(fileName, &deflated);
+    if (raw.isNull()) {
+        return false;
+    }
+
+    entry = { raw, deflated, crc, data.size() };
     return true;
 }
 
@@ -317,9 +459,10 @@ bool MscWriter::DirWriter::open(QIODevice* device, const QString& filePath)
     return true;
 }
 
-void MscWriter::DirWriter::close()
+bool MscWriter::DirWriter::close()
 {
     // noop
+    return true;
 }
 
 bool MscWriter::DirWriter::isOpened() const
@@ -385,16 +528,20 @@ bool MscWriter::XmlFileWriter::open(QIODevice* device, const QString& filePath)
     return true;
 }
 
-void MscWriter::XmlFileWriter::close()
+bool MscWriter::XmlFileWriter::close()
 {
+    bool ok = true;
     if (m_stream) {
         *m_stream << "</files>" << Qt::endl;
         m_stream->flush();
+        ok = m_stream->status() == QTextStream::Ok;
     }
 
     if (m_device) {
         m_device->close();
     }
+
+    return ok;
 }
 
 bool MscWriter::XmlFileWriter::isOpened() const
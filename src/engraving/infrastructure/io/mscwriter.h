@@ -25,10 +25,15 @@
 #include <QString>
 #include <QByteArray>
 #include <QIODevice>
+#include <QHash>
+#include <QFuture>
+
+#include <deque>
 
 #include "mscio.h"
 
 class MQZipWriter;
+class MQZipReader;
 class QTextStream;
 
 namespace mu::engraving {
@@ -36,11 +41,20 @@ class MscWriter
 {
 public:
 
+    enum class Compression {
+        Default,
+        Fast,   // quick saves like autosave
+        Small,  // archival, best compression at the cost of a slower save
+        Store   // no compression, entries are stored as is
+    };
+
     struct Params
     {
         QIODevice* device = nullptr;
         QString filePath;
         MscIoMode mode = MscIoMode::Zip;
+        Compression compression = Compression::Default; // Zip mode only
+        QString previousFilePath; // Zip mode only; entries unchanged since this file are copied from it
     };
 
     MscWriter() = default;
@@ -51,7 +65,7 @@ public:
     const Params& params() const;
 
     bool open();
-    void close();
+    bool close();
     bool isOpened() const;
 
     void writeStyleFile(const QByteArray& data);
@@ -71,29 +85,62 @@ private:
         virtual ~IWriter() = default;
 
         virtual bool open(QIODevice* device, const QString& filePath) = 0;
-        virtual void close() = 0;
+        virtual bool close() = 0;
         virtual bool isOpened() const = 0;
         virtual bool addFileData(const QString& fileName, const QByteArray& data) = 0;
     };
 
     struct ZipWriter : public IWriter
     {
+        ZipWriter(Compression compression, const QString& previousFilePath);
         ~ZipWriter() override;
         bool open(QIODevice* device, const QString& filePath) override;
-        void close() override;
+        bool close() override;
         bool isOpened() const override;
         bool addFileData(const QString& fileName, const QByteArray& data) override;
 
     private:
+        struct PreviousEntry {
+            uint crc = 0;
+            qint64 size = 0;
+        };
+
+        struct RawEntry {
+            QByteArray data;
+            bool deflated = false;
+            uint crc = 0;
+            qint64 size = 0;
+        };
+
+        struct PendingEntry {
+            QString fileName;
+            RawEntry entry;
+            QFuture<RawEntry> future;
+            bool async = false;
+        };
+
+        static constexpr int MIN_COMPRESS_SIZE = 64;
+
+        static RawEntry compressEntry(const QByteArray& data, Compression compression);
+        bool writePendingEntries(bool wait);
+        bool copyPreviousEntry(const QString& fileName, const QByteArray& data, RawEntry& entry);
+
         QIODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
+        Compression m_compression = Compression::Default;
         MQZipWriter* m_zip = nullptr;
+        std::deque<PendingEntry> m_pending;
+        bool m_hasError = false;
+
+        QString m_previousFilePath;
+        MQZipReader* m_previous = nullptr;
+        QHash<QString, PreviousEntry> m_previousEntries;
     };
 
     struct DirWriter : public IWriter
     {
         bool open(QIODevice* device, const QString& filePath) override;
-        void close() override;
+        bool close() override;
         bool isOpened() const override;
         bool addFileData(const QString& fileName, const QByteArray& data) override;
     private:
@@ -104,7 +151,7 @@ private:
     {
         ~XmlFileWriter() override;
         bool open(QIODevice* device, const QString& filePath) override;
-        void close() override;
+        bool close() override;
         bool isOpened() const override;
         bool addFileData(const QString& fileName, const QByteArray& data) override;
     private:
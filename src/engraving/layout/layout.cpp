@@ -52,6 +52,7 @@
 #include "layoutsystem.h"
 #include "layoutbeams.h"
 #include "layouttuplets.h"
+#include "layoutstatistics.h"
 
 using namespace mu::engraving;
 using namespace Ms;
@@ -75,6 +76,9 @@ Layout::Layout(Ms::Score* score)
 
 void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, const Fraction& et)
 {
+    LayoutStatistics::PhaseTimer phaseTimer(LayoutStatistics::Phase::Layout);
+    LayoutStatistics::add(LayoutStatistics::Counter::LayoutRanges);
+
     CmdStateLocker cmdStateLocker(m_score);
     LayoutContext ctx(m_score);
 
@@ -39,6 +39,7 @@
 #include "layoutbeams.h"
 #include "layoutchords.h"
 #include "layouttremolo.h"
+#include "layoutstatistics.h"
 
 using namespace mu::engraving;
 using namespace Ms;
@@ -577,6 +578,8 @@ static void layoutDrumsetChord(Chord* c, const Drumset* drumset, const StaffType
 
 void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext& ctx)
 {
+    LayoutStatistics::add(LayoutStatistics::Counter::MeasuresLaidOut);
+
     Ms::Score* score = ctx.score();
     ctx.prevMeasure = ctx.curMeasure;
     ctx.curMeasure  = ctx.nextMeasure;
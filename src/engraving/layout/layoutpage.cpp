@@ -47,6 +47,7 @@
 #include "layoutbeams.h"
 #include "layouttuplets.h"
 #include "verticalgapdata.h"
+#include "layoutstatistics.h"
 
 using namespace mu::engraving;
 using namespace Ms;
@@ -100,6 +101,9 @@ void LayoutPage::getNextPage(const LayoutOptions& options, LayoutContext& lc)
 
 void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
 {
+    LayoutStatistics::PhaseTimer phaseTimer(LayoutStatistics::Phase::CollectPage);
+    LayoutStatistics::add(LayoutStatistics::Counter::PagesCollected);
+
     const qreal slb = ctx.score()->styleMM(Sid::staffLowerBorder);
     bool breakPages = ctx.score()->layoutMode() != LayoutMode::SYSTEM;
     qreal footerExtension = ctx.page->footerExtension();
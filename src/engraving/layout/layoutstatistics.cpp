@@ -0,0 +1,147 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutstatistics.h"
+
+#include <mutex>
+
+using namespace mu::engraving;
+
+std::atomic<bool> LayoutStatistics::s_enabled { false };
+std::atomic<uint64_t> LayoutStatistics::s_counters[COUNTERS_COUNT] = {};
+std::atomic<uint64_t> LayoutStatistics::s_phaseTimesNs[PHASES_COUNT] = {};
+
+static std::mutex s_mutex;
+static LayoutStatistics::Values s_lastCommand;
+static LayoutStatistics::Values s_previousCommands;
+
+LayoutStatistics::Values& LayoutStatistics::Values::operator+=(const Values& v)
+{
+    for (size_t i = 0; i < COUNTERS_COUNT; ++i) {
+        counters[i] += v.counters[i];
+    }
+
+    for (size_t i = 0; i < PHASES_COUNT; ++i) {
+        phaseTimesNs[i] += v.phaseTimesNs[i];
+    }
+
+    return *this;
+}
+
+static LayoutStatistics::Values takeCurrent(std::atomic<uint64_t>* counters, std::atomic<uint64_t>* phaseTimes)
+{
+    LayoutStatistics::Values values;
+    for (size_t i = 0; i < LayoutStatistics::COUNTERS_COUNT; ++i) {
+        values.counters[i] = counters[i].exchange(0, std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < LayoutStatistics::PHASES_COUNT; ++i) {
+        values.phaseTimesNs[i] = phaseTimes[i].exchange(0, std::memory_order_relaxed);
+    }
+
+    return values;
+}
+
+void LayoutStatistics::setEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void LayoutStatistics::beginCommand()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    s_lastCommand = takeCurrent(s_counters, s_phaseTimesNs);
+    s_previousCommands += s_lastCommand;
+}
+
+void LayoutStatistics::reset()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    takeCurrent(s_counters, s_phaseTimesNs);
+    s_lastCommand = Values();
+    s_previousCommands = Values();
+}
+
+LayoutStatistics::Values LayoutStatistics::currentCommand()
+{
+    Values values;
+    for (size_t i = 0; i < COUNTERS_COUNT; ++i) {
+        values.counters[i] = s_counters[i].load(std::memory_order_relaxed);
+    }
+
+    for (size_t i = 0; i < PHASES_COUNT; ++i) {
+        values.phaseTimesNs[i] = s_phaseTimesNs[i].load(std::memory_order_relaxed);
+    }
+
+    return values;
+}
+
+LayoutStatistics::Values LayoutStatistics::lastCommand()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_lastCommand;
+}
+
+LayoutStatistics::Values LayoutStatistics::total()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    Values values = s_previousCommands;
+    values += currentCommand();
+    return values;
+}
+
+const char* LayoutStatistics::counterName(Counter counter)
+{
+    switch (counter) {
+    case Counter::LayoutRanges: return "layoutRanges";
+    case Counter::MeasuresLaidOut: return "measuresLaidOut";
+    case Counter::SystemsCollected: return "systemsCollected";
+    case Counter::MeasuresCollected: return "measuresCollected";
+    case Counter::PagesCollected: return "pagesCollected";
+    case Counter::MeasureWidthComputations: return "measureWidthComputations";
+    case Counter::ShapeDistances: return "shapeDistances";
+    case Counter::SkylineRects: return "skylineRects";
+    case Counter::SkylineDistances: return "skylineDistances";
+    case Counter::MidiChunksRendered: return "midiChunksRendered";
+    case Counter::PaintPasses: return "paintPasses";
+    case Counter::ElementsPainted: return "elementsPainted";
+    case Counter::Count: break;
+    }
+
+    return "";
+}
+
+const char* LayoutStatistics::phaseName(Phase phase)
+{
+    switch (phase) {
+    case Phase::Layout: return "layout";
+    case Phase::CollectSystem: return "collectSystem";
+    case Phase::CollectPage: return "collectPage";
+    case Phase::MidiRender: return "midiRender";
+    case Phase::Paint: return "paint";
+    case Phase::Count: break;
+    }
+
+    return "";
+}
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_LAYOUTSTATISTICS_H
+#define MU_ENGRAVING_LAYOUTSTATISTICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace mu::engraving {
+//! NOTE Counts the work done by the layout, the MIDI rendering and the painting,
+//! so that a slow edit can be explained by what was redone, not only by how long it took.
+//! The counts are collected per command: a command starts with Score::startCmd or an undo/redo
+//! and lasts until the next one, so it includes the painting that follows it.
+//! The counts are process-wide and only collected while enabled, by the diagnostics panel or the converter
+class LayoutStatistics
+{
+public:
+
+    enum class Counter {
+        LayoutRanges = 0,
+        MeasuresLaidOut,
+        SystemsCollected,
+        MeasuresCollected,
+        PagesCollected,
+        MeasureWidthComputations,
+        ShapeDistances,
+        SkylineRects,
+        SkylineDistances,
+        MidiChunksRendered,
+        PaintPasses,
+        ElementsPainted,
+
+        Count
+    };
+
+    //! NOTE The phases are nested, the time of a phase includes the time of the phases called from it
+    enum class Phase {
+        Layout = 0,
+        CollectSystem,
+        CollectPage,
+        MidiRender,
+        Paint,
+
+        Count
+    };
+
+    static constexpr size_t COUNTERS_COUNT = static_cast<size_t>(Counter::Count);
+    static constexpr size_t PHASES_COUNT = static_cast<size_t>(Phase::Count);
+
+    struct Values {
+        uint64_t counters[COUNTERS_COUNT] = {};
+        uint64_t phaseTimesNs[PHASES_COUNT] = {};
+
+        uint64_t counter(Counter c) const { return counters[static_cast<size_t>(c)]; }
+        double phaseTimeMs(Phase p) const { return static_cast<double>(phaseTimesNs[static_cast<size_t>(p)]) / 1000000.0; }
+
+        Values& operator+=(const Values& v);
+    };
+
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+
+    static void add(Counter counter, uint64_t count = 1)
+    {
+        if (!isEnabled()) {
+            return;
+        }
+
+        s_counters[static_cast<size_t>(counter)].fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void addTime(Phase phase, uint64_t ns)
+    {
+        if (!isEnabled()) {
+            return;
+        }
+
+        s_phaseTimesNs[static_cast<size_t>(phase)].fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    static void beginCommand();
+    static void reset();
+
+    static Values currentCommand();
+    static Values lastCommand();
+    static Values total();
+
+    static const char* counterName(Counter counter);
+    static const char* phaseName(Phase phase);
+
+    class PhaseTimer
+    {
+    public:
+        explicit PhaseTimer(Phase phase)
+            : m_phase(phase), m_enabled(isEnabled())
+        {
+            if (m_enabled) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~PhaseTimer()
+        {
+            if (!m_enabled) {
+                return;
+            }
+
+            auto elapsed = std::chrono::steady_clock::now() - m_start;
+            addTime(m_phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+    private:
+        Phase m_phase;
+        bool m_enabled = false;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+    static std::atomic<uint64_t> s_counters[COUNTERS_COUNT];
+    static std::atomic<uint64_t> s_phaseTimesNs[PHASES_COUNT];
+};
+}
+
+#endif // MU_ENGRAVING_LAYOUTSTATISTICS_H
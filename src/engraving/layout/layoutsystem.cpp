@@ -45,6 +45,7 @@
 #include "layoutlyrics.h"
 #include "layoutmeasure.h"
 #include "layouttuplets.h"
+#include "layoutstatistics.h"
 
 using namespace mu::engraving;
 using namespace Ms;
@@ -59,6 +60,9 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
         return nullptr;
     }
 
+    LayoutStatistics::PhaseTimer phaseTimer(LayoutStatistics::Phase::CollectSystem);
+    LayoutStatistics::add(LayoutStatistics::Counter::SystemsCollected);
+
     const MeasureBase* measure  = score->systems().empty() ? 0 : score->systems().back()->measures().back();
     if (measure) {
         measure = measure->findPotentialSectionBreak();
@@ -95,6 +99,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     while (ctx.curMeasure) {      // collect measure for system
         System* oldSystem = ctx.curMeasure->system();
         system->appendMeasure(ctx.curMeasure);
+        LayoutStatistics::add(LayoutStatistics::Counter::MeasuresCollected);
 
         qreal ww  = 0;          // width of current measure
 
@@ -35,6 +35,7 @@
 
 #include "factory.h"
 #include "types.h"
+#include "editjournal.h"
 #include "musescoreCore.h"
 #include "score.h"
 #include "utils.h"
@@ -91,6 +92,8 @@
 #include "mscoreview.h"
 #include "masterscore.h"
 
+#include "layout/layoutstatistics.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -254,6 +257,7 @@ void Score::startCmd()
         qDebug("Score::startCmd(): cmd already active");
         return;
     }
+    mu::engraving::LayoutStatistics::beginCommand();
     undoStack()->beginMacro(this);
 }
 
@@ -267,6 +271,8 @@ void Score::undoRedo(bool undo, EditData* ed)
         return;
     }
     cmdState().reset();
+    mu::engraving::LayoutStatistics::beginCommand();
+    const bool changed = undo ? undoStack()->canUndo() : undoStack()->canRedo();
     if (undo) {
         undoStack()->undo(ed);
     } else {
@@ -275,6 +281,12 @@ void Score::undoRedo(bool undo, EditData* ed)
     update(false);
     masterScore()->setPlaylistDirty();    // TODO: flag all individual operations
     updateSelection();
+
+    if (changed) {
+        if (EditJournal* journal = masterScore()->editJournal()) {
+            journal->recordCommand(this, undo ? undoStack()->next() : undoStack()->last());
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -306,6 +318,12 @@ void Score::endCmd(bool rollback)
     const bool noUndo = undoStack()->current()->empty(); // nothing to undo?
     undoStack()->endMacro(noUndo);
 
+    if (!noUndo && !rollback) {
+        if (EditJournal* journal = masterScore()->editJournal()) {
+            journal->recordCommand(this, undoStack()->last());
+        }
+    }
+
     if (dirty()) {
         masterScore()->setPlaylistDirty(); // TODO: flag individual operations
         masterScore()->setAutosaveDirty(true);
@@ -341,8 +359,14 @@ void Score::update(bool resetCmdState)
         CmdState& cs = ms->cmdState();
         ms->deletePostponed();
         if (cs.layoutRange()) {
+            // only the edited score, the master score and open parts
+            // are laid out now, other parts when they are needed
             for (Score* s : ms->scoreList()) {
-                s->doLayoutRange(cs.startTick(), cs.endTick());
+                if (s == this || s->isMaster() || !s->layoutOnDemand()) {
+                    s->doLayoutRange(cs.startTick(), cs.endTick());
+                } else {
+                    s->addPendingLayoutRange(cs.startTick(), cs.endTick(), cs.layoutFlags);
+                }
             }
             updateAll = true;
         }
@@ -0,0 +1,491 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "editjournal.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QBuffer>
+#include <QDataStream>
+
+#include "rw/xml.h"
+
+#include "masterscore.h"
+#include "measure.h"
+#include "score.h"
+#include "segment.h"
+#include "select.h"
+#include "spanner.h"
+#include "undo.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+namespace Ms {
+static constexpr quint32 JOURNAL_MAGIC = 0x4d534a31; // "MSJ1"
+static constexpr int JOURNAL_STREAM_VERSION = QDataStream::Qt_5_9;
+
+//---------------------------------------------------------
+//   journalHeader
+//---------------------------------------------------------
+
+static QByteArray journalHeader()
+{
+    QByteArray header;
+    QDataStream stream(&header, QIODevice::WriteOnly);
+    stream.setVersion(JOURNAL_STREAM_VERSION);
+    stream << JOURNAL_MAGIC << QString(MSC_VERSION);
+    return header;
+}
+
+//---------------------------------------------------------
+//   JournalSignature
+//    shape of the score an entry was recorded for, a range
+//    is only replayed onto a score of the same shape
+//---------------------------------------------------------
+
+struct JournalSignature {
+    qint32 measures = 0;
+    qint32 staves = 0;
+    qint32 endTick = 0;
+
+    JournalSignature(const Score* score)
+        : measures(score->nmeasures()), staves(score->nstaves()), endTick(score->endTick().ticks()) {}
+    JournalSignature(QDataStream& stream) { stream >> measures >> staves >> endTick; }
+
+    void write(QDataStream& stream) const { stream << measures << staves << endTick; }
+    bool operator==(const JournalSignature& o) const { return measures == o.measures && staves == o.staves && endTick == o.endTick; }
+};
+
+//---------------------------------------------------------
+//   isInStaffData
+//    whether e is written by Selection::staffMimeData() and
+//    restored by Score::pasteStaff()
+//---------------------------------------------------------
+
+static bool isInStaffData(const EngravingObject* e)
+{
+    if (!e) {
+        return false;
+    }
+    if (e->isSpannerSegment()) {
+        e = static_cast<const SpannerSegment*>(e)->spanner();
+    }
+    if (e->isSpanner()) {
+        return e->isSlur() || e->isTie() || e->isHairpin();
+    }
+    if (e->isTuplet() || e->isBeam()) {
+        return true;
+    }
+    if (e->isSegment()) {
+        return static_cast<const Segment*>(e)->isChordRestType();
+    }
+
+    // notes, chords, rests and annotations live in a chord rest segment,
+    // measure level elements (layout breaks, measure numbers...) don't
+    for (const EngravingObject* p = e->explicitParent(); p; p = p->explicitParent()) {
+        if (p->isSegment()) {
+            return static_cast<const Segment*>(p)->isChordRestType();
+        }
+        if (p->isMeasureBase() || p->isSystem() || p->isPage()) {
+            return false;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   replaysExactly
+//    whether the effect of cmd is fully restored by pasting
+//    the staff content of the range it touched
+//---------------------------------------------------------
+
+static bool replaysExactly(const UndoCommand* cmd)
+{
+    if (const AddElement* add = dynamic_cast<const AddElement*>(cmd)) {
+        return isInStaffData(add->getElement());
+    }
+    if (const RemoveElement* remove = dynamic_cast<const RemoveElement*>(cmd)) {
+        return isInStaffData(remove->getElement());
+    }
+    if (const ChangeProperty* change = dynamic_cast<const ChangeProperty*>(cmd)) {
+        return isInStaffData(change->getElement());
+    }
+    if (dynamic_cast<const ChangePitch*>(cmd)) {
+        return true;
+    }
+    if (dynamic_cast<const UndoMacro*>(cmd)) {
+        for (const UndoCommand* child : cmd->commands()) {
+            if (!replaysExactly(child)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+EditJournal::EditJournal(const QString& filePath)
+    : m_filePath(filePath)
+{
+    m_writer = std::thread([this]() { writerLoop(); });
+}
+
+EditJournal::~EditJournal()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stop = true;
+    }
+    m_queueChanged.notify_all();
+    m_writer.join();
+}
+
+QString EditJournal::filePath() const
+{
+    return m_filePath;
+}
+
+//---------------------------------------------------------
+//   reset
+//    start an empty journal, called once the score has
+//    been saved. The file is created again by the next entry
+//---------------------------------------------------------
+
+void EditJournal::reset()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_queue.clear();
+    }
+    waitForWritten();
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    QFile::remove(m_filePath);
+}
+
+//---------------------------------------------------------
+//   waitForWritten
+//    block until all recorded entries are in the file
+//---------------------------------------------------------
+
+void EditJournal::waitForWritten()
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    m_queueChanged.wait(lock, [this]() { return m_queue.empty() && !m_writing; });
+}
+
+qint64 EditJournal::size()
+{
+    waitForWritten();
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    return QFile(m_filePath).size();
+}
+
+//---------------------------------------------------------
+//   discardUntil
+//    drop the entries before pos (a value of size()) once
+//    a snapshot taken at that point has been written
+//---------------------------------------------------------
+
+bool EditJournal::discardUntil(qint64 pos)
+{
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+
+    const QByteArray header = journalHeader();
+    if (pos <= header.size() || !QFile::exists(m_filePath)) {
+        return true;
+    }
+
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadWrite)) {
+        LOGE() << "failed open journal: " << m_filePath;
+        return false;
+    }
+
+    file.seek(pos);
+    const QByteArray tail = file.readAll();
+
+    file.resize(header.size());
+    file.seek(header.size());
+    file.write(tail);
+    return file.flush();
+}
+
+//---------------------------------------------------------
+//   enqueue
+//---------------------------------------------------------
+
+void EditJournal::enqueue(PendingEntry&& entry)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_queue.push_back(std::move(entry));
+    }
+    m_queueChanged.notify_all();
+}
+
+//---------------------------------------------------------
+//   writerLoop
+//    writes the queued entries, all entries queued while
+//    the previous batch was written go in one write
+//---------------------------------------------------------
+
+void EditJournal::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+    while (true) {
+        m_queueChanged.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty()) {
+            return;
+        }
+
+        std::deque<PendingEntry> entries;
+        entries.swap(m_queue);
+        m_writing = true;
+
+        lock.unlock();
+        write(entries);
+        lock.lock();
+
+        m_writing = false;
+        m_queueChanged.notify_all();
+    }
+}
+
+//---------------------------------------------------------
+//   write
+//---------------------------------------------------------
+
+bool EditJournal::write(const std::deque<PendingEntry>& entries)
+{
+    QByteArray bytes;
+    for (const PendingEntry& pending : entries) {
+        QByteArray body;
+        body.append(static_cast<char>(pending.type));
+        body.append(pending.head);
+        if (!pending.xml.isEmpty()) {
+            QDataStream xmlStream(&body, QIODevice::Append);
+            xmlStream.setVersion(JOURNAL_STREAM_VERSION);
+            xmlStream << qCompress(pending.xml);
+        }
+
+        QDataStream stream(&bytes, QIODevice::Append);
+        stream.setVersion(JOURNAL_STREAM_VERSION);
+        stream << quint32(body.size());
+        stream.writeRawData(body.constData(), body.size());
+        stream << quint16(qChecksum(body.constData(), body.size()));
+    }
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        LOGE() << "failed open journal: " << m_filePath;
+        return false;
+    }
+
+    if (file.size() == 0) {
+        file.write(journalHeader());
+    }
+
+    // a single write, so that a crash leaves at most one torn entry at the end
+    if (file.write(bytes) != bytes.size()) {
+        LOGE() << "failed write journal: " << m_filePath;
+        return false;
+    }
+
+    return file.flush();
+}
+
+//---------------------------------------------------------
+//   recordCommand
+//    called at the end of every command and every undo/redo
+//    with the macro that has been done, undone or redone
+//---------------------------------------------------------
+
+void EditJournal::recordCommand(Score* score, const UndoCommand* command)
+{
+    TRACEFUNC;
+
+    MasterScore* ms = score->masterScore();
+    const CmdState& cs = ms->cmdState();
+
+    Measure* m1 = nullptr;
+    Measure* m2 = nullptr;
+
+    if (score == ms && command && replaysExactly(command) && cs.layoutRange()
+        && !cs._excerptsChanged && !cs._instrumentsChanged
+        && cs.startTick() >= Fraction(0, 1) && ms->lastMeasure()) {
+        // a range over the whole score is what setLayoutAll() does for
+        // style and other score wide changes, which are not in the staves
+        bool wholeScore = cs.startTick().isZero() && cs.endTick() >= ms->lastMeasure()->endTick()
+                          && ms->firstMeasure() != ms->lastMeasure();
+
+        if (!wholeScore) {
+            m1 = ms->tick2measure(cs.startTick());
+            m2 = ms->tick2measure(cs.endTick());
+            if (!m2) {
+                m2 = ms->lastMeasure();
+            }
+        }
+    }
+
+    Segment* s1 = (m1 && m2 && m2->tick() >= m1->tick()) ? m1->first(SegmentType::ChordRest) : nullptr;
+    if (!s1) {
+        enqueue({ EntryType::Barrier, QByteArray(), QByteArray() });
+        return;
+    }
+
+    Measure* next = m2->nextMeasure();
+    Segment* s2 = next ? next->first(SegmentType::ChordRest) : nullptr;
+
+    Selection range(ms);
+    range.setRange(s1, s2, 0, ms->nstaves());
+
+    PendingEntry entry;
+    entry.type = EntryType::Range;
+    QDataStream stream(&entry.head, QIODevice::WriteOnly);
+    stream.setVersion(JOURNAL_STREAM_VERSION);
+    JournalSignature(ms).write(stream);
+    stream << qint32(s1->tick().ticks()) << qint32(m2->endTick().ticks());
+    // compressed by the writer thread
+    entry.xml = range.staffMimeData(SelectionFilter());
+
+    enqueue(std::move(entry));
+}
+
+//---------------------------------------------------------
+//   hasEntries
+//---------------------------------------------------------
+
+bool EditJournal::hasEntries(const QString& filePath)
+{
+    QFileInfo fi(filePath);
+    return fi.exists() && fi.size() > journalHeader().size();
+}
+
+//---------------------------------------------------------
+//   replay
+//    apply the journal onto score, which must be the
+//    snapshot the journal was started from. The replay
+//    stops at the first entry that can't be applied, the
+//    result tells how far it got
+//---------------------------------------------------------
+
+EditJournal::ReplayResult EditJournal::replay(const QString& filePath, MasterScore* score)
+{
+    TRACEFUNC;
+
+    ReplayResult result;
+
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return result;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(JOURNAL_STREAM_VERSION);
+
+    quint32 magic = 0;
+    QString version;
+    stream >> magic >> version;
+    if (magic != JOURNAL_MAGIC || version != MSC_VERSION) {
+        LOGW() << "unknown journal format: " << filePath;
+        result.complete = false;
+        return result;
+    }
+
+    while (!stream.atEnd()) {
+        quint32 size = 0;
+        stream >> size;
+        QByteArray body(size, Qt::Uninitialized);
+        if (stream.readRawData(body.data(), size) != int(size)) {
+            // torn by a crash while it was written, nothing was lost before it
+            LOGW() << "truncated journal entry, stop";
+            break;
+        }
+        quint16 checksum = 0;
+        stream >> checksum;
+        if (stream.status() != QDataStream::Ok || body.isEmpty() || checksum != qChecksum(body.constData(), body.size())) {
+            LOGW() << "corrupted journal entry, stop";
+            break;
+        }
+
+        EntryType type = static_cast<EntryType>(body.at(0));
+        if (type != EntryType::Range) {
+            LOGW() << "journal barrier, the commands after the last snapshot are not all recoverable";
+            result.complete = false;
+            break;
+        }
+
+        QDataStream entry(body.mid(1));
+        entry.setVersion(JOURNAL_STREAM_VERSION);
+        JournalSignature signature(entry);
+        qint32 tick = 0;
+        qint32 endTick = 0;
+        QByteArray xml;
+        entry >> tick >> endTick >> xml;
+
+        // the score no longer is the one the entry was recorded for,
+        // later entries would be applied to a diverged score
+        if (!(signature == JournalSignature(score))) {
+            LOGW() << "journal entry recorded for another score layout, stop";
+            result.complete = false;
+            break;
+        }
+
+        Measure* m1 = score->tick2measure(Fraction::fromTicks(tick));
+        Segment* s1 = m1 ? m1->first(SegmentType::ChordRest) : nullptr;
+        if (!s1 || s1->tick().ticks() != tick) {
+            LOGW() << "journal entry start not found, stop";
+            result.complete = false;
+            break;
+        }
+        Measure* m2 = endTick < score->endTick().ticks() ? score->tick2measure(Fraction::fromTicks(endTick)) : nullptr;
+        Segment* s2 = m2 ? m2->first(SegmentType::ChordRest) : nullptr;
+
+        XmlReader e(qUncompress(xml));
+        e.setPasteMode(true);
+
+        score->startCmd();
+        // the range is replaced as a whole, voices emptied by the edit included
+        score->deleteRange(s1, s2, 0, score->ntracks(), SelectionFilter());
+        s1 = m1->first(SegmentType::ChordRest);
+        bool ok = score->pasteStaff(e, s1, 0);
+        score->endCmd(!ok);
+
+        if (!ok) {
+            LOGW() << "failed to apply journal entry, stop";
+            result.complete = false;
+            break;
+        }
+
+        ++result.replayed;
+    }
+
+    return result;
+}
+}
@@ -0,0 +1,109 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __EDITJOURNAL_H__
+#define __EDITJOURNAL_H__
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <QString>
+#include <QByteArray>
+
+namespace Ms {
+class Score;
+class MasterScore;
+class UndoCommand;
+
+//---------------------------------------------------------
+//   EditJournal
+//    Append-only log of the commands applied to a score
+//    since its last snapshot (a save or an autosave).
+//
+//    A command is recorded as the new content of the
+//    measures it touched, in the clipboard (StaffList)
+//    format, when pasting that content back reproduces it
+//    exactly: only note, chord and annotation edits inside
+//    the staves qualify. Anything else (measure properties,
+//    layout breaks, system spanners, style, parts...) is
+//    recorded as a barrier: the replay stops there and
+//    relies on the next snapshot.
+//
+//    Entries are compressed and written by a background
+//    thread, in batches.
+//---------------------------------------------------------
+
+class EditJournal
+{
+public:
+    struct ReplayResult {
+        int replayed = 0;
+        bool complete = true;       // false if the replay stopped before the end of the journal
+    };
+
+    EditJournal(const QString& filePath);
+    ~EditJournal();
+
+    QString filePath() const;
+
+    void reset();
+
+    void recordCommand(Score* score, const UndoCommand* command);
+    void waitForWritten();
+
+    qint64 size();
+    bool discardUntil(qint64 pos);
+
+    static bool hasEntries(const QString& filePath);
+    static ReplayResult replay(const QString& filePath, MasterScore* score);
+
+private:
+    enum class EntryType : unsigned char {
+        Range,
+        Barrier
+    };
+
+    struct PendingEntry {
+        EntryType type = EntryType::Barrier;
+        QByteArray head;
+        QByteArray xml;
+    };
+
+    void enqueue(PendingEntry&& entry);
+    void writerLoop();
+    bool write(const std::deque<PendingEntry>& entries);
+
+    QString m_filePath;
+
+    std::mutex m_fileMutex;
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueChanged;
+    std::deque<PendingEntry> m_queue;
+    bool m_writing = false;
+    bool m_stop = false;
+    std::thread m_writer;
+};
+} // namespace Ms
+
+#endif
@@ -188,8 +188,13 @@ void EngravingItem::setupAccessible()
 
     if (score() && !score()->isPaletteScore()) {
         if (std::find(accessibleDisabled.begin(), accessibleDisabled.end(), type()) == accessibleDisabled.end()) {
-            m_accessible = createAccessible();
-            m_accessible->setup();
+            m_accessibleEnabled = true;
+
+            //! NOTE Registering an accessible object is expensive, so only the roots get one here,
+            //! the elements get theirs on demand, see accessible()
+            if (type() == ElementType::ROOT_ITEM || !AccessibleItem::createOnDemand) {
+                accessible();
+            }
         }
     }
 }
@@ -1938,11 +1943,42 @@ EngravingItem* EngravingItem::prevSegmentElement()
     return score()->firstElement();
 }
 
+//---------------------------------------------------------
+//   accessible
+//    created when an assistive technology asks for it,
+//    or when the element is selected; the accessible objects
+//    of the elements are kept in a bounded cache
+//---------------------------------------------------------
+
 mu::engraving::AccessibleItem* EngravingItem::accessible() const
 {
+    if (!m_accessibleEnabled) {
+        return m_accessible;
+    }
+
+    if (!m_accessible) {
+        m_accessible = const_cast<EngravingItem*>(this)->createAccessible();
+        m_accessible->setup();
+    }
+
+    if (type() != ElementType::ROOT_ITEM && AccessibleItem::createOnDemand) {
+        AccessibleItem::cache(m_accessible);
+    }
+
     return m_accessible;
 }
 
+bool EngravingItem::accessibleEnabled() const
+{
+    return m_accessibleEnabled;
+}
+
+void EngravingItem::resetAccessible()
+{
+    delete m_accessible;
+    m_accessible = nullptr;
+}
+
 //---------------------------------------------------------
 //   accessibleInfo
 //---------------------------------------------------------
@@ -2638,7 +2674,9 @@ void EngravingItem::setSelected(bool f)
     setFlag(ElementFlag::SELECTED, f);
 
     if (f) {
-        if (m_accessible) {
+        if (m_accessible || (m_accessibleEnabled && AccessibleItem::accessibilityActive())) {
+            accessible();
+
             AccessibleRoot* accRoot = score()->rootItem()->accessible()->accessibleRoot();
             if (accRoot && accRoot->registered()) {
                 accRoot->setFocusedElement(nullptr);
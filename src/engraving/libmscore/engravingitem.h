@@ -208,7 +208,8 @@ class EngravingItem : public EngravingObject
     ///< valid after call to layout()
     uint _tag;                    ///< tag bitmask
 
-    mu::engraving::AccessibleItem* m_accessible = nullptr;
+    mutable mu::engraving::AccessibleItem* m_accessible = nullptr;
+    bool m_accessibleEnabled = false;
 
 protected:
     mutable int _z;
@@ -567,6 +568,8 @@ public:
     virtual EngravingItem* prevSegmentElement();    //< next-element and prev-element command
 
     mu::engraving::AccessibleItem* accessible() const;
+    bool accessibleEnabled() const;
+    void resetAccessible();
     virtual QString accessibleInfo() const;           //< used to populate the status bar
     virtual QString screenReaderInfo() const          //< by default returns accessibleInfo, but can be overridden
     {
@@ -48,6 +48,7 @@ using namespace mu::engraving;
 
 namespace Ms {
 ElementStyle const EngravingObject::emptyStyle;
+std::atomic<EngravingObject::DeleteListener> EngravingObject::s_deleteListener { nullptr };
 
 EngravingObject* EngravingObjectList::at(size_t i) const
 {
@@ -119,6 +120,10 @@ EngravingObject::~EngravingObject()
         elementsProvider()->unreg(this);
     }
 
+    if (DeleteListener l = s_deleteListener.load(std::memory_order_acquire)) {
+        l(this);
+    }
+
     if (_links) {
         _links->removeOne(this);
         if (_links->empty()) {
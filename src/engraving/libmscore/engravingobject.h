@@ -23,6 +23,8 @@
 #ifndef MU_ENGRAVING_OBJECT_H
 #define MU_ENGRAVING_OBJECT_H
 
+#include <atomic>
+
 #include "types.h"
 #include "infrastructure/draw/geometry.h"
 #include "style/styledef.h"
@@ -186,6 +188,9 @@ class EngravingObject
 
     static ElementStyle const emptyStyle;
 
+    using DeleteListener = void (*)(const EngravingObject*);
+    static std::atomic<DeleteListener> s_deleteListener;
+
     void doSetParent(EngravingObject* p);
     void doSetScore(Score* sc);
     void moveToDummy();
@@ -208,6 +213,10 @@ public:
 
     virtual ~EngravingObject();
 
+    //! NOTE The listener is called from the destructor of every object, on the
+    //! deleting thread, to drop references kept outside of the score tree
+    static void setDeleteListener(DeleteListener l) { s_deleteListener.store(l, std::memory_order_release); }
+
     inline ElementType type() const { return m_type; }
     inline bool isType(ElementType t) const { return t == m_type; }
     const char* name() const;
@@ -474,7 +474,7 @@ CREATE_ITEM_IMPL(Chord, ElementType::CHORD, Segment, setupAccessible)
 Ms::Chord* Factory::copyChord(const Ms::Chord& src, bool link)
 {
     Chord* copy = new Chord(src, link);
-    if (src.accessible()) {
+    if (src.accessibleEnabled()) {
         copy->setupAccessible();
     }
 
@@ -518,7 +518,7 @@ CREATE_ITEM_IMPL(Note, ElementType::NOTE, Chord, setupAccessible)
 Note* Factory::copyNote(const Note& src, bool link)
 {
     Note* copy = new Note(src, link);
-    if (src.accessible()) {
+    if (src.accessibleEnabled()) {
         copy->setupAccessible();
     }
 
@@ -563,7 +563,7 @@ Ms::Rest* Factory::createRest(Ms::Segment* parent, const Ms::TDuration& t, bool
 Ms::Rest* Factory::copyRest(const Ms::Rest& src, bool link)
 {
     Rest* copy = new Rest(src, link);
-    if (src.accessible()) {
+    if (src.accessibleEnabled()) {
         copy->setupAccessible();
     }
 
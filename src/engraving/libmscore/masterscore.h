@@ -44,6 +44,7 @@ class ReadStyleHook;
 }
 
 namespace Ms {
+class EditJournal;
 class Excerpt;
 class MasterScore;
 class Part;
@@ -88,6 +89,7 @@ class MasterScore : public Score
     std::vector<PartChannelSettingsLink> _playbackSettingsLinks;
     Score* _playbackScore = nullptr;
     Revisions* _revisions;
+    EditJournal* m_editJournal = nullptr;
 
     bool _readOnly = false;
 
@@ -178,6 +180,9 @@ public:
 
     Revisions* revisions() { return _revisions; }
 
+    EditJournal* editJournal() const { return m_editJournal; }
+    void setEditJournal(EditJournal* journal) { m_editJournal = journal; }
+
     bool isSavable() const;
     void setTempomap(TempoMap* tm);
 
@@ -103,6 +103,8 @@
 #include "utils.h"
 #include "volta.h"
 
+#include "layout/layoutstatistics.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -4069,6 +4071,8 @@ float Measure::durationStretch(Fraction curTicks, const Fraction minTicks) const
 
 void Measure::computeWidth(Segment* s, qreal x, bool isSystemHeader, Fraction minTicks, qreal stretchCoeff)
 {
+    mu::engraving::LayoutStatistics::add(mu::engraving::LayoutStatistics::Counter::MeasureWidthComputations);
+
     Segment* fs = firstEnabled();
     if (!fs->visible()) {           // first enabled could be a clef change on invisible staff
         fs = fs->nextActive();
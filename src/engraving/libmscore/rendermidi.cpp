@@ -70,6 +70,8 @@
 
 #include "masterscore.h"
 
+#include "layout/layoutstatistics.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -2490,6 +2492,9 @@ void MidiRenderer::renderScore(EventMap* events, const Context& ctx)
 
 void MidiRenderer::renderChunk(const Chunk& chunk, EventMap* events, const Context& ctx)
 {
+    mu::engraving::LayoutStatistics::PhaseTimer phaseTimer(mu::engraving::LayoutStatistics::Phase::MidiRender);
+    mu::engraving::LayoutStatistics::add(mu::engraving::LayoutStatistics::Counter::MidiChunksRendered);
+
     // TODO: avoid doing it multiple times for the same measures
     score->createPlayEvents(chunk.startMeasure(), chunk.endMeasure());
 
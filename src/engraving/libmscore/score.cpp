@@ -4168,6 +4168,12 @@ bool Score::isSpannerStartEnd(const Fraction& tick, int track) const
 
 void Score::insertTime(const Fraction& tick, const Fraction& len)
 {
+    // measures after tick move, so a postponed range recorded
+    // in ticks is only valid up to tick
+    if (_layoutPending && len != Fraction(0, 1)) {
+        _pendingLayoutStart = qMin(_pendingLayoutStart, qMax(tick, Fraction(0, 1)));
+        _pendingLayoutEnd = Fraction(-1, 1);
+    }
     for (Staff* staff : staves()) {
         staff->insertTime(tick, len);
     }
@@ -5310,11 +5316,69 @@ void Score::doLayout()
 
 void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 {
+    Fraction stick = st;
+    Fraction etick = et;
+
+    // a postponed range is laid out together with the requested one
+    if (_layoutPending) {
+        _layoutPending = false;
+        stick = qMin(qMax(stick, Fraction(0, 1)), qMax(_pendingLayoutStart, Fraction(0, 1)));
+        if (etick < Fraction(0, 1) || _pendingLayoutEnd < Fraction(0, 1)) {
+            etick = Fraction(-1, 1);
+        } else {
+            etick = qMax(etick, _pendingLayoutEnd);
+        }
+        if ((_pendingLayoutFlags & LayoutFlag::FIX_PITCH_VELO) && !(cmdState().layoutFlags & LayoutFlag::FIX_PITCH_VELO)) {
+            updateVelo();
+        }
+        _pendingLayoutFlags = LayoutFlag::NO_FLAGS;
+    }
+
     _scoreFont = ScoreFont::fontByName(style().value(Sid::MusicalSymbolFont).toString());
     _noteHeadWidth = _scoreFont->width(SymId::noteheadBlack, spatium() / SPATIUM20);
 
     m_layoutOptions.updateFromStyle(style());
-    m_layout.doLayoutRange(m_layoutOptions, st, et);
+    m_layout.doLayoutRange(m_layoutOptions, stick, etick);
+}
+
+//---------------------------------------------------------
+//   addPendingLayoutRange
+//    Postpone the layout of a tick range until the score is
+//    shown, saved or exported (see doPendingLayout()).
+//    Ranges of consecutive commands are merged, so a part
+//    that is not looked at is laid out once for many edits.
+//---------------------------------------------------------
+
+void Score::addPendingLayoutRange(const Fraction& st, const Fraction& et, LayoutFlags flags)
+{
+    const Fraction stick = qMax(st, Fraction(0, 1));
+    if (!_layoutPending) {
+        _layoutPending = true;
+        _pendingLayoutStart = stick;
+        _pendingLayoutEnd = et;
+    } else {
+        _pendingLayoutStart = qMin(_pendingLayoutStart, stick);
+        if (et < Fraction(0, 1) || _pendingLayoutEnd < Fraction(0, 1)) {
+            _pendingLayoutEnd = Fraction(-1, 1);
+        } else {
+            _pendingLayoutEnd = qMax(_pendingLayoutEnd, et);
+        }
+    }
+    _pendingLayoutFlags |= flags;
+}
+
+//---------------------------------------------------------
+//   doPendingLayout
+//    lay out the range postponed by update(), if any
+//---------------------------------------------------------
+
+void Score::doPendingLayout()
+{
+    if (!_layoutPending) {
+        return;
+    }
+
+    doLayoutRange(_pendingLayoutStart, _pendingLayoutEnd);
 }
 
 UndoStack* Score::undoStack() const { return _masterScore->undoStack(); }
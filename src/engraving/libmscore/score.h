@@ -431,6 +431,13 @@ private:
     QList<Page*> _pages;            // pages are build from systems
     QList<System*> _systems;        // measures are accumulated to systems
 
+    // layout of this score postponed by update(), see addPendingLayoutRange()
+    bool _layoutOnDemand { true };
+    bool _layoutPending { false };
+    Fraction _pendingLayoutStart { -1, 1 };
+    Fraction _pendingLayoutEnd { -1, 1 };
+    LayoutFlags _pendingLayoutFlags;
+
     InputState _is;
     MStyle _style;
     ChordList _chordList;
@@ -1060,6 +1067,14 @@ public:
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
 
+    //! NOTE A part that is not open is laid out on demand: code reading the layout
+    //! (pages, systems, positions) of such a score must call doPendingLayout() first
+    void setLayoutOnDemand(bool onDemand) { _layoutOnDemand = onDemand; }
+    bool layoutOnDemand() const { return _layoutOnDemand; }
+    void addPendingLayoutRange(const Fraction& st, const Fraction& et, LayoutFlags flags);
+    bool layoutPending() const { return _layoutPending; }
+    void doPendingLayout();
+
     SynthesizerState& synthesizerState() { return _synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
 
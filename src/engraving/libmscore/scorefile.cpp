@@ -78,6 +78,8 @@ namespace Ms {
 
 void Score::write(XmlWriter& xml, bool selectionOnly, compat::WriteScoreHook& hook)
 {
+    doPendingLayout();
+
     // if we have multi measure rests and some parts are hidden,
     // then some layout information is missing:
     // relayout with all parts set visible
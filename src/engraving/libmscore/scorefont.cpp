@@ -21,12 +21,23 @@
  */
 #include "scorefont.h"
 
+#include <cstring>
+
+#include <QCryptographicHash>
+#include <QDir>
 #include <QFile>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonParseError>
+#include <QSaveFile>
+
+#ifndef NO_ENGRAVING_INTERNAL
+#include "ft2build.h"
+#include FT_FREETYPE_H
+#endif
 
+#include "global/version.h"
 #include "draw/painter.h"
 #include "types/symnames.h"
 
@@ -41,6 +52,104 @@ using namespace mu::engraving;
 
 static constexpr int FALLBACK_FONT_INDEX = 1; // Bravura
 
+// =============================================
+// Metrics cache format
+// =============================================
+//! NOTE The cache files are flat arrays of fixed-size records, so they can be
+//! mapped into memory and read without any parsing. They are only meaningful
+//! on the machine that wrote them, which is why the record size is stored too.
+
+static constexpr char METRICS_CACHE_MAGIC[8] = { 'M', 'S', 'S', 'F', 'M', 'C', '\0', '\0' };
+static constexpr uint32_t METRICS_CACHE_VERSION = 1;
+static constexpr size_t MAX_CACHED_SUB_SYMBOLS = 8;
+static constexpr size_t SMUFL_ANCHOR_COUNT = static_cast<size_t>(SmuflAnchorId::opticalCenter) + 1;
+
+//! NOTE The cached metrics depend on the code that measured them, so the caches
+//! written by another version of the app or of FreeType are not used
+static QByteArray metricsCacheSalt()
+{
+    QByteArray salt = QByteArray::fromStdString(framework::Version::fullVersion())
+                      + " " + QByteArray::fromStdString(framework::Version::revision());
+#ifndef NO_ENGRAVING_INTERNAL
+    salt += " freetype " + QByteArray::number(FREETYPE_MAJOR)
+            + "." + QByteArray::number(FREETYPE_MINOR)
+            + "." + QByteArray::number(FREETYPE_PATCH);
+#endif
+    return salt;
+}
+
+static const QString GLYPH_NAMES_PATH(":fonts/smufl/glyphnames.json");
+static const QString SYM_CODES_CACHE_FILE_NAME("smuflcodes.bin");
+static const QString METRICS_CACHE_FILE_SUFFIX(".metrics");
+
+enum class CacheKind : uint32_t {
+    SymCodes = 0,
+    Metrics
+};
+
+struct CacheHeader {
+    char magic[8];
+    uint32_t version = 0;
+    uint32_t kind = 0;
+    uint32_t recordSize = 0;
+    uint32_t symCount = 0;
+    uint32_t engravingDefaultsCount = 0;
+    uint32_t reserved = 0;
+    char hash[16];
+    double textEnclosureThickness = 0.0;
+};
+
+struct CachedSym {
+    uint32_t code = 0;
+    uint32_t anchorMask = 0;
+    uint32_t subSymbolCount = 0;
+    uint32_t subSymbolIds[MAX_CACHED_SUB_SYMBOLS];
+    double bbox[4];
+    double advance = 0.0;
+    double anchors[SMUFL_ANCHOR_COUNT][2];
+};
+
+struct CachedEngravingDefault {
+    int32_t sid = 0;
+    int32_t reserved = 0;
+    double value = 0.0;
+};
+
+static QByteArray readFileData(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    return file.readAll();
+}
+
+static CacheHeader makeCacheHeader(CacheKind kind, uint32_t recordSize, size_t symCount, const QByteArray& hash)
+{
+    CacheHeader header;
+    std::memcpy(header.magic, METRICS_CACHE_MAGIC, sizeof(header.magic));
+    header.version = METRICS_CACHE_VERSION;
+    header.kind = static_cast<uint32_t>(kind);
+    header.recordSize = recordSize;
+    header.symCount = static_cast<uint32_t>(symCount);
+    std::memset(header.hash, 0, sizeof(header.hash));
+    std::memcpy(header.hash, hash.constData(), std::min(sizeof(header.hash), size_t(hash.size())));
+    return header;
+}
+
+static bool isCacheHeaderValid(const CacheHeader& header, CacheKind kind, uint32_t recordSize, size_t symCount,
+                               const QByteArray& hash)
+{
+    return std::memcmp(header.magic, METRICS_CACHE_MAGIC, sizeof(header.magic)) == 0
+           && header.version == METRICS_CACHE_VERSION
+           && header.kind == static_cast<uint32_t>(kind)
+           && header.recordSize == recordSize
+           && header.symCount == symCount
+           && size_t(hash.size()) == sizeof(header.hash)
+           && std::memcmp(header.hash, hash.constData(), sizeof(header.hash)) == 0;
+}
+
 std::vector<ScoreFont> ScoreFont::s_scoreFonts {
     ScoreFont("Leland",     "Leland",      ":/fonts/leland/",    "Leland.otf"),
     ScoreFont("Bravura",    "Bravura",     ":/fonts/bravura/",   "Bravura.otf"),
@@ -51,6 +160,7 @@ std::vector<ScoreFont> ScoreFont::s_scoreFonts {
 };
 
 std::array<uint, size_t(SymId::lastSym) + 1> ScoreFont::s_symIdCodes { { 0 } };
+QByteArray ScoreFont::s_glyphNamesHash;
 
 // =============================================
 // ScoreFont
@@ -110,22 +220,40 @@ double ScoreFont::textEnclosureThickness()
 
 void ScoreFont::initScoreFonts()
 {
-    QJsonObject glyphNamesJson(ScoreFont::initGlyphNamesJson());
-    IF_ASSERT_FAILED(!glyphNamesJson.empty()) {
-        LOGE() << "Could not read glyph names JSON";
+    QByteArray glyphNamesData = readFileData(GLYPH_NAMES_PATH);
+    IF_ASSERT_FAILED(!glyphNamesData.isEmpty()) {
+        LOGE() << "could not open glyph names JSON file.";
         return;
     }
 
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(metricsCacheSalt());
+    hash.addData(glyphNamesData);
     for (size_t i = 0; i < s_symIdCodes.size(); ++i) {
-        QString name(SymNames::nameForSymId(static_cast<SymId>(i)));
-
-        bool ok;
-        uint code = glyphNamesJson.value(name).toObject().value("codepoint").toString().midRef(2).toUInt(&ok, 16);
-        if (ok) {
-            s_symIdCodes[i] = code;
-        } else if (MScore::debugMode) {
-            LOGD() << "could not read codepoint for glyph " << name;
+        hash.addData(QByteArray(SymNames::nameForSymId(static_cast<SymId>(i))));
+    }
+    s_glyphNamesHash = hash.result();
+
+    if (!loadSymIdCodesCache(s_glyphNamesHash)) {
+        QJsonObject glyphNamesJson(ScoreFont::initGlyphNamesJson(glyphNamesData));
+        IF_ASSERT_FAILED(!glyphNamesJson.empty()) {
+            LOGE() << "Could not read glyph names JSON";
+            return;
         }
+
+        for (size_t i = 0; i < s_symIdCodes.size(); ++i) {
+            QString name(SymNames::nameForSymId(static_cast<SymId>(i)));
+
+            bool ok;
+            uint code = glyphNamesJson.value(name).toObject().value("codepoint").toString().midRef(2).toUInt(&ok, 16);
+            if (ok) {
+                s_symIdCodes[i] = code;
+            } else if (MScore::debugMode) {
+                LOGD() << "could not read codepoint for glyph " << name;
+            }
+        }
+
+        writeSymIdCodesCache(s_glyphNamesHash);
     }
 
     fontProvider()->insertSubstitution("Leland Text",    "Bravura Text");
@@ -139,17 +267,10 @@ void ScoreFont::initScoreFonts()
     fallbackFont(); // load fallback font
 }
 
-QJsonObject ScoreFont::initGlyphNamesJson()
+QJsonObject ScoreFont::initGlyphNamesJson(const QByteArray& data)
 {
-    QFile file(":fonts/smufl/glyphnames.json");
-    if (!file.open(QIODevice::ReadOnly)) {
-        LOGE() << "could not open glyph names JSON file.";
-        return QJsonObject();
-    }
-
     QJsonParseError error;
-    QJsonObject glyphNamesJson = QJsonDocument::fromJson(file.readAll(), &error).object();
-    file.close();
+    QJsonObject glyphNamesJson = QJsonDocument::fromJson(data, &error).object();
 
     if (error.error != QJsonParseError::NoError) {
         LOGE() << "JSON parse error in glyph names file: " << error.errorString()
@@ -160,6 +281,213 @@ QJsonObject ScoreFont::initGlyphNamesJson()
     return glyphNamesJson;
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+QString ScoreFont::metricsCacheDirPath()
+{
+    //! NOTE Tests must not depend on (or leave behind) state in the user's directories
+    if (MScore::testMode || !globalConfiguration()) {
+        return QString();
+    }
+
+    return globalConfiguration()->userAppDataPath().toQString() + "/fontmetrics";
+}
+
+bool ScoreFont::loadSymIdCodesCache(const QByteArray& hash)
+{
+    QString dirPath = metricsCacheDirPath();
+    if (dirPath.isEmpty()) {
+        return false;
+    }
+
+    QFile file(dirPath + "/" + SYM_CODES_CACHE_FILE_NAME);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    const qint64 expectedSize = sizeof(CacheHeader) + s_symIdCodes.size() * sizeof(uint32_t);
+    if (file.size() != expectedSize) {
+        return false;
+    }
+
+    const uchar* data = file.map(0, expectedSize);
+    if (!data) {
+        return false;
+    }
+
+    const CacheHeader* header = reinterpret_cast<const CacheHeader*>(data);
+    if (!isCacheHeaderValid(*header, CacheKind::SymCodes, sizeof(uint32_t), s_symIdCodes.size(), hash)) {
+        return false;
+    }
+
+    const uint32_t* codes = reinterpret_cast<const uint32_t*>(data + sizeof(CacheHeader));
+    for (size_t i = 0; i < s_symIdCodes.size(); ++i) {
+        s_symIdCodes[i] = codes[i];
+    }
+
+    return true;
+}
+
+void ScoreFont::writeSymIdCodesCache(const QByteArray& hash)
+{
+    QString dirPath = metricsCacheDirPath();
+    if (dirPath.isEmpty() || !QDir().mkpath(dirPath)) {
+        return;
+    }
+
+    QSaveFile file(dirPath + "/" + SYM_CODES_CACHE_FILE_NAME);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGW() << "failed to write SMuFL codes cache: " << file.fileName();
+        return;
+    }
+
+    CacheHeader header = makeCacheHeader(CacheKind::SymCodes, sizeof(uint32_t), s_symIdCodes.size(), hash);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<uint32_t> codes(s_symIdCodes.begin(), s_symIdCodes.end());
+    file.write(reinterpret_cast<const char*>(codes.data()), codes.size() * sizeof(uint32_t));
+
+    file.commit();
+}
+
+QByteArray ScoreFont::metricsHash() const
+{
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(s_glyphNamesHash);
+    hash.addData(QByteArray::number(DPI_F));
+    hash.addData(readFileData(m_fontPath + m_filename));
+    hash.addData(readFileData(m_fontPath + "metadata.json"));
+    return hash.result();
+}
+
+bool ScoreFont::loadMetricsCache(const QByteArray& hash)
+{
+    QString dirPath = metricsCacheDirPath();
+    if (dirPath.isEmpty()) {
+        return false;
+    }
+
+    QFile file(dirPath + "/" + m_name.toLower() + METRICS_CACHE_FILE_SUFFIX);
+    if (!file.open(QIODevice::ReadOnly) || file.size() < qint64(sizeof(CacheHeader))) {
+        return false;
+    }
+
+    const uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
+
+    const CacheHeader* header = reinterpret_cast<const CacheHeader*>(data);
+    if (!isCacheHeaderValid(*header, CacheKind::Metrics, sizeof(CachedSym), m_symbols.size(), hash)) {
+        return false;
+    }
+
+    const qint64 expectedSize = sizeof(CacheHeader)
+                                + header->symCount * sizeof(CachedSym)
+                                + header->engravingDefaultsCount * sizeof(CachedEngravingDefault);
+    if (file.size() != expectedSize) {
+        return false;
+    }
+
+    const CachedSym* symbols = reinterpret_cast<const CachedSym*>(data + sizeof(CacheHeader));
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        const CachedSym& cached = symbols[id];
+        Sym& sym = m_symbols[id];
+
+        sym.code = cached.code;
+        sym.bbox = RectF(cached.bbox[0], cached.bbox[1], cached.bbox[2], cached.bbox[3]);
+        sym.advance = cached.advance;
+
+        for (size_t anchor = 0; anchor < SMUFL_ANCHOR_COUNT; ++anchor) {
+            if (cached.anchorMask & (1u << anchor)) {
+                sym.smuflAnchors[static_cast<SmuflAnchorId>(anchor)] = PointF(cached.anchors[anchor][0], cached.anchors[anchor][1]);
+            }
+        }
+
+        for (uint32_t i = 0; i < cached.subSymbolCount && i < MAX_CACHED_SUB_SYMBOLS; ++i) {
+            sym.subSymbolIds.push_back(static_cast<SymId>(cached.subSymbolIds[i]));
+        }
+    }
+
+    const CachedEngravingDefault* defaults = reinterpret_cast<const CachedEngravingDefault*>(
+        data + sizeof(CacheHeader) + header->symCount * sizeof(CachedSym));
+    for (uint32_t i = 0; i < header->engravingDefaultsCount; ++i) {
+        m_engravingDefaults.push_back({ static_cast<Sid>(defaults[i].sid), defaults[i].value });
+    }
+    m_engravingDefaults.push_back({ Sid::MusicalTextFont, QString("%1 Text").arg(m_family) });
+    m_textEnclosureThickness = header->textEnclosureThickness;
+
+    return true;
+}
+
+void ScoreFont::writeMetricsCache(const QByteArray& hash) const
+{
+    QString dirPath = metricsCacheDirPath();
+    if (dirPath.isEmpty() || !QDir().mkpath(dirPath)) {
+        return;
+    }
+
+    std::vector<CachedEngravingDefault> defaults;
+    for (const auto& pair : m_engravingDefaults) {
+        if (pair.first == Sid::MusicalTextFont) {
+            continue;
+        }
+
+        CachedEngravingDefault cached;
+        cached.sid = static_cast<int32_t>(pair.first);
+        cached.value = pair.second.toDouble();
+        defaults.push_back(cached);
+    }
+
+    std::vector<CachedSym> symbols(m_symbols.size());
+    for (size_t id = 0; id < m_symbols.size(); ++id) {
+        const Sym& sym = m_symbols[id];
+        CachedSym& cached = symbols[id];
+        std::memset(&cached, 0, sizeof(cached));
+
+        cached.code = sym.code;
+        cached.bbox[0] = sym.bbox.x();
+        cached.bbox[1] = sym.bbox.y();
+        cached.bbox[2] = sym.bbox.width();
+        cached.bbox[3] = sym.bbox.height();
+        cached.advance = sym.advance;
+
+        for (const auto& anchor : sym.smuflAnchors) {
+            size_t index = static_cast<size_t>(anchor.first);
+            cached.anchorMask |= (1u << index);
+            cached.anchors[index][0] = anchor.second.x();
+            cached.anchors[index][1] = anchor.second.y();
+        }
+
+        IF_ASSERT_FAILED(sym.subSymbolIds.size() <= MAX_CACHED_SUB_SYMBOLS) {
+            return;
+        }
+
+        cached.subSymbolCount = static_cast<uint32_t>(sym.subSymbolIds.size());
+        for (size_t i = 0; i < sym.subSymbolIds.size(); ++i) {
+            cached.subSymbolIds[i] = static_cast<uint32_t>(sym.subSymbolIds[i]);
+        }
+    }
+
+    QSaveFile file(dirPath + "/" + m_name.toLower() + METRICS_CACHE_FILE_SUFFIX);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGW() << "failed to write font metrics cache: " << file.fileName();
+        return;
+    }
+
+    CacheHeader header = makeCacheHeader(CacheKind::Metrics, sizeof(CachedSym), m_symbols.size(), hash);
+    header.engravingDefaultsCount = static_cast<uint32_t>(defaults.size());
+    header.textEnclosureThickness = m_textEnclosureThickness;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(symbols.data()), symbols.size() * sizeof(CachedSym));
+    file.write(reinterpret_cast<const char*>(defaults.data()), defaults.size() * sizeof(CachedEngravingDefault));
+
+    file.commit();
+}
+
 // =============================================
 // Available ScoreFonts
 // =============================================
@@ -234,6 +562,12 @@ void ScoreFont::load()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    QByteArray hash = metricsCacheDirPath().isEmpty() ? QByteArray() : metricsHash();
+    if (!hash.isEmpty() && loadMetricsCache(hash)) {
+        m_loaded = true;
+        return;
+    }
+
     for (size_t id = 0; id < s_symIdCodes.size(); ++id) {
         uint code = s_symIdCodes[id];
         if (code == 0) {
@@ -262,6 +596,10 @@ void ScoreFont::load()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
+    if (!hash.isEmpty()) {
+        writeMetricsCache(hash);
+    }
+
     m_loaded = true;
 }
 
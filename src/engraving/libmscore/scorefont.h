@@ -28,6 +28,7 @@
 
 #include "modularity/ioc.h"
 #include "infrastructure/draw/ifontprovider.h"
+#include "iglobalconfiguration.h"
 
 namespace mu::draw {
 class Painter;
@@ -37,6 +38,7 @@ namespace Ms {
 class ScoreFont
 {
     INJECT_STATIC(score, mu::draw::IFontProvider, fontProvider)
+    INJECT_STATIC(score, mu::framework::IGlobalConfiguration, globalConfiguration)
 
 public:
     ScoreFont(const char* name, const char* family, const char* path, const char* filename);
@@ -100,9 +102,16 @@ private:
         }
     };
 
-    static QJsonObject initGlyphNamesJson();
+    static QJsonObject initGlyphNamesJson(const QByteArray& data);
+
+    static QString metricsCacheDirPath();
+    static bool loadSymIdCodesCache(const QByteArray& hash);
+    static void writeSymIdCodesCache(const QByteArray& hash);
 
     void load();
+    QByteArray metricsHash() const;
+    bool loadMetricsCache(const QByteArray& hash);
+    void writeMetricsCache(const QByteArray& hash) const;
     void loadGlyphsWithAnchors(const QJsonObject& glyphsWithAnchors);
     void loadComposedGlyphs();
     void loadStylisticAlternates(const QJsonObject& glyphsWithAlternatesObject);
@@ -126,6 +135,7 @@ private:
 
     static std::vector<ScoreFont> s_scoreFonts;
     static std::array<uint, size_t(SymId::lastSym) + 1> s_symIdCodes;
+    static QByteArray s_glyphNamesHash;
 };
 }
 
@@ -25,6 +25,8 @@
  Implementation of class Selection plus other selection related functions.
 */
 
+#include <algorithm>
+
 #include <QBuffer>
 
 #include "rw/xml.h"
@@ -467,59 +469,53 @@ void Selection::add(EngravingItem* el)
     update();
 }
 
-void Selection::appendFiltered(EngravingItem* e)
+void Selection::appendFiltered(QList<EngravingItem*>& list, EngravingItem* e)
 {
-    IF_ASSERT_FAILED(!isLocked()) {
-        LOGE() << "selection locked, reason: " << lockReason();
-        return;
-    }
     if (selectionFilter().canSelect(e)) {
-        _el.append(e);
+        list.append(e);
     }
 }
 
-void Selection::appendChord(Chord* chord)
+void Selection::appendChord(QList<EngravingItem*>& list, Chord* chord, QSet<Beam*>& beams)
 {
-    IF_ASSERT_FAILED(!isLocked()) {
-        LOGE() << "selection locked, reason: " << lockReason();
-        return;
-    }
-    if (chord->beam() && !_el.contains(chord->beam())) {
-        _el.append(chord->beam());
+    if (chord->beam() && !beams.contains(chord->beam())) {
+        beams.insert(chord->beam());
+        list.append(chord->beam());
     }
     if (chord->stem()) {
-        _el.append(chord->stem());
+        list.append(chord->stem());
     }
     if (chord->hook()) {
-        _el.append(chord->hook());
+        list.append(chord->hook());
     }
     if (chord->arpeggio()) {
-        appendFiltered(chord->arpeggio());
+        appendFiltered(list, chord->arpeggio());
     }
     if (chord->stemSlash()) {
-        _el.append(chord->stemSlash());
+        list.append(chord->stemSlash());
     }
     if (chord->tremolo()) {
-        appendFiltered(chord->tremolo());
+        appendFiltered(list, chord->tremolo());
     }
+    const Fraction etick = tickEnd();
     for (Note* note : chord->notes()) {
-        _el.append(note);
+        list.append(note);
         if (note->accidental()) {
-            _el.append(note->accidental());
+            list.append(note->accidental());
         }
-        foreach (EngravingItem* el, note->el()) {
-            appendFiltered(el);
+        for (EngravingItem* el : note->el()) {
+            appendFiltered(list, el);
         }
         for (NoteDot* dot : note->dots()) {
-            _el.append(dot);
+            list.append(dot);
         }
 
         if (note->tieFor() && (note->tieFor()->endElement() != 0)) {
             if (note->tieFor()->endElement()->isNote()) {
                 Note* endNote = toNote(note->tieFor()->endElement());
                 Segment* s = endNote->chord()->segment();
-                if (s->tick() < tickEnd()) {
-                    _el.append(note->tieFor());
+                if (s->tick() < etick) {
+                    list.append(note->tieFor());
                 }
             }
         }
@@ -527,8 +523,8 @@ void Selection::appendChord(Chord* chord)
             if (sp->endElement()->isNote()) {
                 Note* endNote = toNote(sp->endElement());
                 Segment* s = endNote->chord()->segment();
-                if (s->tick() < tickEnd()) {
-                    _el.append(sp);
+                if (s->tick() < etick) {
+                    list.append(sp);
                 }
             }
         }
@@ -586,29 +582,41 @@ void Selection::updateSelectedElements()
     int startTrack = _staffStart * VOICES;
     int endTrack   = _staffEnd * VOICES;
 
+    // Walk the segments once for all tracks, collecting the elements
+    // per track so that the resulting list keeps its track-major order.
+    const int ntracks = qMax(endTrack - startTrack, 0);
+    std::vector<bool> selectableTrack(ntracks);
     for (int st = startTrack; st < endTrack; ++st) {
-        if (!canSelectVoice(st)) {
+        selectableTrack[st - startTrack] = canSelectVoice(st);
+    }
+    std::vector<QList<EngravingItem*> > trackElements(ntracks);
+    QSet<Beam*> beams;
+
+    for (Segment* s = _startSegment; ntracks && s && (s != _endSegment); s = s->next1MM()) {
+        if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
             continue;
         }
-        for (Segment* s = _startSegment; s && (s != _endSegment); s = s->next1MM()) {
-            if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
+        for (EngravingItem* e : s->annotations()) {
+            const int st = e->track();
+            if (st < startTrack || st >= endTrack || !selectableTrack[st - startTrack]) {
                 continue;
             }
-            for (EngravingItem* e : s->annotations()) {
-                if (e->track() != st) {
-                    continue;
-                }
-                appendFiltered(e);
+            appendFiltered(trackElements[st - startTrack], e);
+        }
+        for (int st = startTrack; st < endTrack; ++st) {
+            if (!selectableTrack[st - startTrack]) {
+                continue;
             }
             EngravingItem* e = s->element(st);
             if (!e || e->generated() || e->isTimeSig() || e->isKeySig()) {
                 continue;
             }
+            QList<EngravingItem*>& list = trackElements[st - startTrack];
             if (e->isChordRest()) {
                 ChordRest* cr = toChordRest(e);
                 for (EngravingItem* el : cr->lyrics()) {
                     if (el) {
-                        appendFiltered(el);
+                        appendFiltered(list, el);
                     }
                 }
             }
@@ -616,34 +624,46 @@ void Selection::updateSelectedElements()
                 Chord* chord = toChord(e);
                 for (Chord* graceNote : chord->graceNotes()) {
                     if (canSelect(graceNote)) {
-                        appendChord(graceNote);
+                        appendChord(list, graceNote, beams);
                     }
                 }
-                appendChord(chord);
+                appendChord(list, chord, beams);
                 for (Articulation* art : chord->articulations()) {
-                    appendFiltered(art);
+                    appendFiltered(list, art);
                 }
             } else {
-                appendFiltered(e);
+                appendFiltered(list, e);
                 if (e->isRest()) {
                     Rest* r = toRest(e);
                     for (int i = 0; i < r->dots(); ++i) {
-                        appendFiltered(r->dot(i));
+                        appendFiltered(list, r->dot(i));
                     }
                 }
             }
         }
     }
+    for (const QList<EngravingItem*>& list : trackElements) {
+        _el.append(list);
+    }
+
     Fraction stick = startSegment()->tick();
     Fraction etick = tickEnd();
 
-    for (auto i = _score->spanner().begin(); i != _score->spanner().end(); ++i) {
-        Spanner* sp = (*i).second;
+    // every spanner selected below overlaps [stick, etick]
+    std::vector<Spanner*> spanners;
+    for (const auto& interval : _score->spannerMap().findOverlapping(stick.ticks(), etick.ticks())) {
+        spanners.push_back(interval.value);
+    }
+    std::stable_sort(spanners.begin(), spanners.end(), [](const Spanner* sp1, const Spanner* sp2) {
+        return sp1->tick() < sp2->tick();
+    });
+
+    for (Spanner* sp : spanners) {
         // ignore spanners belonging to other tracks
         if (sp->track() < startTrack || sp->track() >= endTrack) {
             continue;
         }
-        if (!canSelectVoice(sp->track())) {
+        if (!selectableTrack[sp->track() - startTrack]) {
             continue;
         }
         // ignore voltas
@@ -657,11 +677,11 @@ void Selection::updateSelectedElements()
             }
             if ((sp->tick() >= stick && sp->tick() < etick) || (sp->tick2() >= stick && sp->tick2() < etick)) {
                 if (canSelect(sp->startCR()) && canSelect(sp->endCR())) {
-                    appendFiltered(sp);               // slur with start or end in range selection
+                    appendFiltered(_el, sp);               // slur with start or end in range selection
                 }
             }
         } else if ((sp->tick() >= stick && sp->tick() < etick) && (sp->tick2() >= stick && sp->tick2() <= etick)) {
-            appendFiltered(sp);       // spanner with start and end in range selection
+            appendFiltered(_el, sp);       // spanner with start and end in range selection
         }
     }
     update();
@@ -823,13 +843,18 @@ static Fraction firstElementInTrack(Segment* startSeg, Segment* endSeg, int trac
 }
 
 QByteArray Selection::staffMimeData() const
+{
+    return staffMimeData(selectionFilter());
+}
+
+QByteArray Selection::staffMimeData(const SelectionFilter& filter) const
 {
     QBuffer buffer;
     buffer.open(QIODevice::WriteOnly);
     XmlWriter xml(score(), &buffer);
     xml.writeHeader();
     xml.setClipboardmode(true);
-    xml.setFilter(selectionFilter());
+    xml.setFilter(filter);
 
     Fraction ticks  = tickEnd() - tickStart();
     int staves = staffEnd() - staffStart();
@@ -23,6 +23,8 @@
 #ifndef __SELECT_H__
 #define __SELECT_H__
 
+#include <QSet>
+
 #include "pitchspelling.h"
 #include "mscore.h"
 #include "durationtype.h"
@@ -37,6 +39,7 @@ class Segment;
 class Note;
 class Measure;
 class Chord;
+class Beam;
 
 //---------------------------------------------------------
 //   ElementPattern
@@ -174,12 +177,13 @@ class Selection
     QString _lockReason;
 
     QByteArray staffMimeData() const;
+    QByteArray staffMimeData(const SelectionFilter& filter) const;
     QByteArray symbolListMimeData() const;
     SelectionFilter selectionFilter() const;
     bool canSelect(EngravingItem* e) const { return selectionFilter().canSelect(e); }
     bool canSelectVoice(int track) const { return selectionFilter().canSelectVoice(track); }
-    void appendFiltered(EngravingItem* e);
-    void appendChord(Chord* chord);
+    void appendFiltered(QList<EngravingItem*>& list, EngravingItem* e);
+    void appendChord(QList<EngravingItem*>& list, Chord* chord, QSet<Beam*>& beams);
 
 public:
     Selection() { _score = 0; _state = SelState::NONE; }
@@ -23,6 +23,8 @@
 #include "shape.h"
 #include "segment.h"
 
+#include "layout/layoutstatistics.h"
+
 using namespace mu;
 
 namespace Ms {
@@ -99,6 +101,7 @@ Shape Shape::translated(const PointF& pt) const
 
 qreal Shape::minHorizontalDistance(const Shape& a) const
 {
+    mu::engraving::LayoutStatistics::add(mu::engraving::LayoutStatistics::Counter::ShapeDistances);
     qreal dist = -1000000.0;        // min real
     for (const RectF& r2 : a) {
         qreal by1 = r2.top();
@@ -124,6 +127,7 @@ qreal Shape::minHorizontalDistance(const Shape& a) const
 
 qreal Shape::minVerticalDistance(const Shape& a) const
 {
+    mu::engraving::LayoutStatistics::add(mu::engraving::LayoutStatistics::Counter::ShapeDistances);
     qreal dist = -1000000.0;        // min real
     for (const RectF& r2 : a) {
         if (r2.height() <= 0.0) {
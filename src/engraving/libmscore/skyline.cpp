@@ -23,6 +23,8 @@
 #include "skyline.h"
 #include "segment.h"
 
+#include "layout/layoutstatistics.h"
+
 using namespace mu;
 
 namespace Ms {
@@ -43,6 +45,7 @@ static const qreal MINIMUM_Y = -1000000.0;
 
 void Skyline::add(const RectF& r)
 {
+    mu::engraving::LayoutStatistics::add(mu::engraving::LayoutStatistics::Counter::SkylineRects);
     _north.add(r.x(), r.top(), r.width());
     _south.add(r.x(), r.bottom(), r.width());
 }
@@ -218,6 +221,7 @@ void Skyline::clear()
 
 qreal Skyline::minDistance(const Skyline& s) const
 {
+    mu::engraving::LayoutStatistics::add(mu::engraving::LayoutStatistics::Counter::SkylineDistances);
     return south().minDistance(s.north());
 }
 
@@ -139,6 +139,106 @@ void updateNoteLines(Segment* segment, int track)
     }
 }
 
+//---------------------------------------------------------
+//   UndoCommandPool
+//    Recycles the memory of undo commands. Most commands are
+//    a few dozen bytes and are created and destroyed in large
+//    numbers, so they are kept in free lists by size class.
+//    The free lists are per thread and need no locking: memory
+//    freed on another thread than it was allocated on simply
+//    moves to that thread's lists.
+//---------------------------------------------------------
+
+class UndoCommandPool
+{
+public:
+    static constexpr size_t GRANULARITY = 16;
+    static constexpr size_t MAX_POOLED_SIZE = 256;
+
+    static void* allocate(size_t size)
+    {
+        if (size == 0 || size > MAX_POOLED_SIZE || s_destroyed) {
+            return ::operator new(size);
+        }
+        std::vector<void*>& freeList = s_pool.m_freeLists[bucket(size)];
+        if (!freeList.empty()) {
+            void* ptr = freeList.back();
+            freeList.pop_back();
+            return ptr;
+        }
+        return ::operator new((bucket(size) + 1) * GRANULARITY);
+    }
+
+    static void deallocate(void* ptr, size_t size)
+    {
+        if (!ptr) {
+            return;
+        }
+        if (size == 0 || size > MAX_POOLED_SIZE || s_destroyed) {
+            ::operator delete(ptr);
+            return;
+        }
+        std::vector<void*>& freeList = s_pool.m_freeLists[bucket(size)];
+        if (freeList.size() < MAX_FREE_PER_BUCKET) {
+            freeList.push_back(ptr);
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+    ~UndoCommandPool()
+    {
+        // commands deleted after this point, e.g. by other thread_local
+        // or static destructors, go straight to the system allocator
+        s_destroyed = true;
+        for (std::vector<void*>& freeList : m_freeLists) {
+            for (void* ptr : freeList) {
+                ::operator delete(ptr);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t BUCKET_COUNT = MAX_POOLED_SIZE / GRANULARITY;
+    static constexpr size_t MAX_FREE_PER_BUCKET = 4096;
+
+    static size_t bucket(size_t size) { return (size - 1) / GRANULARITY; }
+
+    static thread_local UndoCommandPool s_pool;
+    static thread_local bool s_destroyed;
+
+    std::vector<void*> m_freeLists[BUCKET_COUNT];
+};
+
+thread_local UndoCommandPool UndoCommandPool::s_pool;
+thread_local bool UndoCommandPool::s_destroyed = false;
+
+void* UndoCommand::operator new(size_t size)
+{
+    return UndoCommandPool::allocate(size);
+}
+
+void UndoCommand::operator delete(void* ptr, size_t size)
+{
+    UndoCommandPool::deallocate(ptr, size);
+}
+
+//---------------------------------------------------------
+//   elementMemoryUsage
+//    approximate footprint of an element and its children,
+//    counting the size of the EngravingItem base for each
+//---------------------------------------------------------
+
+static size_t elementMemoryUsage(EngravingItem* element)
+{
+    if (!element) {
+        return 0;
+    }
+    size_t count = 0;
+    element->scanElements(&count, [](void* data, EngravingItem*) { ++*static_cast<size_t*>(data); }, true);
+    return qMax(count, size_t(1)) * sizeof(EngravingItem);
+}
+
 //---------------------------------------------------------
 //   UndoCommand
 //---------------------------------------------------------
@@ -254,6 +354,34 @@ void UndoCommand::filterChildren(UndoCommand::Filter f, EngravingItem* target)
     childList = std::move(acceptedList);
 }
 
+//---------------------------------------------------------
+//   memoryUsage
+//    this command and all its children
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    size_t usage = selfMemoryUsage() + size_t(childList.size()) * sizeof(UndoCommand*);
+    for (const UndoCommand* cmd : childList) {
+        usage += cmd->memoryUsage();
+    }
+    return usage;
+}
+
+//---------------------------------------------------------
+//   commandCount
+//    this command and all its children
+//---------------------------------------------------------
+
+size_t UndoCommand::commandCount() const
+{
+    size_t count = 1;
+    for (const UndoCommand* cmd : childList) {
+        count += cmd->commandCount();
+    }
+    return count;
+}
+
 //---------------------------------------------------------
 //   unwind
 //---------------------------------------------------------
@@ -272,6 +400,10 @@ void UndoCommand::unwind()
 //   UndoStack
 //---------------------------------------------------------
 
+// memory used and commands held by the undo stacks of all open scores
+static size_t s_totalUndoMemoryUsage = 0;
+static size_t s_totalUndoCommandCount = 0;
+
 UndoStack::UndoStack()
 {
     curCmd   = 0;
@@ -279,6 +411,11 @@ UndoStack::UndoStack()
     cleanState = 0;
     stateList.push_back(cleanState);
     nextState = 1;
+
+    if (auto configuration = engravingConfiguration()) {
+        setLimits(configuration->undoStackMemoryLimit(), configuration->undoStackCommandLimit(),
+                  configuration->undoStackDepthLimit());
+    }
 }
 
 //---------------------------------------------------------
@@ -292,6 +429,130 @@ UndoStack::~UndoStack()
         c->cleanup(idx++ < curIdx);
     }
     qDeleteAll(list);
+    s_totalUndoMemoryUsage -= m_memoryUsage;
+    s_totalUndoCommandCount -= m_commandCount;
+}
+
+//---------------------------------------------------------
+//   setLimits
+//    Oldest macros are dropped once the stack holds more
+//    than maxDepth macros, more than maxCommandCount commands
+//    or uses more than maxMemoryUsage bytes; 0 disables a
+//    limit. The last macro is kept.
+//---------------------------------------------------------
+
+void UndoStack::setLimits(size_t maxMemoryUsage, size_t maxCommandCount, int maxDepth)
+{
+    m_maxMemoryUsage = maxMemoryUsage;
+    m_maxCommandCount = maxCommandCount;
+    m_maxDepth = maxDepth;
+    if (!curCmd) {
+        evict();
+    }
+}
+
+//---------------------------------------------------------
+//   totalMemoryUsage
+//---------------------------------------------------------
+
+size_t UndoStack::totalMemoryUsage()
+{
+    return s_totalUndoMemoryUsage;
+}
+
+//---------------------------------------------------------
+//   totalCommandCount
+//---------------------------------------------------------
+
+size_t UndoStack::totalCommandCount()
+{
+    return s_totalUndoCommandCount;
+}
+
+//---------------------------------------------------------
+//   addUsage
+//---------------------------------------------------------
+
+void UndoStack::addUsage(const UndoMacro* macro)
+{
+    m_memoryUsage += macro->cachedMemoryUsage();
+    m_commandCount += macro->cachedCommandCount();
+    s_totalUndoMemoryUsage += macro->cachedMemoryUsage();
+    s_totalUndoCommandCount += macro->cachedCommandCount();
+}
+
+//---------------------------------------------------------
+//   removeUsage
+//---------------------------------------------------------
+
+void UndoStack::removeUsage(const UndoMacro* macro)
+{
+    m_memoryUsage -= macro->cachedMemoryUsage();
+    m_commandCount -= macro->cachedCommandCount();
+    s_totalUndoMemoryUsage -= macro->cachedMemoryUsage();
+    s_totalUndoCommandCount -= macro->cachedCommandCount();
+}
+
+//---------------------------------------------------------
+//   deleteMacro
+//    macro must already be taken out of the list
+//---------------------------------------------------------
+
+void UndoStack::deleteMacro(UndoMacro* macro, bool undo)
+{
+    removeUsage(macro);
+    macro->cleanup(undo);      // delete elements for which UndoCommand() holds ownership
+    delete macro;
+}
+
+//---------------------------------------------------------
+//   evict
+//    drop the oldest macros while over the limits
+//---------------------------------------------------------
+
+void UndoStack::evict()
+{
+    auto overLimit = [this]() {
+        return (m_maxDepth > 0 && list.size() > m_maxDepth)
+               || (m_maxCommandCount > 0 && m_commandCount > m_maxCommandCount)
+               || (m_maxMemoryUsage > 0 && m_memoryUsage > m_maxMemoryUsage);
+    };
+
+    while (curIdx > 1 && overLimit()) {
+        UndoMacro* macro = list.takeFirst();
+        stateList.erase(stateList.begin());
+        --curIdx;
+        ++m_evictedCount;
+        deleteMacro(macro, true);
+    }
+}
+
+//---------------------------------------------------------
+//   coalesce
+//    A property change of the same element and property as
+//    the previous command of the macro only needs to be
+//    executed: the previous command already restores the
+//    original value on undo.
+//---------------------------------------------------------
+
+bool UndoStack::coalesce(UndoCommand* cmd, EditData* ed)
+{
+    if (strcmp(cmd->name(), "ChangeProperty") || curCmd->commands().isEmpty()) {
+        return false;
+    }
+    const UndoCommand* prevCmd = curCmd->commands().last();
+    if (strcmp(prevCmd->name(), "ChangeProperty")) {
+        return false;
+    }
+    const ChangeProperty* cp = static_cast<const ChangeProperty*>(cmd);
+    const ChangeProperty* prevCp = static_cast<const ChangeProperty*>(prevCmd);
+    if (cp->getElement() != prevCp->getElement() || cp->getId() != prevCp->getId()) {
+        return false;
+    }
+
+    cmd->redo(ed);
+    delete cmd;
+    return true;
 }
 
 //---------------------------------------------------------
@@ -331,6 +592,9 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
         LOG_UNDO() << cmd->name();
     }
 #endif
+    if (coalesce(cmd, ed)) {
+        return;
+    }
     curCmd->appendChild(cmd);
     cmd->redo(ed);
 }
@@ -360,17 +624,15 @@ void UndoStack::remove(int idx)
     Q_ASSERT(curIdx >= 0);
     // remove redo stack
     while (list.size() > curIdx) {
-        UndoCommand* cmd = list.takeLast();
+        UndoMacro* cmd = list.takeLast();
         stateList.pop_back();
-        cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
-        delete cmd;
+        deleteMacro(cmd, false);
 //            --curIdx;
     }
     while (list.size() > idx) {
-        UndoCommand* cmd = list.takeLast();
+        UndoMacro* cmd = list.takeLast();
         stateList.pop_back();
-        cmd->cleanup(true);
-        delete cmd;
+        deleteMacro(cmd, true);
     }
     curIdx = idx;
 }
@@ -381,6 +643,14 @@ void UndoStack::remove(int idx)
 
 void UndoStack::mergeCommands(int startIdx)
 {
+    // startIdx comes from getCurIdx(), which counts evicted macros
+    startIdx -= m_evictedCount;
+    if (startIdx < 0) {
+        // the first macro to merge has been dropped, merging the
+        // rest into the oldest remaining macro would join unrelated edits
+        LOGW() << "undo commands to merge are no longer on the stack";
+        return;
+    }
     Q_ASSERT(startIdx <= curIdx);
 
     if (startIdx >= list.size()) {
@@ -393,6 +663,10 @@ void UndoStack::mergeCommands(int startIdx)
         startMacro->append(std::move(*list[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+
+    removeUsage(startMacro);
+    startMacro->updateUsage();
+    addUsage(startMacro);
 }
 
 //---------------------------------------------------------
@@ -440,16 +714,20 @@ void UndoStack::endMacro(bool rollback)
     } else {
         // remove redo stack
         while (list.size() > curIdx) {
-            UndoCommand* cmd = list.takeLast();
+            UndoMacro* cmd = list.takeLast();
             stateList.pop_back();
-            cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
-            delete cmd;
+            deleteMacro(cmd, false);
         }
+        curCmd->updateUsage();
+        addUsage(curCmd);
         list.append(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
     }
     curCmd = 0;
+    if (!rollback) {
+        evict();
+    }
 }
 
 //---------------------------------------------------------
@@ -464,6 +742,7 @@ void UndoStack::reopen()
     --curIdx;
     curCmd = list.takeAt(curIdx);
     stateList.erase(stateList.begin() + curIdx);
+    removeUsage(curCmd);
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
     }
@@ -488,7 +767,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = static_cast<TextEditData*>(ed->getData(ed->element));
-        if (ted && ted->startUndoIdx == curIdx) {
+        if (ted && ted->startUndoIdx == getCurIdx()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -982,6 +1261,16 @@ void RemoveElement::redo(EditData*)
     }
 }
 
+//---------------------------------------------------------
+//   selfMemoryUsage
+//    the removed element is owned by the command
+//---------------------------------------------------------
+
+size_t RemoveElement::selfMemoryUsage() const
+{
+    return sizeof(*this) + elementMemoryUsage(element);
+}
+
 //---------------------------------------------------------
 //   name
 //---------------------------------------------------------
@@ -1943,6 +2232,23 @@ void ChangeMStaffProperties::flip(EditData*)
     stemless = s;
 }
 
+//---------------------------------------------------------
+//   measuresMemoryUsage
+//    footprint of the measures from fm to lm
+//---------------------------------------------------------
+
+size_t InsertRemoveMeasures::measuresMemoryUsage() const
+{
+    size_t usage = 0;
+    for (MeasureBase* mb = fm; mb; mb = mb->next()) {
+        usage += elementMemoryUsage(mb);
+        if (mb == lm) {
+            break;
+        }
+    }
+    return usage;
+}
+
 //---------------------------------------------------------
 //   getCourtesyClefs
 //    remember clefs at the end of previous measure
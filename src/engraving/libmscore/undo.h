@@ -30,6 +30,8 @@
 
 #include "style/style.h"
 #include "compat/midi/midipatch.h"
+#include "modularity/ioc.h"
+#include "iengravingconfiguration.h"
 
 #include "mscore.h"
 #include "sig.h"
@@ -91,7 +93,9 @@ enum class PlayEventType : char;
 class Excerpt;
 class EditData;
 
-#define UNDO_NAME(a) const char* name() const override { return a; }
+#define UNDO_NAME(a) \
+    const char* name() const override { return a; } \
+    size_t selfMemoryUsage() const override { return sizeof(*this); }
 
 //---------------------------------------------------------
 //   UndoCommand
@@ -133,6 +137,16 @@ public:
     bool hasFilteredChildren(Filter, const EngravingItem* target) const;
     bool hasUnfilteredChildren(const std::vector<Filter>& filters, const EngravingItem* target) const;
     void filterChildren(UndoCommand::Filter f, EngravingItem* target);
+
+    // approximate heap footprint of this command, including the
+    // elements it owns, and of its children
+    virtual size_t selfMemoryUsage() const { return sizeof(UndoCommand); }
+    size_t memoryUsage() const;
+    size_t commandCount() const;
+
+    // commands are allocated from a pool, see UndoCommandPool
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size);
 };
 
 //---------------------------------------------------------
@@ -167,9 +181,15 @@ public:
 
     static bool canRecordSelectedElement(const EngravingItem* e);
 
+    size_t cachedMemoryUsage() const { return m_memoryUsage; }
+    size_t cachedCommandCount() const { return m_commandCount; }
+    void updateUsage() { m_memoryUsage = memoryUsage(); m_commandCount = commandCount(); }
+
     UNDO_NAME("UndoMacro");
 
 private:
+    size_t m_memoryUsage = 0;
+    size_t m_commandCount = 0;
     InputState m_undoInputState;
     InputState m_redoInputState;
     SelectionInfo m_undoSelectionInfo;
@@ -187,6 +207,8 @@ private:
 
 class UndoStack
 {
+    INJECT_STATIC(engraving, mu::engraving::IEngravingConfiguration, engravingConfiguration)
+
     UndoMacro* curCmd;
     QList<UndoMacro*> list;
     std::vector<int> stateList;
@@ -194,12 +216,31 @@ class UndoStack
     int cleanState;
     int curIdx;
 
+    size_t m_memoryUsage = 0;
+    size_t m_commandCount = 0;
+    size_t m_maxMemoryUsage = 0;    // 0: no limit
+    size_t m_maxCommandCount = 0;   // 0: no limit
+    int m_maxDepth = 0;             // 0: no limit
+    int m_evictedCount = 0;         // macros dropped from the bottom of the stack
+
     void remove(int idx);
+    void addUsage(const UndoMacro* macro);
+    void removeUsage(const UndoMacro* macro);
+    void deleteMacro(UndoMacro* macro, bool undo);
+    void evict();
+    bool coalesce(UndoCommand* cmd, EditData* ed);
 
 public:
     UndoStack();
     ~UndoStack();
 
+    void setLimits(size_t maxMemoryUsage, size_t maxCommandCount, int maxDepth);
+    size_t memoryUsage() const { return m_memoryUsage; }
+    size_t commandCount() const { return m_commandCount; }
+    int count() const { return list.size(); }
+    static size_t totalMemoryUsage();
+    static size_t totalCommandCount();
+
     bool active() const { return curCmd != 0; }
     void beginMacro(Score*);
     void endMacro(bool rollback);
@@ -211,11 +252,12 @@ public:
     bool canRedo() const { return curIdx < list.size(); }
     int state() const { return stateList[curIdx]; }
     bool isClean() const { return cleanState == state(); }
-    int getCurIdx() const { return curIdx; }
+    int getCurIdx() const { return curIdx + m_evictedCount; }
     bool empty() const { return !canUndo() && !canRedo(); }
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
     UndoMacro* prev() const { return curIdx > 1 ? list[curIdx - 2] : 0; }
+    UndoMacro* next() const { return canRedo() ? list[curIdx] : 0; }
     void undo(EditData*);
     void redo(EditData*);
     void rollback();
@@ -609,6 +651,7 @@ public:
     EngravingItem* getElement() const { return element; }
     virtual void cleanup(bool) override;
     virtual const char* name() const override;
+    size_t selfMemoryUsage() const override { return sizeof(*this); }
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 };
@@ -627,6 +670,8 @@ public:
     virtual void redo(EditData*) override;
     virtual void cleanup(bool) override;
     virtual const char* name() const override;
+    size_t selfMemoryUsage() const override;
+    EngravingItem* getElement() const { return element; }
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 };
@@ -867,6 +912,7 @@ public:
         : fm(_fm), lm(_lm) {}
     virtual void undo(EditData*) override = 0;
     virtual void redo(EditData*) override = 0;
+    size_t measuresMemoryUsage() const;
 };
 
 //---------------------------------------------------------
@@ -880,7 +926,8 @@ public:
         : InsertRemoveMeasures(m1, m2) {}
     virtual void undo(EditData*) override { insertMeasures(); }
     virtual void redo(EditData*) override { removeMeasures(); }
-    UNDO_NAME("RemoveMeasures")
+    const char* name() const override { return "RemoveMeasures"; }
+    size_t selfMemoryUsage() const override { return sizeof(*this) + measuresMemoryUsage(); }
 };
 
 //---------------------------------------------------------
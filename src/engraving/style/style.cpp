@@ -57,6 +57,12 @@ Millimetre MStyle::valueMM(Sid idx) const
 void MStyle::set(const Sid t, const PropertyValue& val)
 {
     const size_t idx = size_t(t);
+    if (m_values[idx] != val) {
+        //! NOTE Unique across the styles, a copy keeps the revision only until one of them changes
+        static int lastRevision = 0;
+        m_revision = ++lastRevision;
+    }
+
     m_values[idx] = val;
     if (t == Sid::spatium) {
         precomputeValues();
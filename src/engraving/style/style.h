@@ -69,6 +69,9 @@ public:
 
     void set(Sid idx, const mu::engraving::PropertyValue& v);
 
+    //! NOTE Changes whenever a value changes, so that what was drawn with the style can be invalidated
+    int revision() const { return m_revision; }
+
     bool isDefault(Sid idx) const;
     void setDefaultStyleVersion(const int defaultsVersion);
     int defaultStyleVersion() const;
@@ -96,6 +99,7 @@ private:
 
     std::array<mu::engraving::PropertyValue, size_t(Sid::STYLES)> m_values;
     std::array<Millimetre, size_t(Sid::STYLES)> m_precomputedValues;
+    int m_revision = 0;
 };
 }     // namespace Ms
 
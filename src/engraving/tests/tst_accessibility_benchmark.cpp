@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <QElapsedTimer>
+
+#include "testing/qtestsuite.h"
+#include "testbase.h"
+
+#include "accessibility/accessibleitem.h"
+#include "libmscore/masterscore.h"
+
+#include "framework/accessibility/internal/accessibilitycontroller.h"
+
+static const QString ACCESSIBILITY_DATA_DIR("concertpitch_data/");
+
+using namespace Ms;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   BenchAccessibility
+//    loading a large orchestral score with the accessible
+//    objects of all its elements created and registered
+//    with the accessibility controller right away (eager),
+//    and with only the roots created (on demand)
+//---------------------------------------------------------
+
+class BenchAccessibility : public QObject, public MTest
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void load_data();
+    void load();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//    the elements register with the same controller
+//    as in the application
+//---------------------------------------------------------
+
+void BenchAccessibility::initTestCase()
+{
+    initMTest();
+
+    using namespace mu::accessibility;
+    if (!mu::modularity::ioc()->resolve<IAccessibilityController>("engraving")) {
+        mu::modularity::ioc()->registerExport<IAccessibilityController>("engraving", std::make_shared<AccessibilityController>());
+    }
+    QVERIFY(AccessibleItem::accessibilityController());
+}
+
+void BenchAccessibility::cleanupTestCase()
+{
+    AccessibleItem::createOnDemand = true;
+}
+
+//---------------------------------------------------------
+//   load
+//---------------------------------------------------------
+
+void BenchAccessibility::load_data()
+{
+    QTest::addColumn<bool>("onDemand");
+
+    QTest::newRow("eager") << false;
+    QTest::newRow("on demand") << true;
+}
+
+void BenchAccessibility::load()
+{
+    QFETCH(bool, onDemand);
+    AccessibleItem::createOnDemand = onDemand;
+
+    MasterScore* score = nullptr;
+    QBENCHMARK_ONCE {
+        score = readScore(ACCESSIBILITY_DATA_DIR + "concertpitchbenchmark.mscx");
+    }
+    QVERIFY(score);
+
+    size_t accessibleElements = 0;
+    score->scanElements(&accessibleElements, [](void* data, EngravingItem* e) {
+        if (e->accessibleEnabled()) {
+            ++*static_cast<size_t*>(data);
+        }
+    });
+
+    //! NOTE Closing the score unregisters the accessible objects as well
+    QElapsedTimer timer;
+    timer.start();
+    delete score;
+
+    qInfo() << QTest::currentDataTag() << "accessible elements:" << accessibleElements
+            << "cached accessible objects:" << AccessibleItem::cachedCount()
+            << "close:" << timer.elapsed() << "ms";
+}
+
+QTEST_MAIN(BenchAccessibility)
+#include "tst_accessibility_benchmark.moc"
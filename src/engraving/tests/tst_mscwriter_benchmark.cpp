@@ -0,0 +1,156 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <QBuffer>
+#include <QFile>
+
+#include "testing/qtestsuite.h"
+#include "testbase.h"
+#include "infrastructure/io/mscwriter.h"
+
+#include "thirdparty/qzip/qzipwriter_p.h"
+
+static const QString MSCWRITER_DATA_DIR("concertpitch_data/");
+static const int EXCERPT_COUNT = 8;
+
+using namespace Ms;
+using namespace mu::engraving;
+
+Q_DECLARE_METATYPE(mu::engraving::MscWriter::Compression)
+
+//---------------------------------------------------------
+//   BenchMscWriter
+//    writing a large orchestral score with its parts
+//    to an MSCZ container, with each compression preset.
+//    The serial row deflates the same entries one after
+//    the other on the calling thread, as MQZipWriter does
+//---------------------------------------------------------
+
+class BenchMscWriter : public QObject, public MTest
+{
+    Q_OBJECT
+
+    QByteArray m_scoreData;
+
+    QByteArray writeMscz(MscWriter::Compression compression) const;
+    QByteArray writeSerial() const;
+
+private slots:
+    void initTestCase();
+    void write_data();
+    void write();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//---------------------------------------------------------
+
+void BenchMscWriter::initTestCase()
+{
+    initMTest();
+    QFile file(root + "/" + MSCWRITER_DATA_DIR + "concertpitchbenchmark.mscx");
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    m_scoreData = file.readAll();
+    QVERIFY(!m_scoreData.isEmpty());
+}
+
+//---------------------------------------------------------
+//   writeMscz
+//    the score and one copy of it per part, roughly
+//    what saving a score with generated parts produces
+//---------------------------------------------------------
+
+QByteArray BenchMscWriter::writeMscz(MscWriter::Compression compression) const
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+
+    MscWriter::Params params;
+    params.device = &buffer;
+    params.filePath = "benchmark.mscz";
+    params.mode = MscIoMode::Zip;
+    params.compression = compression;
+
+    MscWriter writer(params);
+    writer.open();
+    writer.writeScoreFile(m_scoreData);
+    for (int i = 0; i < EXCERPT_COUNT; ++i) {
+        writer.addExcerptFile(QString("Part %1").arg(i), m_scoreData);
+    }
+    writer.close();
+
+    return data;
+}
+
+//---------------------------------------------------------
+//   writeSerial
+//---------------------------------------------------------
+
+QByteArray BenchMscWriter::writeSerial() const
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+
+    MQZipWriter zip(&buffer);
+    zip.addFile("benchmark.mscx", m_scoreData);
+    for (int i = 0; i < EXCERPT_COUNT; ++i) {
+        zip.addFile(QString("Excerpts/Part %1/Part %1.mscx").arg(i), m_scoreData);
+    }
+    zip.close();
+
+    return data;
+}
+
+//---------------------------------------------------------
+//   write
+//---------------------------------------------------------
+
+void BenchMscWriter::write_data()
+{
+    QTest::addColumn<bool>("serial");
+    QTest::addColumn<MscWriter::Compression>("compression");
+
+    QTest::newRow("serial") << true << MscWriter::Compression::Default;
+    QTest::newRow("default") << false << MscWriter::Compression::Default;
+    QTest::newRow("fast") << false << MscWriter::Compression::Fast;
+    QTest::newRow("small") << false << MscWriter::Compression::Small;
+    QTest::newRow("store") << false << MscWriter::Compression::Store;
+}
+
+void BenchMscWriter::write()
+{
+    QFETCH(bool, serial);
+    QFETCH(MscWriter::Compression, compression);
+
+    QByteArray data;
+    QBENCHMARK {
+        data = serial ? writeSerial() : writeMscz(compression);
+    }
+
+    QVERIFY(!data.isEmpty());
+    qInfo() << QTest::currentDataTag() << "file size:" << data.size()
+            << "uncompressed:" << m_scoreData.size() * (EXCERPT_COUNT + 1);
+}
+
+QTEST_MAIN(BenchMscWriter)
+#include "tst_mscwriter_benchmark.moc"
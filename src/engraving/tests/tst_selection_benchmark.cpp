@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "testing/qtestsuite.h"
+#include "testbase.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/select.h"
+
+static const QString SELECTION_DATA_DIR("concertpitch_data/");
+
+using namespace Ms;
+
+//---------------------------------------------------------
+//   BenchSelection
+//    range selection of a large orchestral score
+//---------------------------------------------------------
+
+class BenchSelection : public QObject, public MTest
+{
+    Q_OBJECT
+
+    MasterScore* m_score = nullptr;
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void selectAll();
+    void updateSelectedElements();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//---------------------------------------------------------
+
+void BenchSelection::initTestCase()
+{
+    initMTest();
+    m_score = readScore(SELECTION_DATA_DIR + "concertpitchbenchmark.mscx");
+    QVERIFY(m_score);
+    m_score->doLayout();
+}
+
+void BenchSelection::cleanupTestCase()
+{
+    delete m_score;
+    m_score = nullptr;
+}
+
+//---------------------------------------------------------
+//   selectAll
+//    what Select All does, including the range setup
+//---------------------------------------------------------
+
+void BenchSelection::selectAll()
+{
+    QBENCHMARK {
+        m_score->cmdSelectAll();
+    }
+    QVERIFY(m_score->selection().isRange());
+    QVERIFY(!m_score->selection().elements().isEmpty());
+}
+
+//---------------------------------------------------------
+//   updateSelectedElements
+//    refresh of an existing full score range selection,
+//    done after every command while a range is selected
+//---------------------------------------------------------
+
+void BenchSelection::updateSelectedElements()
+{
+    m_score->cmdSelectAll();
+    QBENCHMARK {
+        m_score->selection().updateSelectedElements();
+    }
+    QVERIFY(!m_score->selection().elements().isEmpty());
+}
+
+QTEST_MAIN(BenchSelection)
+#include "tst_selection_benchmark.moc"
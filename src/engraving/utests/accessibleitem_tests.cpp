@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "accessibility/accessibleroot.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/rootitem.h"
+#include "libmscore/segment.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class AccessibleItemTests : public ::testing::Test
+{
+};
+
+static std::vector<EngravingItem*> chordRests(Score* score)
+{
+    std::vector<EngravingItem*> items;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->elist()) {
+            if (e && e->accessibleEnabled()) {
+                items.push_back(e);
+            }
+        }
+    }
+    return items;
+}
+
+//---------------------------------------------------------
+///  cacheIsBounded
+///   walking more elements than the cache holds releases
+///   the least recently used accessible objects, but not
+///   the focused one
+//---------------------------------------------------------
+
+TEST_F(AccessibleItemTests, cacheIsBounded)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    score->appendMeasures(int(AccessibleItem::CACHE_CAPACITY));
+
+    std::vector<EngravingItem*> items = chordRests(score);
+    ASSERT_GT(items.size(), AccessibleItem::CACHE_CAPACITY);
+
+    AccessibleRoot* root = score->rootItem()->accessible()->accessibleRoot();
+    ASSERT_TRUE(root);
+    root->setFocusedElement(items.front()->accessible());
+
+    for (EngravingItem* e : items) {
+        EXPECT_TRUE(e->accessible());
+    }
+
+    EXPECT_LE(AccessibleItem::cachedCount(), AccessibleItem::CACHE_CAPACITY);
+    ASSERT_TRUE(root->focusedElement());
+    EXPECT_EQ(root->focusedElement()->element(), items.front());
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  selectionBeforeActivation
+///   an element selected while no assistive technology is
+///   active gets focused when one becomes active
+//---------------------------------------------------------
+
+TEST_F(AccessibleItemTests, selectionBeforeActivation)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    AccessibleRoot* root = score->rootItem()->accessible()->accessibleRoot();
+    ASSERT_TRUE(root);
+
+    std::vector<EngravingItem*> items = chordRests(score);
+    ASSERT_FALSE(items.empty());
+
+    ASSERT_FALSE(AccessibleItem::accessibilityActive());
+    score->select(items.front(), SelectType::SINGLE, 0);
+    EXPECT_FALSE(root->focusedElement());
+
+    root->accessibilityActiveChanged(true);
+    ASSERT_TRUE(root->focusedElement());
+    EXPECT_EQ(root->focusedElement()->element(), items.front());
+
+    delete score;
+}
@@ -0,0 +1,167 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/note.h"
+#include "libmscore/editjournal.h"
+
+#include "utils/scorerw.h"
+#include "utils/scorecomp.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class EditJournalTests : public ::testing::Test
+{
+public:
+    QString filePath(const QString& name) const { return m_dir.filePath(name); }
+    QString journalPath() const { return filePath("editjournal-test.journal"); }
+
+private:
+    QTemporaryDir m_dir;
+};
+
+static void addNote(MasterScore* score, int pitch)
+{
+    Segment* s = score->firstMeasure()->first(SegmentType::ChordRest);
+    score->startCmd();
+    score->setNoteRest(s, 0, NoteVal(pitch), Fraction(1, 4));
+    score->endCmd();
+}
+
+//---------------------------------------------------------
+///  replay
+///   commands recorded in the journal rebuild the edited
+///   score from the original one
+//---------------------------------------------------------
+
+TEST_F(EditJournalTests, replay)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    EditJournal journal(journalPath());
+    journal.reset();
+    score->setEditJournal(&journal);
+
+    addNote(score, 60);
+    addNote(score, 64);
+    journal.waitForWritten();
+    EXPECT_TRUE(EditJournal::hasEntries(journalPath()));
+
+    score->setEditJournal(nullptr);
+    EXPECT_TRUE(ScoreRW::saveScore(score, filePath("editjournal-edited.mscx")));
+    delete score;
+
+    MasterScore* recovered = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(recovered);
+    EditJournal::ReplayResult result = EditJournal::replay(journalPath(), recovered);
+    EXPECT_EQ(result.replayed, 2);
+    EXPECT_TRUE(result.complete);
+    EXPECT_TRUE(ScoreRW::saveScore(recovered, filePath("editjournal-recovered.mscx")));
+    EXPECT_TRUE(ScoreComp::compareFiles(filePath("editjournal-edited.mscx"), filePath("editjournal-recovered.mscx")));
+    delete recovered;
+
+    journal.reset();
+}
+
+//---------------------------------------------------------
+///  tornEntry
+///   an entry cut by a crash is ignored, the ones before
+///   it are replayed
+//---------------------------------------------------------
+
+TEST_F(EditJournalTests, tornEntry)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    EditJournal journal(journalPath());
+    journal.reset();
+    score->setEditJournal(&journal);
+
+    addNote(score, 60);
+    qint64 firstEntryEnd = journal.size();
+    addNote(score, 64);
+    journal.waitForWritten();
+    score->setEditJournal(nullptr);
+    delete score;
+
+    QFile file(journalPath());
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    file.resize(file.size() - 4);
+    file.close();
+    EXPECT_GT(QFile(journalPath()).size(), firstEntryEnd);
+
+    MasterScore* recovered = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(recovered);
+    EditJournal::ReplayResult result = EditJournal::replay(journalPath(), recovered);
+    EXPECT_EQ(result.replayed, 1);
+    EXPECT_TRUE(result.complete);
+    delete recovered;
+
+    journal.reset();
+    EXPECT_FALSE(EditJournal::hasEntries(journalPath()));
+}
+
+//---------------------------------------------------------
+///  measureProperty
+///   a measure property is not in the staff content of the
+///   range, the replay stops before it and reports that the
+///   recovery is partial
+//---------------------------------------------------------
+
+TEST_F(EditJournalTests, measureProperty)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    EditJournal journal(journalPath());
+    journal.reset();
+    score->setEditJournal(&journal);
+
+    addNote(score, 60);
+    score->startCmd();
+    score->firstMeasure()->undoChangeProperty(Pid::REPEAT_END, true);
+    score->endCmd();
+    addNote(score, 64);
+    journal.waitForWritten();
+    score->setEditJournal(nullptr);
+    delete score;
+
+    MasterScore* recovered = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(recovered);
+    EditJournal::ReplayResult result = EditJournal::replay(journalPath(), recovered);
+    EXPECT_EQ(result.replayed, 1);
+    EXPECT_FALSE(result.complete);
+    EXPECT_FALSE(recovered->firstMeasure()->repeatEnd());
+    delete recovered;
+
+    journal.reset();
+}
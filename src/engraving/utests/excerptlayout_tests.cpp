@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/excerpt.h"
+#include "libmscore/measure.h"
+
+#include "utils/scorerw.h"
+
+static const QString EXCERPTLAYOUT_DATA_DIR("excerptlayout_data/");
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class ExcerptLayoutTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+///  deferredPartLayout
+///   an edit in the full score postpones the layout of the
+///   parts until they are needed
+//---------------------------------------------------------
+
+TEST_F(ExcerptLayoutTests, deferredPartLayout)
+{
+    MasterScore* score = ScoreRW::readScore(EXCERPTLAYOUT_DATA_DIR + "parts.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().isEmpty());
+
+    Score* part = score->excerpts().first()->partScore();
+    ASSERT_TRUE(part);
+    EXPECT_FALSE(part->layoutPending());
+
+    score->startCmd();
+    score->setLayout(Fraction(0, 1), -1);
+    score->endCmd();
+
+    EXPECT_FALSE(score->layoutPending());
+    EXPECT_TRUE(part->layoutPending());
+
+    // consecutive edits are merged into one pending range
+    score->startCmd();
+    score->setLayoutAll();
+    score->endCmd();
+    EXPECT_TRUE(part->layoutPending());
+
+    part->doPendingLayout();
+    EXPECT_FALSE(part->layoutPending());
+    EXPECT_GT(part->npages(), 0);
+
+    // edits in a part are laid out immediately in that part and the full score
+    Score* otherPart = score->excerpts().size() > 1 ? score->excerpts().at(1)->partScore() : nullptr;
+    part->startCmd();
+    part->setLayoutAll();
+    part->endCmd();
+    EXPECT_FALSE(part->layoutPending());
+    EXPECT_FALSE(score->layoutPending());
+    if (otherPart) {
+        EXPECT_TRUE(otherPart->layoutPending());
+    }
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  openPartLayout
+///   a part that is open is laid out with every edit
+//---------------------------------------------------------
+
+TEST_F(ExcerptLayoutTests, openPartLayout)
+{
+    MasterScore* score = ScoreRW::readScore(EXCERPTLAYOUT_DATA_DIR + "parts.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().isEmpty());
+
+    Score* part = score->excerpts().first()->partScore();
+    ASSERT_TRUE(part);
+    part->setLayoutOnDemand(false);
+
+    score->startCmd();
+    score->setLayoutAll();
+    score->endCmd();
+    EXPECT_FALSE(part->layoutPending());
+
+    part->setLayoutOnDemand(true);
+    score->startCmd();
+    score->setLayoutAll();
+    score->endCmd();
+    EXPECT_TRUE(part->layoutPending());
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  pendingLayoutAfterInsertMeasure
+///   a pending range recorded before measures are inserted
+///   still covers the measures it was recorded for
+//---------------------------------------------------------
+
+TEST_F(ExcerptLayoutTests, pendingLayoutAfterInsertMeasure)
+{
+    MasterScore* score = ScoreRW::readScore(EXCERPTLAYOUT_DATA_DIR + "parts.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->excerpts().isEmpty());
+
+    Score* part = score->excerpts().first()->partScore();
+    ASSERT_TRUE(part);
+
+    // only the second measure is pending
+    score->startCmd();
+    score->setLayout(Fraction(1, 1), -1);
+    score->endCmd();
+    ASSERT_TRUE(part->layoutPending());
+
+    score->startCmd();
+    score->insertMeasure(ElementType::MEASURE, score->firstMeasure());
+    score->endCmd();
+
+    part->doPendingLayout();
+    EXPECT_FALSE(part->layoutPending());
+    for (Measure* m = part->firstMeasure(); m; m = m->nextMeasure()) {
+        const Measure* laidOut = m->hasMMRest() ? m->mmRest() : m;
+        EXPECT_TRUE(laidOut->system());
+    }
+
+    delete score;
+}
@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/note.h"
+#include "layout/layoutstatistics.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+using Counter = LayoutStatistics::Counter;
+
+class LayoutStatisticsTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        LayoutStatistics::reset();
+        LayoutStatistics::setEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        LayoutStatistics::setEnabled(false);
+        LayoutStatistics::reset();
+    }
+};
+
+static void addNote(MasterScore* score, int pitch)
+{
+    Segment* s = score->firstMeasure()->first(SegmentType::ChordRest);
+    score->startCmd();
+    score->setNoteRest(s, 0, NoteVal(pitch), Fraction(1, 4));
+    score->endCmd();
+}
+
+//---------------------------------------------------------
+///  commandWork
+///   the work of a command is moved to the last command
+///   when the next command begins
+//---------------------------------------------------------
+
+TEST_F(LayoutStatisticsTests, commandWork)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    LayoutStatistics::reset();
+
+    addNote(score, 60);
+
+    LayoutStatistics::Values current = LayoutStatistics::currentCommand();
+    EXPECT_GT(current.counter(Counter::LayoutRanges), 0u);
+    EXPECT_GT(current.counter(Counter::MeasuresLaidOut), 0u);
+    EXPECT_GT(current.counter(Counter::SystemsCollected), 0u);
+    EXPECT_GT(current.counter(Counter::MeasureWidthComputations), 0u);
+    EXPECT_GT(current.phaseTimesNs[static_cast<size_t>(LayoutStatistics::Phase::Layout)], 0u);
+
+    addNote(score, 64);
+
+    LayoutStatistics::Values last = LayoutStatistics::lastCommand();
+    EXPECT_EQ(last.counter(Counter::LayoutRanges), current.counter(Counter::LayoutRanges));
+    EXPECT_EQ(last.counter(Counter::MeasuresLaidOut), current.counter(Counter::MeasuresLaidOut));
+
+    LayoutStatistics::Values total = LayoutStatistics::total();
+    EXPECT_EQ(total.counter(Counter::LayoutRanges),
+              last.counter(Counter::LayoutRanges) + LayoutStatistics::currentCommand().counter(Counter::LayoutRanges));
+
+    LayoutStatistics::reset();
+    EXPECT_EQ(LayoutStatistics::total().counter(Counter::LayoutRanges), 0u);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  disabled
+///   nothing is counted while the statistics are disabled
+//---------------------------------------------------------
+
+TEST_F(LayoutStatisticsTests, disabled)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+
+    LayoutStatistics::setEnabled(false);
+    LayoutStatistics::reset();
+
+    addNote(score, 60);
+    addNote(score, 64);
+
+    LayoutStatistics::Values total = LayoutStatistics::total();
+    for (size_t i = 0; i < LayoutStatistics::COUNTERS_COUNT; ++i) {
+        EXPECT_EQ(total.counters[i], 0u) << LayoutStatistics::counterName(static_cast<Counter>(i));
+    }
+
+    for (size_t i = 0; i < LayoutStatistics::PHASES_COUNT; ++i) {
+        EXPECT_EQ(total.phaseTimesNs[i], 0u) << LayoutStatistics::phaseName(static_cast<LayoutStatistics::Phase>(i));
+    }
+
+    delete score;
+}
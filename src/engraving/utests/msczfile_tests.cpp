@@ -23,10 +23,14 @@
 
 #include <QByteArray>
 #include <QBuffer>
+#include <QFile>
+#include <QTemporaryDir>
 
 #include "io/mscwriter.h"
 #include "io/mscreader.h"
 
+#include "thirdparty/qzip/qzipreader_p.h"
+
 using namespace mu::engraving;
 
 class MsczFileTests : public ::testing::Test
@@ -85,3 +89,85 @@ TEST_F(MsczFileTests, MsczFile_WriteRead)
         EXPECT_EQ(imageData, originImageData);
     }
 }
+
+TEST_F(MsczFileTests, MsczFile_ReusePreviousEntries)
+{
+    //! CASE Writing over a previous file, unchanged entries are copied from it
+
+    //! GIVEN A previous file with stored (not deflated) entries
+    QTemporaryDir dir;
+    const QString previousPath = dir.filePath("reuse_previous.mscz");
+    const QString newPath = dir.filePath("reuse_new.mscz");
+
+    const QByteArray originImageData = QByteArray("image").repeated(1000);
+    const QByteArray originStyleData = QByteArray("style").repeated(100);
+    const QByteArray originChordListData = QByteArray("chordlist").repeated(100);
+    {
+        MscWriter::Params params;
+        params.filePath = previousPath;
+        params.mode = MscIoMode::Zip;
+        params.compression = MscWriter::Compression::Store;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeStyleFile(originStyleData);
+        writer.writeChordListFile(originChordListData);
+        writer.addImageFile("image1.png", originImageData);
+    }
+
+    //! DO Write the new file with default compression and one changed entry
+    const QByteArray changedChordListData = QByteArray("changed chordlist").repeated(100);
+    {
+        MscWriter::Params params;
+        params.filePath = newPath;
+        params.mode = MscIoMode::Zip;
+        params.previousFilePath = previousPath;
+
+        MscWriter writer(params);
+        writer.open();
+
+        writer.writeStyleFile(originStyleData);
+        writer.writeChordListFile(changedChordListData);
+        writer.addImageFile("image1.png", originImageData);
+    }
+
+    //! CHECK The unchanged entries have the raw bytes of the previous file, still stored;
+    //! a recompressed entry would have been deflated
+    {
+        MQZipReader previous(previousPath);
+        MQZipReader current(newPath);
+
+        for (const QString& name : { QString("score_style.mss"), QString("Pictures/image1.png") }) {
+            bool previousDeflated = true;
+            bool currentDeflated = true;
+            QByteArray previousRaw = previous.rawFileData(name, &previousDeflated);
+            QByteArray currentRaw = current.rawFileData(name, &currentDeflated);
+
+            EXPECT_FALSE(previousRaw.isEmpty()) << name.toStdString();
+            EXPECT_FALSE(previousDeflated) << name.toStdString();
+            EXPECT_FALSE(currentDeflated) << name.toStdString();
+            EXPECT_EQ(currentRaw, previousRaw) << name.toStdString();
+        }
+
+        //! CHECK The changed entry is deflated again
+        bool chordListDeflated = false;
+        QByteArray chordListRaw = current.rawFileData("chordlist.xml", &chordListDeflated);
+        EXPECT_TRUE(chordListDeflated);
+        EXPECT_LT(chordListRaw.size(), changedChordListData.size());
+    }
+
+    //! CHECK Read and compare with origin
+    {
+        MscReader::Params params;
+        params.filePath = newPath;
+        params.mode = MscIoMode::Zip;
+
+        MscReader reader(params);
+        reader.open();
+
+        EXPECT_EQ(reader.readChordListFile(), changedChordListData);
+        EXPECT_EQ(reader.readStyleFile(), originStyleData);
+        EXPECT_EQ(reader.readImageFile("image1.png"), originImageData);
+    }
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "infrastructure/internal/textmetricscache.h"
+
+using namespace mu;
+using namespace mu::draw;
+
+class TextMetricsCacheTests : public ::testing::Test
+{
+};
+
+TEST_F(TextMetricsCacheTests, CachesComputedValues)
+{
+    TextMetricsCache cache;
+    Font font("Edwin");
+    font.setPointSizeF(10.0);
+
+    int computations = 0;
+    auto compute = [&computations]() {
+        ++computations;
+        return 42.0;
+    };
+
+    EXPECT_EQ(cache.horizontalAdvance(font, "lyric", compute), 42.0);
+    EXPECT_EQ(cache.horizontalAdvance(font, "lyric", compute), 42.0);
+    EXPECT_EQ(computations, 1);
+
+    //! NOTE Each metric of an entry is computed on its own
+    RectF rect(0.0, -8.0, 30.0, 10.0);
+    int rectComputations = 0;
+    auto computeRect = [&rect, &rectComputations]() {
+        ++rectComputations;
+        return rect;
+    };
+    EXPECT_EQ(cache.boundingRect(font, "lyric", computeRect), rect);
+    EXPECT_EQ(cache.tightBoundingRect(font, "lyric", computeRect), rect);
+    EXPECT_EQ(cache.boundingRect(font, "lyric", computeRect), rect);
+    EXPECT_EQ(rectComputations, 2);
+
+    EXPECT_EQ(cache.size(), size_t(1));
+}
+
+TEST_F(TextMetricsCacheTests, DistinguishesFonts)
+{
+    TextMetricsCache cache;
+    Font font("Edwin");
+    font.setPointSizeF(10.0);
+
+    Font bold = font;
+    bold.setBold(true);
+
+    Font larger = font;
+    larger.setPointSizeF(12.0);
+
+    EXPECT_EQ(cache.horizontalAdvance(font, "forte", []() { return 1.0; }), 1.0);
+    EXPECT_EQ(cache.horizontalAdvance(bold, "forte", []() { return 2.0; }), 2.0);
+    EXPECT_EQ(cache.horizontalAdvance(larger, "forte", []() { return 3.0; }), 3.0);
+    EXPECT_EQ(cache.size(), size_t(3));
+}
+
+TEST_F(TextMetricsCacheTests, MatchesFontsEqualWithinTolerance)
+{
+    TextMetricsCache cache;
+    Font font("Edwin");
+    font.setPointSizeF(10.0);
+
+    //! NOTE Font compares the point sizes with a tolerance, such fonts must share the entry
+    Font same = font;
+    same.setPointSizeF(10.0 + 1e-12);
+    ASSERT_TRUE(font == same);
+
+    int computations = 0;
+    auto compute = [&computations]() {
+        ++computations;
+        return 1.0;
+    };
+
+    cache.horizontalAdvance(font, "forte", compute);
+    cache.horizontalAdvance(same, "forte", compute);
+    EXPECT_EQ(computations, 1);
+}
+
+TEST_F(TextMetricsCacheTests, EvictsLeastRecentlyUsed)
+{
+    TextMetricsCache cache(2);
+    Font font("Edwin");
+
+    int computations = 0;
+    auto compute = [&computations]() {
+        ++computations;
+        return 1.0;
+    };
+
+    cache.horizontalAdvance(font, "a", compute);
+    cache.horizontalAdvance(font, "b", compute);
+    cache.horizontalAdvance(font, "a", compute); // "a" becomes the most recent
+    cache.horizontalAdvance(font, "c", compute); // evicts "b"
+
+    EXPECT_EQ(cache.size(), size_t(2));
+    EXPECT_EQ(computations, 3);
+
+    cache.horizontalAdvance(font, "a", compute);
+    EXPECT_EQ(computations, 3);
+
+    cache.horizontalAdvance(font, "b", compute);
+    EXPECT_EQ(computations, 4);
+}
+
+TEST_F(TextMetricsCacheTests, CountsHitsAndMisses)
+{
+    //! GIVEN A cache of two entries
+    TextMetricsCache cache(2);
+    Font font("Edwin");
+
+    //! WHEN Metrics are computed, read again, and an entry is evicted
+    cache.horizontalAdvance(font, "a", []() { return 1.0; });
+    cache.horizontalAdvance(font, "a", []() { return 1.0; });
+    cache.boundingRect(font, "a", []() { return RectF(); });
+    cache.horizontalAdvance(font, "b", []() { return 2.0; });
+    cache.horizontalAdvance(font, "c", []() { return 3.0; });
+
+    //! THEN Every computed metric is a miss, every cached one a hit
+    TextMetricsCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, size_t(1));
+    EXPECT_EQ(stats.misses, size_t(4));
+    EXPECT_EQ(stats.size, size_t(2));
+    EXPECT_EQ(stats.capacity, size_t(2));
+
+    //! WHEN The counters are reset
+    cache.resetStats();
+    cache.horizontalAdvance(font, "c", []() { return 3.0; });
+
+    //! THEN Only the new lookups are counted, the entries are kept
+    stats = cache.stats();
+    EXPECT_EQ(stats.hits, size_t(1));
+    EXPECT_EQ(stats.misses, size_t(0));
+    EXPECT_EQ(stats.size, size_t(2));
+}
@@ -0,0 +1,207 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/chordrest.h"
+#include "libmscore/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu::engraving;
+using namespace Ms;
+
+class UndoStackTests : public ::testing::Test
+{
+};
+
+static EngravingItem* firstChordRest(MasterScore* score)
+{
+    return score->firstMeasure()->findChordRest(Fraction(0, 1), 0);
+}
+
+//---------------------------------------------------------
+///  coalesceChangeProperty
+///   successive changes of the same property in one command
+///   are kept as a single undo command
+//---------------------------------------------------------
+
+TEST_F(UndoStackTests, coalesceChangeProperty)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    EngravingItem* cr = firstChordRest(score);
+    ASSERT_TRUE(cr);
+    const PropertyValue original = cr->getProperty(Pid::COLOR);
+
+    score->startCmd();
+    score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(255, 0, 0))));
+    score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(0, 255, 0))));
+    score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(0, 0, 255))));
+    score->endCmd();
+
+    UndoStack* undoStack = score->undoStack();
+    ASSERT_TRUE(undoStack->last());
+    EXPECT_EQ(undoStack->last()->childCount(), 1);
+    EXPECT_EQ(cr->getProperty(Pid::COLOR), PropertyValue(mu::draw::Color(0, 0, 255)));
+
+    EditData ed;
+    undoStack->undo(&ed);
+    EXPECT_EQ(cr->getProperty(Pid::COLOR), original);
+    undoStack->redo(&ed);
+    EXPECT_EQ(cr->getProperty(Pid::COLOR), PropertyValue(mu::draw::Color(0, 0, 255)));
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  depthLimit
+///   the oldest commands are dropped beyond the depth limit
+//---------------------------------------------------------
+
+TEST_F(UndoStackTests, depthLimit)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    EngravingItem* cr = firstChordRest(score);
+    ASSERT_TRUE(cr);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setLimits(0, 0, 2);
+
+    for (int i = 0; i < 4; ++i) {
+        score->startCmd();
+        score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(i * 10, 0, 0))));
+        score->endCmd();
+    }
+
+    EXPECT_EQ(undoStack->count(), 2);
+    EXPECT_EQ(undoStack->getCurIdx(), 4);
+    // each macro holds itself and one ChangeProperty
+    EXPECT_EQ(undoStack->commandCount(), size_t(4));
+    EXPECT_GE(UndoStack::totalCommandCount(), undoStack->commandCount());
+    EXPECT_GT(undoStack->memoryUsage(), size_t(0));
+    EXPECT_GE(UndoStack::totalMemoryUsage(), undoStack->memoryUsage());
+
+    EditData ed;
+    undoStack->undo(&ed);
+    undoStack->undo(&ed);
+    EXPECT_FALSE(undoStack->canUndo());
+    EXPECT_EQ(cr->getProperty(Pid::COLOR), PropertyValue(mu::draw::Color(10, 0, 0)));
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  commandLimit
+///   the oldest commands are dropped beyond the command limit
+//---------------------------------------------------------
+
+TEST_F(UndoStackTests, commandLimit)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    EngravingItem* cr = firstChordRest(score);
+    ASSERT_TRUE(cr);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setLimits(0, 5, 0);
+
+    for (int i = 0; i < 4; ++i) {
+        score->startCmd();
+        score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(i * 10, 0, 0))));
+        score->endCmd();
+    }
+
+    EXPECT_EQ(undoStack->count(), 2);
+    EXPECT_EQ(undoStack->commandCount(), size_t(4));
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  memoryLimit
+///   the oldest commands are dropped beyond the memory limit
+//---------------------------------------------------------
+
+TEST_F(UndoStackTests, memoryLimit)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    EngravingItem* cr = firstChordRest(score);
+    ASSERT_TRUE(cr);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setLimits(0, 0, 0);
+
+    for (int i = 0; i < 4; ++i) {
+        score->startCmd();
+        score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(i * 10, 0, 0))));
+        score->endCmd();
+    }
+    ASSERT_EQ(undoStack->count(), 4);
+
+    // all macros hold the same commands
+    const size_t macroUsage = undoStack->memoryUsage() / 4;
+    EXPECT_GE(macroUsage, sizeof(ChangeProperty));
+
+    undoStack->setLimits(2 * macroUsage, 0, 0);
+    EXPECT_EQ(undoStack->count(), 2);
+    EXPECT_EQ(undoStack->memoryUsage(), 2 * macroUsage);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///  mergeAfterEviction
+///   commands are not merged once the first of them is gone
+//---------------------------------------------------------
+
+TEST_F(UndoStackTests, mergeAfterEviction)
+{
+    MasterScore* score = ScoreRW::readScore("test.mscx");
+    ASSERT_TRUE(score);
+    EngravingItem* cr = firstChordRest(score);
+    ASSERT_TRUE(cr);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setLimits(0, 0, 2);
+
+    const int startIdx = undoStack->getCurIdx();
+    for (int i = 0; i < 4; ++i) {
+        score->startCmd();
+        score->undo(new ChangeProperty(cr, Pid::COLOR, PropertyValue(mu::draw::Color(i * 10, 0, 0))));
+        score->endCmd();
+    }
+    ASSERT_EQ(undoStack->count(), 2);
+
+    undoStack->mergeCommands(startIdx);
+    EXPECT_EQ(undoStack->count(), 2);
+
+    // the commands still on the stack can be merged
+    undoStack->mergeCommands(undoStack->getCurIdx() - 2);
+    EXPECT_EQ(undoStack->count(), 1);
+
+    delete score;
+}
@@ -32,6 +32,7 @@
 #include "internal/audiothread.h"
 #include "internal/audiobuffer.h"
 #include "internal/audiothreadsecurer.h"
+#include "internal/audiorealtime.h"
 
 #include "internal/worker/audioengine.h"
 #include "internal/worker/playback.h"
@@ -83,6 +84,9 @@ static std::shared_ptr<IAudioDriver> s_audioDriver = std::shared_ptr<IAudioDrive
 #ifdef Q_OS_WASM
 #include "internal/platform/web/webaudiodriver.h"
 static std::shared_ptr<IAudioDriver> s_audioDriver = std::shared_ptr<IAudioDriver>(new WebAudioDriver());
+#else
+#include "internal/platform/null/nullaudiodriver.h"
+static std::shared_ptr<NullAudioDriver> s_nullAudioDriver = std::make_shared<NullAudioDriver>();
 #endif
 
 static void audio_init_qrc()
@@ -105,6 +109,9 @@ void AudioModule::registerExports()
     ioc()->registerExport<IAudioConfiguration>(moduleName(), s_audioConfiguration);
     ioc()->registerExport<IAudioThreadSecurer>(moduleName(), std::make_shared<AudioThreadSecurer>());
     ioc()->registerExport<IAudioDriver>(moduleName(), s_audioDriver);
+#ifndef Q_OS_WASM
+    ioc()->registerExport<INullAudioDriver>(moduleName(), s_nullAudioDriver);
+#endif
     ioc()->registerExport<IPlayback>(moduleName(), s_playbackFacade);
 
     ioc()->registerExport<ISynthResolver>(moduleName(), s_synthResolver);
@@ -126,10 +133,28 @@ void AudioModule::registerUiTypes()
 
 void AudioModule::onInit(const framework::IApplication::RunMode& mode)
 {
-    if (mode != framework::IApplication::RunMode::Editor) {
+    bool isNullDriverEnabled = false;
+#ifndef Q_OS_WASM
+    isNullDriverEnabled = s_nullAudioDriver->options().enabled;
+#endif
+
+    //! NOTE With the null driver the audio engine can run headless, e.g. for benchmarks in the converter mode
+    if (mode != framework::IApplication::RunMode::Editor && !isNullDriverEnabled) {
         return;
     }
 
+#ifndef Q_OS_WASM
+    if (isNullDriverEnabled) {
+        s_audioBuffer->setRenderTimeCallback([](std::chrono::nanoseconds renderTime) {
+            s_nullAudioDriver->addRenderTime(renderTime);
+        });
+
+        s_audioDriver = s_nullAudioDriver;
+        ioc()->unregisterExport<IAudioDriver>(moduleName());
+        ioc()->registerExport<IAudioDriver>(moduleName(), s_audioDriver);
+    }
+#endif
+
     /** We have three layers
         ------------------------
         Main (main thread) - public client interface
@@ -163,6 +188,9 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
     // Init configuration
     s_audioConfiguration->init();
 
+    //! NOTE Must be set before the threads are started and the buffers are allocated
+    realtime::setEnabled(s_audioConfiguration->isRealtimeModeEnabled());
+
     s_audioBuffer->init(s_audioConfiguration->audioChannelsCount());
 
     // Setup audio driver
@@ -173,7 +201,7 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
     requiredSpec.samples = s_audioConfiguration->driverBufferSize();
     requiredSpec.callback = [](void* /*userdata*/, uint8_t* stream, int byteCount) {
         auto samplesPerChannel = byteCount / (2 * sizeof(float));
-        s_audioBuffer->pop(reinterpret_cast<float*>(stream), samplesPerChannel);
+        return s_audioBuffer->pop(reinterpret_cast<float*>(stream), samplesPerChannel);
     };
 
     IAudioDriver::Spec activeSpec;
@@ -223,6 +251,7 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
 void AudioModule::onDeinit()
 {
     if (s_audioDriver->isOpened()) {
+        LOGI() << "audio driver xruns: " << s_audioDriver->xrunsCount();
         s_audioDriver->close();
     }
 
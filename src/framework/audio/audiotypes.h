@@ -23,6 +23,8 @@
 #ifndef MU_AUDIO_AUDIOTYPES_H
 #define MU_AUDIO_AUDIOTYPES_H
 
+#include <array>
+#include <atomic>
 #include <variant>
 #include <memory>
 #include <set>
@@ -215,46 +217,83 @@ struct AudioParams {
     AudioOutputParams out;
 };
 
+static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
+
 struct AudioSignalVal {
-    float amplitude = 0.f;
-    volume_dbfs_t pressure = 0.f;
+    float amplitude = 0.f; // linear RMS of the last processed block
+    volume_dbfs_t pressure = MINIMUM_OPERABLE_DBFS_LEVEL; // the same in dBFS
+    float peak = 0.f; // linear sample peak since the last read, held if peak hold is enabled
+    float truePeak = 0.f; // linear inter-sample peak estimate since the last read, if enabled
 };
 
-using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
-
-struct AudioSignalsNotifier {
-    void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
+//! NOTE The latest signal values of the audio channels of a track.
+//! Written by the audio worker after every processed block and polled
+//! by the UI at display rate, so no message is sent per block.
+//! The peaks are the maxima of all blocks since the last read: the worker
+//! only raises them and the reader takes and resets them, so no short peak
+//! between two polls is lost. A meter is meant to have a single reader
+class AudioSignalsMeter
+{
+public:
+    static constexpr audioch_t MAX_CHANNELS = 8;
+
+    AudioSignalVal takeSignalValue(const audioch_t audioChNumber)
     {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
-
-        volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
-
-        if (RealIsEqual(signalVal.amplitude, newAmplitude)
-            && RealIsEqual(signalVal.pressure, validatedPressure)) {
-            return;
+        AudioSignalVal val;
+        if (audioChNumber >= MAX_CHANNELS) {
+            return val;
         }
 
-        if (std::abs(signalVal.amplitude - newAmplitude) < AMPLITUDE_MINIMAL_VALUABLE_DIFF
-            && std::abs(signalVal.pressure - newPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
+        Values& values = m_values[audioChNumber];
+        val.amplitude = values.amplitude.load(std::memory_order_relaxed);
+        val.pressure = values.pressure.load(std::memory_order_relaxed);
+        val.peak = values.peak.exchange(0.f, std::memory_order_relaxed);
+        val.truePeak = values.truePeak.exchange(0.f, std::memory_order_relaxed);
+        return val;
+    }
+
+    void setSignalValue(const audioch_t audioChNumber, const AudioSignalVal& val)
+    {
+        if (audioChNumber >= MAX_CHANNELS) {
             return;
         }
 
-        signalVal.amplitude = newAmplitude;
-        signalVal.pressure = validatedPressure;
-
-        audioSignalChanges.send(audioChNumber, signalVal);
+        Values& values = m_values[audioChNumber];
+        values.amplitude.store(val.amplitude, std::memory_order_relaxed);
+        values.pressure.store(val.pressure, std::memory_order_relaxed);
+        raise(values.peak, val.peak);
+        raise(values.truePeak, val.truePeak);
     }
 
-    AudioSignalChanges audioSignalChanges;
+    bool peakHoldEnabled() const { return m_peakHoldEnabled.load(std::memory_order_relaxed); }
+    void setPeakHoldEnabled(bool enabled) { m_peakHoldEnabled.store(enabled, std::memory_order_relaxed); }
+
+    bool truePeakEnabled() const { return m_truePeakEnabled.load(std::memory_order_relaxed); }
+    void setTruePeakEnabled(bool enabled) { m_truePeakEnabled.store(enabled, std::memory_order_relaxed); }
 
 private:
-    static constexpr float AMPLITUDE_MINIMAL_VALUABLE_DIFF = 0.01f;
-    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 1.f;
-    static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
+    struct Values {
+        std::atomic<float> amplitude { 0.f };
+        std::atomic<volume_dbfs_t> pressure { MINIMUM_OPERABLE_DBFS_LEVEL };
+        std::atomic<float> peak { 0.f };
+        std::atomic<float> truePeak { 0.f };
+    };
+
+    static void raise(std::atomic<float>& maximum, const float value)
+    {
+        float current = maximum.load(std::memory_order_relaxed);
+        while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::array<Values, MAX_CHANNELS> m_values;
 
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
+    std::atomic<bool> m_peakHoldEnabled { false };
+    std::atomic<bool> m_truePeakEnabled { false };
 };
 
+using AudioSignalsMeterPtr = std::shared_ptr<AudioSignalsMeter>;
+
 using PlaybackData = std::variant<midi::MidiData, io::Device*>;
 
 enum class PlaybackStatus {
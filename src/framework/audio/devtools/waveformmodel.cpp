@@ -27,22 +27,61 @@ using namespace mu::audio;
 static const volume_dbfs_t MAX_DISPLAYED_DBFS = 0.f; // 100%
 static const volume_dbfs_t MIN_DISPLAYED_DBFS = -60.f; // 0%
 
+static constexpr int UPDATE_INTERVAL_MS = 33;
+
 WaveFormModel::WaveFormModel(QObject* parent)
     : QObject(parent)
 {
-    playback()->audioOutput()->masterSignalChanges().onResolve(this, [this](AudioSignalChanges signalChanges) {
-        signalChanges.onReceive(this, [this](const audioch_t, const AudioSignalVal& newValue) {
-            setCurrentSignalAmplitude(newValue.amplitude);
-
-            if (newValue.pressure < MIN_DISPLAYED_DBFS) {
-                setCurrentVolumePressure(MIN_DISPLAYED_DBFS);
-            } else if (newValue.pressure > MAX_DISPLAYED_DBFS) {
-                setCurrentVolumePressure(MAX_DISPLAYED_DBFS);
-            } else {
-                setCurrentVolumePressure(newValue.pressure);
-            }
-        });
+    playback()->audioOutput()->masterSignalsMeter().onResolve(this, [this](AudioSignalsMeterPtr meter) {
+        m_meter = std::move(meter);
     });
+
+    m_updateTimer.setInterval(UPDATE_INTERVAL_MS);
+    connect(&m_updateTimer, &QTimer::timeout, this, &WaveFormModel::updateSignalValues);
+}
+
+bool WaveFormModel::metersActive() const
+{
+    return m_updateTimer.isActive();
+}
+
+void WaveFormModel::setMetersActive(bool active)
+{
+    if (metersActive() == active) {
+        return;
+    }
+
+    if (active) {
+        m_updateTimer.start();
+    } else {
+        m_updateTimer.stop();
+    }
+
+    emit metersActiveChanged();
+}
+
+void WaveFormModel::updateSignalValues()
+{
+    if (!m_meter) {
+        return;
+    }
+
+    //! NOTE Show the louder channel
+    AudioSignalVal newValue = m_meter->takeSignalValue(0);
+    const AudioSignalVal rightValue = m_meter->takeSignalValue(1);
+    if (rightValue.amplitude > newValue.amplitude) {
+        newValue = rightValue;
+    }
+
+    setCurrentSignalAmplitude(newValue.amplitude);
+
+    if (newValue.pressure < MIN_DISPLAYED_DBFS) {
+        setCurrentVolumePressure(MIN_DISPLAYED_DBFS);
+    } else if (newValue.pressure > MAX_DISPLAYED_DBFS) {
+        setCurrentVolumePressure(MAX_DISPLAYED_DBFS);
+    } else {
+        setCurrentVolumePressure(newValue.pressure);
+    }
 }
 
 QStringList WaveFormModel::availableSources() const
@@ -24,6 +24,7 @@
 #define MU_AUDIO_WAVEFORMMODEL_H
 
 #include <QObject>
+#include <QTimer>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -47,6 +48,8 @@ class WaveFormModel : public QObject, public async::Asyncable
     Q_PROPERTY(float minDisplayedDbfs READ minDisplayedDbfs CONSTANT)
     Q_PROPERTY(float maxDisplayedDbfs READ maxDisplayedDbfs CONSTANT)
 
+    Q_PROPERTY(bool metersActive READ metersActive WRITE setMetersActive NOTIFY metersActiveChanged)
+
 public:
     explicit WaveFormModel(QObject* parent = nullptr);
 
@@ -59,6 +62,8 @@ public:
     float minDisplayedDbfs() const;
     float maxDisplayedDbfs() const;
 
+    bool metersActive() const;
+
 public slots:
     void setAvailableSources(QStringList availableSources);
     void setCurrentSourceName(QString currentSourceName);
@@ -66,6 +71,8 @@ public slots:
     void setCurrentSignalAmplitude(float currentSignalAmplitude);
     void setCurrentVolumePressure(float currentVolumePressure);
 
+    void setMetersActive(bool active);
+
 signals:
     void availableSourcesChanged(QStringList availableSources);
     void currentSourceNameChanged(QString currentSourceName);
@@ -76,7 +83,14 @@ signals:
     void currentSignalAmplitudeChanged(float currentSignalAmplitude);
     void currentVolumePressureChanged(float currentVolumePressure);
 
+    void metersActiveChanged();
+
 private:
+    void updateSignalValues();
+
+    AudioSignalsMeterPtr m_meter = nullptr;
+    QTimer m_updateTimer;
+
     QStringList m_availableSources;
     QString m_currentSourceName;
 
@@ -49,6 +49,19 @@ public:
     virtual bool isShowControlsInMixer() const = 0;
     virtual void setIsShowControlsInMixer(bool show) = 0;
 
+    //! NOTE Real-time priority and locked memory for the audio threads, applied on the start.
+    //! When the priority is granted by rtkit on Linux, RLIMIT_RTTIME is lowered for the whole process,
+    //! so any real-time thread of it that runs 200 ms without blocking gets killed
+    virtual bool isRealtimeModeEnabled() const = 0;
+    virtual void setRealtimeModeEnabled(bool enabled) = 0;
+
+    //! NOTE Peak hold and true peak are computed by the signal meters on the audio worker
+    virtual bool isMeterPeakHoldEnabled() const = 0;
+    virtual void setMeterPeakHoldEnabled(bool enabled) = 0;
+    virtual bool isMeterTruePeakEnabled() const = 0;
+    virtual void setMeterTruePeakEnabled(bool enabled) = 0;
+    virtual async::Notification meterOptionsChanged() const = 0;
+
     // synthesizers
     virtual AudioInputParams defaultAudioInputParams() const = 0;
     virtual io::paths soundFontDirectories() const = 0;
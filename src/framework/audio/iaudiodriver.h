@@ -44,7 +44,8 @@ public:
         AudioS16  // short 16 bit
     };
 
-    using Callback = std::function<void (void* userdata, uint8_t* stream, int len)>;
+    //! NOTE Returns false if the requested data was not ready in time (underrun)
+    using Callback = std::function<bool (void* userdata, uint8_t* stream, int len)>;
 
     struct Spec
     {
@@ -68,6 +69,10 @@ public:
 
     virtual void resume() = 0;
     virtual void suspend() = 0;
+
+    //! NOTE The number of blocks the device did not get in time since the start:
+    //! the callback underruns and the xruns reported by the device
+    virtual uint64_t xrunsCount() const = 0;
 };
 using IAudioDriverPtr = std::shared_ptr<IAudioDriver>;
 }
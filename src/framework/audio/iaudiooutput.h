@@ -46,8 +46,9 @@ public:
 
     virtual async::Promise<AudioResourceMetaList> availableOutputResources() const = 0;
 
-    virtual async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
-    virtual async::Promise<AudioSignalChanges> masterSignalChanges() const = 0;
+    //! NOTE The meters are updated by the audio worker, poll them at display rate
+    virtual async::Promise<AudioSignalsMeterPtr> signalsMeter(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
+    virtual async::Promise<AudioSignalsMeterPtr> masterSignalsMeter() const = 0;
 };
 
 using IAudioOutputPtr = std::shared_ptr<IAudioOutput>;
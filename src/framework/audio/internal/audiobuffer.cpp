@@ -21,10 +21,13 @@
  */
 #include "audiobuffer.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "log.h"
 
+#include "audiorealtime.h"
+
 using namespace mu::audio;
 
 void AudioBuffer::init(const audioch_t audioChannelsCount, const samples_t samplesPerChannel)
@@ -35,6 +38,10 @@ void AudioBuffer::init(const audioch_t audioChannelsCount, const samples_t sampl
     m_audioChannelsCount = audioChannelsCount;
 
     m_data.resize(m_samplesPerChannel * m_audioChannelsCount, 0.f);
+
+    if (realtime::isEnabled()) {
+        realtime::lockMemory(m_data.data(), m_data.size() * sizeof(float));
+    }
 }
 
 void AudioBuffer::setSource(std::shared_ptr<IAudioSource> source)
@@ -49,29 +56,27 @@ void AudioBuffer::forward()
     fillup();
 }
 
-void AudioBuffer::pop(float* dest, size_t sampleCount)
+bool AudioBuffer::pop(float* dest, size_t sampleCount)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    size_t from = m_readIndex;
-    auto memStep = sizeof(float);
-    size_t to = m_readIndex + sampleCount * m_audioChannelsCount;
-    if (to > m_data.size()) {
-        to = m_data.size();
-    }
-    auto count = to - from;
-    std::memcpy(dest, m_data.data() + from, count * memStep);
-    m_readIndex += count;
+    //! NOTE On an underrun only the rendered samples are read and the rest is silence,
+    //! so the read index never overtakes the write index
+    const size_t renderedCount = std::min<size_t>(sampleLag(), sampleCount);
 
-    size_t left = sampleCount * m_audioChannelsCount - count;
-    if (left > 0) {
-        std::memcpy(dest + count, m_data.data(), left * memStep);
-        m_readIndex = left;
-    }
+    const size_t count = renderedCount * m_audioChannelsCount;
+    const size_t tailCount = std::min(count, m_data.size() - m_readIndex);
+    std::memcpy(dest, m_data.data() + m_readIndex, tailCount * sizeof(float));
+    std::memcpy(dest + tailCount, m_data.data(), (count - tailCount) * sizeof(float));
 
+    m_readIndex += count;
     if (m_readIndex >= m_data.size()) {
         m_readIndex -= m_data.size();
     }
+
+    std::fill(dest + count, dest + sampleCount * m_audioChannelsCount, 0.f);
+
+    return renderedCount == sampleCount;
 }
 
 void AudioBuffer::setMinSampleLag(size_t lag)
@@ -84,6 +89,12 @@ void AudioBuffer::setMinSampleLag(size_t lag)
     m_minSampleLag = lag;
 }
 
+void AudioBuffer::setRenderTimeCallback(RenderTimeCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_renderTimeCallback = std::move(callback);
+}
+
 void AudioBuffer::fillup()
 {
     if (!m_source) {
@@ -91,7 +102,14 @@ void AudioBuffer::fillup()
     }
 
     while (sampleLag() < m_minSampleLag + FILL_OVER) {
-        m_source->process(m_data.data() + m_writeIndex, FILL_SAMPLES);
+        if (m_renderTimeCallback) {
+            const auto start = std::chrono::steady_clock::now();
+            m_source->process(m_data.data() + m_writeIndex, FILL_SAMPLES);
+            m_renderTimeCallback(std::chrono::steady_clock::now() - start);
+        } else {
+            m_source->process(m_data.data() + m_writeIndex, FILL_SAMPLES);
+        }
+
         updateWriteIndex(FILL_SAMPLES);
     }
 }
@@ -25,6 +25,8 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <chrono>
+#include <functional>
 
 #include "modularity/ioc.h"
 
@@ -45,9 +47,13 @@ public:
     void setSource(std::shared_ptr<IAudioSource> source) override;
     void forward() override;
 
-    void pop(float* dest, size_t sampleCount) override;
+    bool pop(float* dest, size_t sampleCount) override;
     void setMinSampleLag(size_t lag) override;
 
+    //! NOTE Called on the worker thread with the time the source took to render each block
+    using RenderTimeCallback = std::function<void (std::chrono::nanoseconds)>;
+    void setRenderTimeCallback(RenderTimeCallback callback);
+
 private:
 
     unsigned int sampleLag() const;
@@ -63,6 +69,7 @@ private:
 
     std::vector<float> m_data = {};
     std::shared_ptr<IAudioSource> m_source = nullptr;
+    RenderTimeCallback m_renderTimeCallback = nullptr;
 };
 }
 
@@ -41,6 +41,9 @@ static const audioch_t AUDIO_CHANNELS = 2;
 //TODO: add other setting: audio device etc
 static const Settings::Key AUDIO_API_KEY("audio", "io/audioApi");
 static const Settings::Key AUDIO_BUFFER_SIZE("audio", "driver_buffer");
+static const Settings::Key AUDIO_REALTIME_MODE("audio", "io/realtimeMode");
+static const Settings::Key METER_PEAK_HOLD("audio", "io/meters/peakHold");
+static const Settings::Key METER_TRUE_PEAK("audio", "io/meters/truePeak");
 
 static const Settings::Key USER_SOUNDFONTS_PATH("midi", "application/paths/mySoundfonts");
 
@@ -62,6 +65,17 @@ void AudioConfiguration::init()
 
     settings()->setDefaultValue(SHOW_CONTROLS_IN_MIXER, Val(true));
     settings()->setDefaultValue(AUDIO_API_KEY, Val("Core Audio"));
+    settings()->setDefaultValue(AUDIO_REALTIME_MODE, Val(false));
+
+    settings()->setDefaultValue(METER_PEAK_HOLD, Val(false));
+    settings()->valueChanged(METER_PEAK_HOLD).onReceive(nullptr, [this](const Val&) {
+        m_meterOptionsChanged.notify();
+    });
+
+    settings()->setDefaultValue(METER_TRUE_PEAK, Val(false));
+    settings()->valueChanged(METER_TRUE_PEAK).onReceive(nullptr, [this](const Val&) {
+        m_meterOptionsChanged.notify();
+    });
 }
 
 std::vector<std::string> AudioConfiguration::availableAudioApiList() const
@@ -124,6 +138,41 @@ void AudioConfiguration::setIsShowControlsInMixer(bool show)
     settings()->setSharedValue(SHOW_CONTROLS_IN_MIXER, Val(show));
 }
 
+bool AudioConfiguration::isRealtimeModeEnabled() const
+{
+    return settings()->value(AUDIO_REALTIME_MODE).toBool();
+}
+
+void AudioConfiguration::setRealtimeModeEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUDIO_REALTIME_MODE, Val(enabled));
+}
+
+bool AudioConfiguration::isMeterPeakHoldEnabled() const
+{
+    return settings()->value(METER_PEAK_HOLD).toBool();
+}
+
+void AudioConfiguration::setMeterPeakHoldEnabled(bool enabled)
+{
+    settings()->setSharedValue(METER_PEAK_HOLD, Val(enabled));
+}
+
+bool AudioConfiguration::isMeterTruePeakEnabled() const
+{
+    return settings()->value(METER_TRUE_PEAK).toBool();
+}
+
+void AudioConfiguration::setMeterTruePeakEnabled(bool enabled)
+{
+    settings()->setSharedValue(METER_TRUE_PEAK, Val(enabled));
+}
+
+async::Notification AudioConfiguration::meterOptionsChanged() const
+{
+    return m_meterOptionsChanged;
+}
+
 AudioInputParams AudioConfiguration::defaultAudioInputParams() const
 {
     AudioInputParams result;
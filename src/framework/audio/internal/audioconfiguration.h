@@ -49,6 +49,15 @@ public:
     bool isShowControlsInMixer() const override;
     void setIsShowControlsInMixer(bool show) override;
 
+    bool isRealtimeModeEnabled() const override;
+    void setRealtimeModeEnabled(bool enabled) override;
+
+    bool isMeterPeakHoldEnabled() const override;
+    void setMeterPeakHoldEnabled(bool enabled) override;
+    bool isMeterTruePeakEnabled() const override;
+    void setMeterTruePeakEnabled(bool enabled) override;
+    async::Notification meterOptionsChanged() const override;
+
     AudioInputParams defaultAudioInputParams() const override;
 
     const synth::SynthesizerState& defaultSynthesizerState() const;
@@ -59,6 +68,7 @@ public:
 
 private:
     async::Channel<io::paths> m_soundFontDirsChanged;
+    async::Notification m_meterOptionsChanged;
 
     io::path stateFilePath() const;
     bool readState(const io::path& path, synth::SynthesizerState& state) const;
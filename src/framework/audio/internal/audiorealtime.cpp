@@ -0,0 +1,243 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audiorealtime.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <thread>
+
+#include <QtGlobal>
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef Q_OS_LINUX
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#endif
+
+#ifdef MU_AUDIO_RTKIT
+#include <QDBusConnection>
+#include <QDBusMessage>
+#endif
+
+#include "log.h"
+
+using namespace mu::audio;
+
+static std::atomic<bool> s_enabled = false;
+
+static constexpr size_t STACK_PREFAULT_SIZE = 64 * 1024;
+static constexpr int MIN_CPUS_TO_PIN = 4;
+
+static size_t pageSize()
+{
+#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+static void prefaultStack()
+{
+    volatile unsigned char stack[STACK_PREFAULT_SIZE];
+    for (size_t i = 0; i < STACK_PREFAULT_SIZE; i += pageSize()) {
+        stack[i] = 0;
+    }
+    (void)stack[0];
+}
+
+#ifdef MU_AUDIO_RTKIT
+static bool makeThreadRealtimeWithRtkit(int priority)
+{
+    //! NOTE rtkit only accepts processes with a limited real-time CPU time,
+    //! a thread that runs longer without blocking is killed.
+    //! The limit is process-wide, it also applies to the real-time threads of plugins and drivers
+    static constexpr rlim_t RTKIT_MAX_RTTIME_US = 200000;
+
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_RTTIME, &limit) == 0 && (limit.rlim_max == RLIM_INFINITY || limit.rlim_max > RTKIT_MAX_RTTIME_US)) {
+        limit.rlim_cur = RTKIT_MAX_RTTIME_US;
+        limit.rlim_max = RTKIT_MAX_RTTIME_US;
+        if (setrlimit(RLIMIT_RTTIME, &limit) != 0) {
+            LOGW() << "failed set RLIMIT_RTTIME: " << strerror(errno);
+            return false;
+        }
+
+        LOGI() << "RLIMIT_RTTIME of the process is lowered to " << RTKIT_MAX_RTTIME_US << " us for rtkit";
+    }
+
+    QDBusConnection bus = QDBusConnection::systemBus();
+    if (!bus.isConnected()) {
+        LOGW() << "system bus is not available";
+        return false;
+    }
+
+    QDBusMessage message = QDBusMessage::createMethodCall("org.freedesktop.RealtimeKit1",
+                                                          "/org/freedesktop/RealtimeKit1",
+                                                          "org.freedesktop.RealtimeKit1",
+                                                          "MakeThreadRealtime");
+    message << quint64(syscall(SYS_gettid)) << quint32(priority);
+
+    QDBusMessage reply = bus.call(message, QDBus::Block, 1000);
+    if (reply.type() == QDBusMessage::ErrorMessage) {
+        LOGW() << "rtkit refused the real-time priority: " << reply.errorMessage().toStdString();
+        return false;
+    }
+
+    return true;
+}
+
+#endif
+
+void realtime::setEnabled(bool enabled)
+{
+    s_enabled = enabled;
+}
+
+bool realtime::isEnabled()
+{
+    return s_enabled;
+}
+
+bool realtime::promoteCurrentThread(int priority)
+{
+    prefaultStack();
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+    sched_param param;
+    param.sched_priority = priority;
+    int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (ret == 0) {
+        LOGI() << "SCHED_FIFO priority: " << priority;
+        return true;
+    }
+
+#ifdef MU_AUDIO_RTKIT
+    if (ret == EPERM && makeThreadRealtimeWithRtkit(priority)) {
+        LOGI() << "rtkit priority: " << priority;
+        return true;
+    }
+#endif
+
+    LOGW() << "failed set the real-time priority, the thread keeps the default one: " << strerror(ret);
+    return false;
+#elif defined(Q_OS_WIN)
+    UNUSED(priority);
+    if (SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL)) {
+        return true;
+    }
+
+    LOGW() << "failed set the time critical priority, error: " << GetLastError();
+    return false;
+#else
+    UNUSED(priority);
+    return false;
+#endif
+}
+
+bool realtime::pinCurrentThread(int cpu)
+{
+    if (cpu < 0) {
+        return false;
+    }
+
+#ifdef Q_OS_LINUX
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (ret != 0) {
+        LOGW() << "failed pin the thread to cpu " << cpu << ": " << strerror(ret);
+        return false;
+    }
+
+    return true;
+#elif defined(Q_OS_WIN)
+    if (SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) == 0) {
+        LOGW() << "failed pin the thread to cpu " << cpu << ", error: " << GetLastError();
+        return false;
+    }
+
+    return true;
+#else
+    //! NOTE macOS has no thread affinity, only affinity tags as hints
+    return false;
+#endif
+}
+
+int realtime::audioThreadCpu(int index)
+{
+    int cpus = static_cast<int>(std::thread::hardware_concurrency());
+    if (cpus < MIN_CPUS_TO_PIN || index < 0 || index >= cpus / 2) {
+        return -1;
+    }
+
+    return cpus - 1 - index;
+}
+
+bool realtime::lockMemory(const void* data, size_t size)
+{
+    if (!data || size == 0) {
+        return false;
+    }
+
+    const size_t page = pageSize();
+    uintptr_t begin = reinterpret_cast<uintptr_t>(data) & ~(uintptr_t(page) - 1);
+    uintptr_t end = reinterpret_cast<uintptr_t>(data) + size;
+
+    const volatile unsigned char* bytes = static_cast<const volatile unsigned char*>(data);
+    for (size_t offset = 0; offset < size; offset += page) {
+        (void)bytes[offset];
+    }
+    (void)bytes[size - 1];
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+    if (mlock(reinterpret_cast<const void*>(begin), end - begin) != 0) {
+        LOGW() << "failed lock " << size << " bytes: " << strerror(errno);
+        return false;
+    }
+
+    return true;
+#elif defined(Q_OS_WIN)
+    if (!VirtualLock(reinterpret_cast<LPVOID>(begin), end - begin)) {
+        LOGW() << "failed lock " << size << " bytes, error: " << GetLastError();
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,52 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUDIOREALTIME_H
+#define MU_AUDIO_AUDIOREALTIME_H
+
+#include <cstddef>
+
+//! NOTE The opt-in real-time mode of the audio threads.
+//! Every step is a request to the system: if it is not permitted,
+//! a warning is logged and the thread keeps running as before
+namespace mu::audio::realtime {
+static constexpr int DRIVER_THREAD_PRIORITY = 20;
+static constexpr int WORKER_THREAD_PRIORITY = 18;
+
+void setEnabled(bool enabled);
+bool isEnabled();
+
+//! NOTE Requests the real-time priority (SCHED_FIFO, on Linux via rtkit as a fallback)
+//! for the calling thread and pre-faults its stack
+bool promoteCurrentThread(int priority);
+
+//! NOTE Pins the calling thread to the given CPU, a negative value means any
+bool pinCurrentThread(int cpu);
+
+//! NOTE The dedicated CPU of the n-th audio thread, counted from the last one,
+//! or -1 if there are too few CPUs to dedicate them
+int audioThreadCpu(int index);
+
+//! NOTE Pre-faults the pages of the memory and locks them in RAM
+bool lockMemory(const void* data, size_t size);
+}
+
+#endif // MU_AUDIO_AUDIOREALTIME_H
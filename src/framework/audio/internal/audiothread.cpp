@@ -25,6 +25,8 @@
 #include "runtime.h"
 #include "async/processevents.h"
 
+#include "audiorealtime.h"
+
 #ifdef Q_OS_WASM
 #include <emscripten/html5.h>
 #endif
@@ -78,6 +80,11 @@ void AudioThread::main()
 
     AudioThread::ID = std::this_thread::get_id();
 
+    if (realtime::isEnabled()) {
+        realtime::promoteCurrentThread(realtime::WORKER_THREAD_PRIORITY);
+        realtime::pinCurrentThread(realtime::audioThreadCpu(1));
+    }
+
     if (m_onStart) {
         m_onStart();
     }
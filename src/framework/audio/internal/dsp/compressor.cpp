@@ -3,6 +3,7 @@
 #include "log.h"
 
 #include "audiomathutils.h"
+#include "dspkernels.h"
 
 using namespace mu::audio;
 using namespace mu::audio::dsp;
@@ -63,9 +64,7 @@ void Compressor::process(const float linearRms, float* buffer, const audioch_t&
     float currentGainReduction = std::min(gainFact, m_previousGainReduction);
 
     // apply gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, currentGainReduction);
-    }
+    applyGain(buffer, samplesPerChannel * audioChannelsCount, currentGainReduction);
 
     m_previousGainReduction = currentGainReduction;
 }
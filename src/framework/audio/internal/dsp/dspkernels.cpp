@@ -0,0 +1,435 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "dspkernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define MU_DSP_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define MU_DSP_TARGET_SSE
+#define MU_DSP_TARGET_AVX
+#else
+#define MU_DSP_TARGET_SSE __attribute__((target("sse")))
+#define MU_DSP_TARGET_AVX __attribute__((target("avx")))
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MU_DSP_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+//-----------------------------------------------
+//   scalar
+//-----------------------------------------------
+
+static void mixAddScalar(float* dst, const float* src, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+static void applyGainScalar(float* buffer, size_t count, float gain)
+{
+    for (size_t i = 0; i < count; ++i) {
+        buffer[i] *= gain;
+    }
+}
+
+static void applyGainsAndMeasureScalar(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                       const float* gains, float* squaredSums, float* peaks)
+{
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
+        float squaredSum = 0.f;
+        float peak = 0.f;
+
+        for (samples_t s = 0; s < samplesPerChannel; ++s) {
+            float& sample = buffer[s * audioChannelsCount + audioChNum];
+
+            sample *= gains[audioChNum];
+            squaredSum += sample * sample;
+            peak = std::max(peak, std::abs(sample));
+        }
+
+        squaredSums[audioChNum] = squaredSum;
+        peaks[audioChNum] = peak;
+    }
+}
+
+//! NOTE The vector kernels handle the interleaved frames with one vector of gains
+//! as long as the audio channels count divides the vector width, lane i belongs to the channel i % count.
+//! The samples after the last full vector are processed by the scalar code
+static void measureTail(float* buffer, size_t begin, size_t end, audioch_t audioChannelsCount,
+                        const float* gains, float* squaredSums, float* peaks)
+{
+    for (size_t i = begin; i < end; ++i) {
+        const audioch_t audioChNum = i % audioChannelsCount;
+
+        buffer[i] *= gains[audioChNum];
+        squaredSums[audioChNum] += buffer[i] * buffer[i];
+        peaks[audioChNum] = std::max(peaks[audioChNum], std::abs(buffer[i]));
+    }
+}
+
+static void foldLanes(const float* sumLanes, const float* peakLanes, size_t lanesCount, audioch_t audioChannelsCount,
+                      float* squaredSums, float* peaks)
+{
+    std::fill(squaredSums, squaredSums + audioChannelsCount, 0.f);
+    std::fill(peaks, peaks + audioChannelsCount, 0.f);
+
+    for (size_t lane = 0; lane < lanesCount; ++lane) {
+        const audioch_t audioChNum = lane % audioChannelsCount;
+
+        squaredSums[audioChNum] += sumLanes[lane];
+        peaks[audioChNum] = std::max(peaks[audioChNum], peakLanes[lane]);
+    }
+}
+
+#ifdef MU_DSP_X86
+
+//-----------------------------------------------
+//   SSE
+//-----------------------------------------------
+
+MU_DSP_TARGET_SSE
+static void mixAddSse(float* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+    }
+
+    mixAddScalar(dst + i, src + i, count - i);
+}
+
+MU_DSP_TARGET_SSE
+static void applyGainSse(float* buffer, size_t count, float gain)
+{
+    const __m128 g = _mm_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(buffer + i, _mm_mul_ps(_mm_loadu_ps(buffer + i), g));
+    }
+
+    applyGainScalar(buffer + i, count - i, gain);
+}
+
+MU_DSP_TARGET_SSE
+static void applyGainsAndMeasureSse(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                    const float* gains, float* squaredSums, float* peaks)
+{
+    constexpr size_t WIDTH = 4;
+
+    if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+        applyGainsAndMeasureScalar(buffer, audioChannelsCount, samplesPerChannel, gains, squaredSums, peaks);
+        return;
+    }
+
+    alignas(16) float lanes[WIDTH];
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        lanes[lane] = gains[lane % audioChannelsCount];
+    }
+
+    const __m128 g = _mm_load_ps(lanes);
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    __m128 sum = _mm_setzero_ps();
+    __m128 peak = _mm_setzero_ps();
+
+    const size_t count = samplesPerChannel * audioChannelsCount;
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        const __m128 v = _mm_mul_ps(_mm_loadu_ps(buffer + i), g);
+        _mm_storeu_ps(buffer + i, v);
+
+        sum = _mm_add_ps(sum, _mm_mul_ps(v, v));
+        peak = _mm_max_ps(peak, _mm_andnot_ps(signMask, v));
+    }
+
+    alignas(16) float sumLanes[WIDTH];
+    alignas(16) float peakLanes[WIDTH];
+    _mm_store_ps(sumLanes, sum);
+    _mm_store_ps(peakLanes, peak);
+
+    foldLanes(sumLanes, peakLanes, WIDTH, audioChannelsCount, squaredSums, peaks);
+    measureTail(buffer, i, count, audioChannelsCount, gains, squaredSums, peaks);
+}
+
+//-----------------------------------------------
+//   AVX
+//-----------------------------------------------
+
+MU_DSP_TARGET_AVX
+static void mixAddAvx(float* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(src + i)));
+    }
+
+    mixAddScalar(dst + i, src + i, count - i);
+}
+
+MU_DSP_TARGET_AVX
+static void applyGainAvx(float* buffer, size_t count, float gain)
+{
+    const __m256 g = _mm256_set1_ps(gain);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(buffer + i, _mm256_mul_ps(_mm256_loadu_ps(buffer + i), g));
+    }
+
+    applyGainScalar(buffer + i, count - i, gain);
+}
+
+MU_DSP_TARGET_AVX
+static void applyGainsAndMeasureAvx(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                    const float* gains, float* squaredSums, float* peaks)
+{
+    constexpr size_t WIDTH = 8;
+
+    if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+        applyGainsAndMeasureScalar(buffer, audioChannelsCount, samplesPerChannel, gains, squaredSums, peaks);
+        return;
+    }
+
+    alignas(32) float lanes[WIDTH];
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        lanes[lane] = gains[lane % audioChannelsCount];
+    }
+
+    const __m256 g = _mm256_load_ps(lanes);
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    __m256 sum = _mm256_setzero_ps();
+    __m256 peak = _mm256_setzero_ps();
+
+    const size_t count = samplesPerChannel * audioChannelsCount;
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        const __m256 v = _mm256_mul_ps(_mm256_loadu_ps(buffer + i), g);
+        _mm256_storeu_ps(buffer + i, v);
+
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(v, v));
+        peak = _mm256_max_ps(peak, _mm256_andnot_ps(signMask, v));
+    }
+
+    alignas(32) float sumLanes[WIDTH];
+    alignas(32) float peakLanes[WIDTH];
+    _mm256_store_ps(sumLanes, sum);
+    _mm256_store_ps(peakLanes, peak);
+
+    foldLanes(sumLanes, peakLanes, WIDTH, audioChannelsCount, squaredSums, peaks);
+    measureTail(buffer, i, count, audioChannelsCount, gains, squaredSums, peaks);
+}
+
+static bool cpuSupportsSse()
+{
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    return true;
+#elif defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 1);
+    return info[3] & (1 << 25);
+#else
+    return __builtin_cpu_supports("sse");
+#endif
+}
+
+static bool cpuSupportsAvx()
+{
+#ifdef _MSC_VER
+    int info[4] = {};
+    __cpuid(info, 1);
+
+    //! NOTE The OS must save the AVX registers too
+    const bool osxsave = info[2] & (1 << 27);
+    const bool avx = info[2] & (1 << 28);
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return __builtin_cpu_supports("avx");
+#endif
+}
+
+#endif // MU_DSP_X86
+
+#ifdef MU_DSP_NEON
+
+//-----------------------------------------------
+//   NEON
+//-----------------------------------------------
+
+static void mixAddNeon(float* dst, const float* src, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(dst + i, vaddq_f32(vld1q_f32(dst + i), vld1q_f32(src + i)));
+    }
+
+    mixAddScalar(dst + i, src + i, count - i);
+}
+
+static void applyGainNeon(float* buffer, size_t count, float gain)
+{
+    const float32x4_t g = vdupq_n_f32(gain);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(buffer + i, vmulq_f32(vld1q_f32(buffer + i), g));
+    }
+
+    applyGainScalar(buffer + i, count - i, gain);
+}
+
+static void applyGainsAndMeasureNeon(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                     const float* gains, float* squaredSums, float* peaks)
+{
+    constexpr size_t WIDTH = 4;
+
+    if (audioChannelsCount == 0 || WIDTH % audioChannelsCount != 0) {
+        applyGainsAndMeasureScalar(buffer, audioChannelsCount, samplesPerChannel, gains, squaredSums, peaks);
+        return;
+    }
+
+    float lanes[WIDTH];
+    for (size_t lane = 0; lane < WIDTH; ++lane) {
+        lanes[lane] = gains[lane % audioChannelsCount];
+    }
+
+    const float32x4_t g = vld1q_f32(lanes);
+    float32x4_t sum = vdupq_n_f32(0.f);
+    float32x4_t peak = vdupq_n_f32(0.f);
+
+    const size_t count = samplesPerChannel * audioChannelsCount;
+    size_t i = 0;
+    for (; i + WIDTH <= count; i += WIDTH) {
+        const float32x4_t v = vmulq_f32(vld1q_f32(buffer + i), g);
+        vst1q_f32(buffer + i, v);
+
+        sum = vmlaq_f32(sum, v, v);
+        peak = vmaxq_f32(peak, vabsq_f32(v));
+    }
+
+    float sumLanes[WIDTH];
+    float peakLanes[WIDTH];
+    vst1q_f32(sumLanes, sum);
+    vst1q_f32(peakLanes, peak);
+
+    foldLanes(sumLanes, peakLanes, WIDTH, audioChannelsCount, squaredSums, peaks);
+    measureTail(buffer, i, count, audioChannelsCount, gains, squaredSums, peaks);
+}
+
+#endif // MU_DSP_NEON
+
+//-----------------------------------------------
+//   dispatch
+//-----------------------------------------------
+
+bool mu::audio::dsp::isSupported(InstructionSet set)
+{
+    switch (set) {
+    case InstructionSet::Scalar:
+        return true;
+#ifdef MU_DSP_X86
+    case InstructionSet::SSE:
+        return cpuSupportsSse();
+    case InstructionSet::AVX:
+        return cpuSupportsAvx();
+#endif
+#ifdef MU_DSP_NEON
+    case InstructionSet::NEON:
+        return true;
+#endif
+    default:
+        break;
+    }
+
+    return false;
+}
+
+InstructionSet mu::audio::dsp::bestInstructionSet()
+{
+    for (InstructionSet set : { InstructionSet::AVX, InstructionSet::NEON, InstructionSet::SSE }) {
+        if (isSupported(set)) {
+            return set;
+        }
+    }
+
+    return InstructionSet::Scalar;
+}
+
+std::string mu::audio::dsp::instructionSetName(InstructionSet set)
+{
+    switch (set) {
+    case InstructionSet::Scalar: return "Scalar";
+    case InstructionSet::SSE: return "SSE";
+    case InstructionSet::AVX: return "AVX";
+    case InstructionSet::NEON: return "NEON";
+    }
+
+    return std::string();
+}
+
+const Kernels& mu::audio::dsp::kernels(InstructionSet set)
+{
+    static const Kernels scalar { mixAddScalar, applyGainScalar, applyGainsAndMeasureScalar };
+
+    if (!isSupported(set)) {
+        return scalar;
+    }
+
+    switch (set) {
+#ifdef MU_DSP_X86
+    case InstructionSet::SSE: {
+        static const Kernels sse { mixAddSse, applyGainSse, applyGainsAndMeasureSse };
+        return sse;
+    }
+    case InstructionSet::AVX: {
+        static const Kernels avx { mixAddAvx, applyGainAvx, applyGainsAndMeasureAvx };
+        return avx;
+    }
+#endif
+#ifdef MU_DSP_NEON
+    case InstructionSet::NEON: {
+        static const Kernels neon { mixAddNeon, applyGainNeon, applyGainsAndMeasureNeon };
+        return neon;
+    }
+#endif
+    default:
+        break;
+    }
+
+    return scalar;
+}
+
+const Kernels& mu::audio::dsp::kernels()
+{
+    static const Kernels& best = kernels(bestInstructionSet());
+    return best;
+}
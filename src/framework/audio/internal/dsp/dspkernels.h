@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_DSPKERNELS_H
+#define MU_AUDIO_DSPKERNELS_H
+
+#include <cstddef>
+#include <string>
+
+#include "audiotypes.h"
+
+namespace mu::audio::dsp {
+//! NOTE Vectorized kernels for the mixer path. All the buffers are interleaved,
+//! the implementation is chosen once at runtime by the instruction sets the CPU supports
+enum class InstructionSet {
+    Scalar = 0,
+    SSE,
+    AVX,
+    NEON
+};
+
+struct Kernels {
+    //! NOTE dst[i] += src[i]
+    void (* mixAdd)(float* dst, const float* src, size_t count) = nullptr;
+
+    //! NOTE buffer[i] *= gain
+    void (* applyGain)(float* buffer, size_t count, float gain) = nullptr;
+
+    //! NOTE Applies a gain per audio channel (volume and balance) and measures
+    //! the squared sum and the absolute peak of the result per audio channel
+    void (* applyGainsAndMeasure)(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                  const float* gains, float* squaredSums, float* peaks) = nullptr;
+};
+
+bool isSupported(InstructionSet set);
+InstructionSet bestInstructionSet();
+std::string instructionSetName(InstructionSet set);
+
+//! NOTE Returns the scalar kernels if the set is not supported
+const Kernels& kernels(InstructionSet set);
+const Kernels& kernels();
+
+inline void mixAdd(float* dst, const float* src, size_t count)
+{
+    kernels().mixAdd(dst, src, count);
+}
+
+inline void applyGain(float* buffer, size_t count, float gain)
+{
+    kernels().applyGain(buffer, count, gain);
+}
+
+inline void applyGainsAndMeasure(float* buffer, audioch_t audioChannelsCount, samples_t samplesPerChannel,
+                                 const float* gains, float* squaredSums, float* peaks)
+{
+    kernels().applyGainsAndMeasure(buffer, audioChannelsCount, samplesPerChannel, gains, squaredSums, peaks);
+}
+}
+
+#endif // MU_AUDIO_DSPKERNELS_H
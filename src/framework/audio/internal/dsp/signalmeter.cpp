@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "signalmeter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "audiomathutils.h"
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+static constexpr float PEAK_HOLD_TIME_SECS = 1.5f;
+
+//! NOTE The true peak is estimated by 4x oversampling, like ITU-R BS.1770:
+//! the points at 1/4, 2/4 and 3/4 between two samples are interpolated
+//! by a Hann windowed sinc over the 16 surrounding samples
+static constexpr int OVERSAMPLING = 4;
+static constexpr int INTERPOLATED_POINTS = OVERSAMPLING - 1;
+static constexpr int TAPS = 16;
+
+using InterpolationWeights = std::array<std::array<float, TAPS>, INTERPOLATED_POINTS>;
+
+static const InterpolationWeights& interpolationWeights()
+{
+    static const InterpolationWeights weights = []() {
+        InterpolationWeights result;
+        for (int point = 0; point < INTERPOLATED_POINTS; ++point) {
+            const double fraction = double(point + 1) / OVERSAMPLING;
+            double sum = 0.0;
+            for (int tap = 0; tap < TAPS; ++tap) {
+                const double t = fraction - (tap - (TAPS / 2 - 1));
+                const double sinc = std::sin(M_PI * t) / (M_PI * t);
+                const double window = 0.5 * (1.0 + std::cos(M_PI * t / (TAPS / 2)));
+                result[point][tap] = float(sinc * window);
+                sum += sinc * window;
+            }
+            for (float& w : result[point]) {
+                w = float(w / sum);
+            }
+        }
+        return result;
+    }();
+
+    return weights;
+}
+
+SignalMeter::SignalMeter(const unsigned int sampleRate)
+    : m_meter(std::make_shared<AudioSignalsMeter>())
+{
+    setSampleRate(sampleRate);
+}
+
+AudioSignalsMeterPtr SignalMeter::meter() const
+{
+    return m_meter;
+}
+
+void SignalMeter::setSampleRate(const unsigned int sampleRate)
+{
+    m_holdSamples = static_cast<samples_t>(sampleRate * PEAK_HOLD_TIME_SECS);
+}
+
+void SignalMeter::process(const audioch_t audioChNumber, const float* buffer, const audioch_t audioChannelsCount,
+                          const samples_t samplesPerChannel, const float linearRms, const float linearPeak)
+{
+    if (audioChNumber >= AudioSignalsMeter::MAX_CHANNELS) {
+        return;
+    }
+
+    float linearTruePeak = 0.f;
+    if (m_meter->truePeakEnabled()) {
+        ChannelState& state = m_states[audioChNumber];
+        linearTruePeak = std::max(linearPeak, truePeak(state, buffer, audioChNumber, audioChannelsCount, samplesPerChannel));
+    }
+
+    publish(audioChNumber, samplesPerChannel, linearRms, linearPeak, linearTruePeak);
+}
+
+void SignalMeter::processSilence(const audioch_t audioChNumber, const samples_t samplesPerChannel)
+{
+    if (audioChNumber >= AudioSignalsMeter::MAX_CHANNELS) {
+        return;
+    }
+
+    m_states[audioChNumber].window.fill(0.f);
+    publish(audioChNumber, samplesPerChannel, 0.f, 0.f, 0.f);
+}
+
+float SignalMeter::truePeak(ChannelState& state, const float* buffer, const audioch_t audioChNumber,
+                            const audioch_t audioChannelsCount, const samples_t samplesPerChannel) const
+{
+    static_assert(INTERPOLATION_TAPS == TAPS);
+
+    const InterpolationWeights& weights = interpolationWeights();
+    std::array<float, TAPS>& window = state.window;
+    float result = 0.f;
+
+    //! NOTE The window keeps the last samples across blocks,
+    //! the points are interpolated between its two middle samples
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        std::copy(window.begin() + 1, window.end(), window.begin());
+        window[TAPS - 1] = buffer[s * audioChannelsCount + audioChNumber];
+
+        for (const std::array<float, TAPS>& w : weights) {
+            float value = 0.f;
+            for (int tap = 0; tap < TAPS; ++tap) {
+                value += w[tap] * window[tap];
+            }
+            result = std::max(result, std::abs(value));
+        }
+    }
+
+    return result;
+}
+
+void SignalMeter::publish(const audioch_t audioChNumber, const samples_t samplesPerChannel, const float linearRms,
+                          const float linearPeak, const float linearTruePeak)
+{
+    ChannelState& state = m_states[audioChNumber];
+    const samples_t holdSamples = m_meter->peakHoldEnabled() ? m_holdSamples : 0;
+
+    AudioSignalVal val;
+    val.amplitude = linearRms;
+    val.pressure = std::max(dbFromSample(linearRms), MINIMUM_OPERABLE_DBFS_LEVEL);
+    val.peak = state.peak.update(linearPeak, samplesPerChannel, holdSamples);
+    val.truePeak = state.truePeak.update(linearTruePeak, samplesPerChannel, holdSamples);
+
+    m_meter->setSignalValue(audioChNumber, val);
+}
+
+float SignalMeter::Hold::update(const float newValue, const samples_t samples, const samples_t holdSamples)
+{
+    age += samples;
+
+    if (newValue >= value || age >= holdSamples) {
+        value = newValue;
+        age = 0;
+    }
+
+    return value;
+}
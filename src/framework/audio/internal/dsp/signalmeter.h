@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_SIGNALMETER_H
+#define MU_AUDIO_SIGNALMETER_H
+
+#include <array>
+
+#include "audiotypes.h"
+
+namespace mu::audio::dsp {
+//! NOTE Measures the output of a mixer channel on the audio worker
+//! and publishes it into an AudioSignalsMeter polled by the UI
+class SignalMeter
+{
+public:
+    SignalMeter(const unsigned int sampleRate);
+
+    AudioSignalsMeterPtr meter() const;
+
+    void setSampleRate(const unsigned int sampleRate);
+
+    //! NOTE RMS and sample peak are measured by the caller while it applies the gain,
+    //! the interleaved buffer is only read again if the true peak is enabled
+    void process(const audioch_t audioChNumber, const float* buffer, const audioch_t audioChannelsCount,
+                 const samples_t samplesPerChannel, const float linearRms, const float linearPeak);
+    void processSilence(const audioch_t audioChNumber, const samples_t samplesPerChannel);
+
+private:
+    struct Hold {
+        float value = 0.f;
+        samples_t age = 0;
+
+        float update(const float newValue, const samples_t samples, const samples_t holdSamples);
+    };
+
+    static constexpr int INTERPOLATION_TAPS = 16;
+
+    struct ChannelState {
+        std::array<float, INTERPOLATION_TAPS> window = {};
+        Hold peak;
+        Hold truePeak;
+    };
+
+    float truePeak(ChannelState& state, const float* buffer, const audioch_t audioChNumber, const audioch_t audioChannelsCount,
+                   const samples_t samplesPerChannel) const;
+    void publish(const audioch_t audioChNumber, const samples_t samplesPerChannel, const float linearRms, const float linearPeak,
+                 const float linearTruePeak);
+
+    AudioSignalsMeterPtr m_meter = nullptr;
+    samples_t m_holdSamples = 0;
+
+    std::array<ChannelState, AudioSignalsMeter::MAX_CHANNELS> m_states;
+};
+}
+
+#endif // MU_AUDIO_SIGNALMETER_H
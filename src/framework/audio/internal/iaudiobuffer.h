@@ -34,7 +34,8 @@ public:
     virtual void setSource(std::shared_ptr<IAudioSource> source) = 0;
     virtual void forward() = 0;
 
-    virtual void pop(float* dest, size_t sampleCount) = 0;
+    //! NOTE Returns false if less than sampleCount samples were rendered (underrun)
+    virtual bool pop(float* dest, size_t sampleCount) = 0;
     virtual void setMinSampleLag(size_t lag) = 0;
 };
 
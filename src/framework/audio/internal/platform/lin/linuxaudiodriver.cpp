@@ -29,10 +29,13 @@
 #include <string.h>
 #include <math.h>
 #include <pthread.h>
+#include <atomic>
 
 #include "log.h"
 #include "runtime.h"
 
+#include "internal/audiorealtime.h"
+
 using namespace mu::audio;
 
 namespace  {
@@ -49,12 +52,18 @@ struct ALSAData
 };
 
 static ALSAData* _alsaData{ nullptr };
+static std::atomic<uint64_t> _xrunsCount{ 0 };
 
 static void* alsaThread(void* aParam)
 {
     mu::runtime::setThreadName("audio_driver");
     ALSAData* data = static_cast<ALSAData*>(aParam);
 
+    if (realtime::isEnabled()) {
+        realtime::promoteCurrentThread(realtime::DRIVER_THREAD_PRIORITY);
+        realtime::pinCurrentThread(realtime::audioThreadCpu(0));
+    }
+
     int ret = snd_pcm_wait(data->alsaDeviceHandle, 1000);
     IF_ASSERT_FAILED(ret > 0) {
         return nullptr;
@@ -65,11 +74,14 @@ static void* alsaThread(void* aParam)
         uint8_t* stream = (uint8_t*)data->buffer;
         int len = data->samples * data->channels * sizeof(float);
 
-        data->callback(data->userdata, stream, len);
+        if (!data->callback(data->userdata, stream, len)) {
+            _xrunsCount++;
+        }
 
         snd_pcm_sframes_t pcm = snd_pcm_writei(data->alsaDeviceHandle, data->buffer, data->samples);
         if (pcm != -EPIPE) {
         } else {
+            _xrunsCount++;
             snd_pcm_prepare(data->alsaDeviceHandle);
         }
     }
@@ -152,6 +164,9 @@ bool LinuxAudioDriver::open(const Spec& spec, Spec* activeSpec)
     aSamplerate = val;
 
     _alsaData->buffer = new float[_alsaData->samples * _alsaData->channels];
+    if (realtime::isEnabled()) {
+        realtime::lockMemory(_alsaData->buffer, _alsaData->samples * _alsaData->channels * sizeof(float));
+    }
     //_alsaData->sampleBuffer = new short[_alsaData->samples * _alsaData->channels];
 
     if (activeSpec) {
@@ -212,3 +227,8 @@ void LinuxAudioDriver::resume()
 void LinuxAudioDriver::suspend()
 {
 }
+
+uint64_t LinuxAudioDriver::xrunsCount() const
+{
+    return _xrunsCount;
+}
@@ -42,6 +42,7 @@ public:
     async::Notification availableOutputDevicesChanged() const override;
     void resume() override;
     void suspend() override;
+    uint64_t xrunsCount() const override;
 };
 }
 
@@ -0,0 +1,278 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "nullaudiodriver.h"
+
+#include <algorithm>
+
+#include "log.h"
+#include "runtime.h"
+
+#include "internal/audiorealtime.h"
+
+using namespace mu::audio;
+
+static constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+static constexpr size_t WAV_HEADER_SIZE = 44;
+
+template<typename T>
+static void writeLittleEndian(std::ostream& stream, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        stream.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+NullAudioDriver::~NullAudioDriver()
+{
+    if (isOpened()) {
+        close();
+    }
+}
+
+std::string NullAudioDriver::name() const
+{
+    return "MUAUDIO(NULL)";
+}
+
+bool NullAudioDriver::open(const Spec& spec, Spec* activeSpec)
+{
+    IF_ASSERT_FAILED(!isOpened()) {
+        return false;
+    }
+
+    IF_ASSERT_FAILED(spec.sampleRate > 0 && spec.channels > 0 && spec.samples > 0 && m_options.speed > 0) {
+        return false;
+    }
+
+    m_spec = spec;
+    m_spec.format = Format::AudioF32;
+    m_buffer.resize(spec.samples * spec.channels, 0.f);
+
+    if (realtime::isEnabled()) {
+        realtime::lockMemory(m_buffer.data(), m_buffer.size() * sizeof(float));
+    }
+
+    if (activeSpec) {
+        *activeSpec = m_spec;
+    }
+
+    if (!m_options.wavFilePath.empty()) {
+        openWavFile();
+    }
+
+    resetStatistics();
+
+    m_running = true;
+    m_thread = std::thread([this]() { run(); });
+
+    return true;
+}
+
+void NullAudioDriver::close()
+{
+    m_running = false;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    closeWavFile();
+}
+
+bool NullAudioDriver::isOpened() const
+{
+    return m_running;
+}
+
+std::string NullAudioDriver::outputDevice() const
+{
+    return "null";
+}
+
+bool NullAudioDriver::selectOutputDevice(const std::string& name)
+{
+    return name == outputDevice();
+}
+
+std::vector<std::string> NullAudioDriver::availableOutputDevices() const
+{
+    return { outputDevice() };
+}
+
+mu::async::Notification NullAudioDriver::availableOutputDevicesChanged() const
+{
+    return mu::async::Notification();
+}
+
+void NullAudioDriver::resume()
+{
+    m_suspended = false;
+}
+
+void NullAudioDriver::suspend()
+{
+    m_suspended = true;
+}
+
+uint64_t NullAudioDriver::xrunsCount() const
+{
+    return m_xrunsCount;
+}
+
+const INullAudioDriver::Options& NullAudioDriver::options() const
+{
+    return m_options;
+}
+
+void NullAudioDriver::setOptions(const Options& options)
+{
+    IF_ASSERT_FAILED(!isOpened()) {
+        return;
+    }
+
+    m_options = options;
+}
+
+INullAudioDriver::Statistics NullAudioDriver::statistics() const
+{
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    return m_statistics;
+}
+
+void NullAudioDriver::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+    m_statistics = Statistics();
+    m_statistics.minDeadlineSlack = std::chrono::nanoseconds::max();
+}
+
+void NullAudioDriver::addRenderTime(std::chrono::nanoseconds renderTime)
+{
+    std::lock_guard<std::mutex> lock(m_statisticsMutex);
+
+    m_statistics.renderedBlocks++;
+    m_statistics.totalRenderTime += renderTime;
+    m_statistics.maxRenderTime = std::max(m_statistics.maxRenderTime, renderTime);
+}
+
+void NullAudioDriver::run()
+{
+    mu::runtime::setThreadName("audio_driver");
+
+    if (realtime::isEnabled()) {
+        realtime::promoteCurrentThread(realtime::DRIVER_THREAD_PRIORITY);
+        realtime::pinCurrentThread(realtime::audioThreadCpu(0));
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    //! NOTE The simulated device needs a block every interval and plays it until the next deadline
+    const auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(double(m_spec.samples) / m_spec.sampleRate / m_options.speed));
+
+    const int byteCount = static_cast<int>(m_buffer.size() * sizeof(float));
+    Clock::time_point deadline = Clock::now() + interval;
+
+    while (m_running) {
+        if (m_suspended) {
+            std::this_thread::sleep_for(interval);
+            deadline = Clock::now() + interval;
+            continue;
+        }
+
+        const bool rendered = m_spec.callback(m_spec.userdata, reinterpret_cast<uint8_t*>(m_buffer.data()), byteCount);
+        const Clock::time_point end = Clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(m_statisticsMutex);
+
+            const std::chrono::nanoseconds slack = deadline - end;
+
+            m_statistics.blocks++;
+            m_statistics.underruns += rendered ? 0 : 1;
+            m_statistics.missedDeadlines += slack.count() < 0 ? 1 : 0;
+            m_statistics.minDeadlineSlack = std::min(m_statistics.minDeadlineSlack, slack);
+
+            if (!rendered || slack.count() < 0) {
+                m_xrunsCount++;
+            }
+        }
+
+        if (m_wavFile.is_open()) {
+            writeWavBlock(m_buffer.data(), m_buffer.size());
+        }
+
+        std::this_thread::sleep_until(deadline);
+
+        //! NOTE A real device does not wait for a late callback, it skips the lost time
+        deadline = std::max(deadline, Clock::now()) + interval;
+    }
+}
+
+void NullAudioDriver::openWavFile()
+{
+    m_wavFile.open(m_options.wavFilePath.toStdString(), std::ios::binary | std::ios::trunc);
+    if (!m_wavFile.is_open()) {
+        LOGE() << "failed open wav file: " << m_options.wavFilePath;
+        return;
+    }
+
+    //! NOTE The sizes are written on close, when they are known
+    m_wavFile.write(std::string(WAV_HEADER_SIZE, '\0').data(), WAV_HEADER_SIZE);
+    m_wavDataSize = 0;
+}
+
+void NullAudioDriver::writeWavBlock(const float* buffer, size_t samplesCount)
+{
+    //! NOTE Samples are written as they are in memory, WAV is little-endian as the supported platforms
+    m_wavFile.write(reinterpret_cast<const char*>(buffer), samplesCount * sizeof(float));
+    m_wavDataSize += samplesCount * sizeof(float);
+}
+
+void NullAudioDriver::closeWavFile()
+{
+    if (!m_wavFile.is_open()) {
+        return;
+    }
+
+    const uint16_t channels = m_spec.channels;
+    const uint32_t sampleRate = m_spec.sampleRate;
+    const uint16_t bytesPerSample = sizeof(float);
+
+    m_wavFile.seekp(0);
+    m_wavFile.write("RIFF", 4);
+    writeLittleEndian<uint32_t>(m_wavFile, static_cast<uint32_t>(WAV_HEADER_SIZE - 8 + m_wavDataSize));
+    m_wavFile.write("WAVE", 4);
+
+    m_wavFile.write("fmt ", 4);
+    writeLittleEndian<uint32_t>(m_wavFile, 16);
+    writeLittleEndian<uint16_t>(m_wavFile, WAVE_FORMAT_IEEE_FLOAT);
+    writeLittleEndian<uint16_t>(m_wavFile, channels);
+    writeLittleEndian<uint32_t>(m_wavFile, sampleRate);
+    writeLittleEndian<uint32_t>(m_wavFile, sampleRate * channels * bytesPerSample);
+    writeLittleEndian<uint16_t>(m_wavFile, channels * bytesPerSample);
+    writeLittleEndian<uint16_t>(m_wavFile, bytesPerSample * 8);
+
+    m_wavFile.write("data", 4);
+    writeLittleEndian<uint32_t>(m_wavFile, static_cast<uint32_t>(m_wavDataSize));
+
+    m_wavFile.close();
+}
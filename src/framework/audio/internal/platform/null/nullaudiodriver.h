@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_NULLAUDIODRIVER_H
+#define MU_AUDIO_NULLAUDIODRIVER_H
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include "iaudiodriver.h"
+#include "inullaudiodriver.h"
+
+namespace mu::audio {
+class NullAudioDriver : public IAudioDriver, public INullAudioDriver
+{
+public:
+    NullAudioDriver() = default;
+    ~NullAudioDriver() override;
+
+    // IAudioDriver
+    std::string name() const override;
+    bool open(const Spec& spec, Spec* activeSpec) override;
+    void close() override;
+    bool isOpened() const override;
+
+    std::string outputDevice() const override;
+    bool selectOutputDevice(const std::string& name) override;
+    std::vector<std::string> availableOutputDevices() const override;
+    async::Notification availableOutputDevicesChanged() const override;
+    void resume() override;
+    void suspend() override;
+    uint64_t xrunsCount() const override;
+
+    // INullAudioDriver
+    const Options& options() const override;
+    void setOptions(const Options& options) override;
+
+    Statistics statistics() const override;
+    void resetStatistics() override;
+
+    //! NOTE Called by the audio worker after rendering a block
+    void addRenderTime(std::chrono::nanoseconds renderTime);
+
+private:
+    void run();
+
+    void openWavFile();
+    void writeWavBlock(const float* buffer, size_t samplesCount);
+    void closeWavFile();
+
+    Options m_options;
+    Spec m_spec;
+    std::vector<float> m_buffer;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running = false;
+    std::atomic<bool> m_suspended = false;
+    std::atomic<uint64_t> m_xrunsCount = 0;
+
+    mutable std::mutex m_statisticsMutex;
+    Statistics m_statistics;
+
+    std::ofstream m_wavFile;
+    uint64_t m_wavDataSize = 0;
+};
+}
+
+#endif // MU_AUDIO_NULLAUDIODRIVER_H
@@ -23,6 +23,7 @@
 #include "osxaudiodriver.h"
 
 #include <mutex>
+#include <atomic>
 #include <AudioToolbox/AudioToolbox.h>
 #include "log.h"
 
@@ -33,6 +34,7 @@ struct OSXAudioDriver::Data {
     AudioQueueRef audioQueue;
     Callback callback;
     void* mUserData;
+    std::atomic<uint64_t> xrunsCount { 0 };
 };
 
 OSXAudioDriver::OSXAudioDriver()
@@ -300,6 +302,11 @@ void OSXAudioDriver::suspend()
 {
 }
 
+uint64_t OSXAudioDriver::xrunsCount() const
+{
+    return m_data->xrunsCount;
+}
+
 void OSXAudioDriver::logError(const std::string message, OSStatus error)
 {
     if (error == noErr) {
@@ -350,6 +357,8 @@ void OSXAudioDriver::initDeviceMapListener()
 void OSXAudioDriver::OnFillBuffer(void* context, AudioQueueRef, AudioQueueBufferRef buffer)
 {
     Data* pData = (Data*)context;
-    pData->callback(pData->mUserData, (uint8_t*)buffer->mAudioData, buffer->mAudioDataByteSize);
+    if (!pData->callback(pData->mUserData, (uint8_t*)buffer->mAudioData, buffer->mAudioDataByteSize)) {
+        pData->xrunsCount++;
+    }
     AudioQueueEnqueueBuffer(pData->audioQueue, buffer, 0, NULL);
 }
@@ -35,6 +35,7 @@ using let = emscripten::val;
 static val context = val::global();
 static IAudioDriver::Spec* format = nullptr;
 static std::vector<float> buffer;
+static uint64_t xrunsCount = 0;
 
 void audioCallback(emscripten::val event)
 {
@@ -50,7 +51,9 @@ void audioCallback(emscripten::val event)
     if (buffer.size() != sampleCount) {
         buffer.resize(sampleCount);
     }
-    format->callback(nullptr, reinterpret_cast<uint8_t*>(buffer.data()), bytes);
+    if (!format->callback(nullptr, reinterpret_cast<uint8_t*>(buffer.data()), bytes)) {
+        xrunsCount++;
+    }
 
     for (int j = 0; j < channels; ++j) {
         let channelData = sampleBuffer.call<val>("getChannelData", j);
@@ -158,3 +161,8 @@ void WebAudioDriver::suspend()
 {
     web::context.call<val>("suspend");
 }
+
+uint64_t WebAudioDriver::xrunsCount() const
+{
+    return web::xrunsCount;
+}
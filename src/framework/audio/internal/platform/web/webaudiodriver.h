@@ -36,6 +36,7 @@ public:
     bool isOpened() const override;
     void resume() override;
     void suspend() override;
+    uint64_t xrunsCount() const override;
 
     std::string outputDevice() const override;
     bool selectOutputDevice(const std::string& name) override;
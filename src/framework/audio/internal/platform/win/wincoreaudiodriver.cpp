@@ -27,6 +27,8 @@
 #include "audioclient.h"
 #include "log.h"
 
+#include "internal/audiorealtime.h"
+
 #define REFTIMES_PER_SEC  10000000
 #define REFTIMES_PER_MILLISEC  10000
 
@@ -131,6 +133,11 @@ bool CoreAudioDriver::open(const IAudioDriver::Spec& spec, IAudioDriver::Spec* a
 
     m_active = true;
     m_thread = std::thread([this, hnsActualDuration]() {
+        if (realtime::isEnabled()) {
+            realtime::promoteCurrentThread(realtime::DRIVER_THREAD_PRIORITY);
+            realtime::pinCurrentThread(realtime::audioThreadCpu(0));
+        }
+
         BYTE* pData;
         HRESULT hr = S_OK;
         do {
@@ -147,8 +154,11 @@ bool CoreAudioDriver::open(const IAudioDriver::Spec& spec, IAudioDriver::Spec* a
             if (!pData || hr != S_OK) {
                 continue;
             }
-            s_data->callback(nullptr, reinterpret_cast<uint8_t*>(pData),
-                             bufferSize * s_data->pFormat.wBitsPerSample * s_data->pFormat.nChannels / 8);
+            bool rendered = s_data->callback(nullptr, reinterpret_cast<uint8_t*>(pData),
+                                             bufferSize * s_data->pFormat.wBitsPerSample * s_data->pFormat.nChannels / 8);
+            if (!rendered) {
+                m_xrunsCount++;
+            }
             hr = s_data->renderClient->ReleaseBuffer(bufferSize, 0);
             logError(hr);
 
@@ -297,6 +307,11 @@ void CoreAudioDriver::suspend()
 {
 }
 
+uint64_t CoreAudioDriver::xrunsCount() const
+{
+    return m_xrunsCount;
+}
+
 std::string CoreAudioDriver::outputDevice() const
 {
     NOT_IMPLEMENTED;
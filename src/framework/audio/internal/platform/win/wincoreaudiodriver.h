@@ -43,11 +43,13 @@ public:
     async::Notification availableOutputDevicesChanged() const override;
     void resume() override;
     void suspend() override;
+    uint64_t xrunsCount() const override;
 
 private:
     void clean();
 
     std::atomic<bool> m_active { false };
+    std::atomic<uint64_t> m_xrunsCount { 0 };
     std::thread m_thread;
 };
 }
@@ -28,6 +28,8 @@
 #pragma comment(lib, "winmm.lib")
 #endif
 
+#include <atomic>
+
 #include "log.h"
 
 using namespace mu::audio;
@@ -58,6 +60,7 @@ struct WinMMData
 };
 
 static WinMMData* s_winMMData = nullptr;
+static std::atomic<uint64_t> s_xrunsCount = 0;
 
 static DWORD WINAPI winMMThread(LPVOID aParam)
 {
@@ -73,7 +76,9 @@ static DWORD WINAPI winMMThread(LPVOID aParam)
 
             //data->soloud->mixSigned16(tgtBuf, data->samples);
             uint8_t* stream = (uint8_t*)tgtBuf;
-            data->callback(data->userdata, stream, data->samples * data->channels * sizeof(short));
+            if (!data->callback(data->userdata, stream, data->samples * data->channels * sizeof(short))) {
+                s_xrunsCount++;
+            }
 
             MMRESULT res = waveOutWrite(data->waveOut, &data->header[i], sizeof(WAVEHDR));
             if (MMSYSERR_NOERROR != res) {
@@ -248,3 +253,8 @@ void WinmmDriver::resume()
 void WinmmDriver::suspend()
 {
 }
+
+uint64_t WinmmDriver::xrunsCount() const
+{
+    return s_xrunsCount;
+}
@@ -32,6 +32,7 @@
 #include "log.h"
 #include "audioerrors.h"
 #include "audiotypes.h"
+#include "internal/audiorealtime.h"
 
 using namespace mu;
 using namespace mu::midi;
@@ -126,7 +127,8 @@ Ret FluidSynth::init()
     m_fluid->settings = new_fluid_settings();
     fluid_settings_setnum(m_fluid->settings, "synth.gain", FLUID_GLOBAL_VOLUME_GAIN);
     fluid_settings_setint(m_fluid->settings, "synth.audio-channels", FLUID_AUDIO_CHANNELS_PAIR); // 1 pair of audio channels
-    fluid_settings_setint(m_fluid->settings, "synth.lock-memory", 0);
+    //! NOTE In the real-time mode the loaded samples are locked in RAM to not page fault on the audio thread
+    fluid_settings_setint(m_fluid->settings, "synth.lock-memory", realtime::isEnabled() ? 1 : 0);
     fluid_settings_setint(m_fluid->settings, "synth.threadsafe-api", 0);
     fluid_settings_setint(m_fluid->settings, "synth.midi-channels", 16);
     fluid_settings_setint(m_fluid->settings, "synth.dynamic-sample-loading", 1);
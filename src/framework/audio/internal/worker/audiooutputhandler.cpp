@@ -129,10 +129,10 @@ Promise<AudioResourceMetaList> AudioOutputHandler::availableOutputResources() co
     }, AudioThread::ID);
 }
 
-Promise<AudioSignalChanges> AudioOutputHandler::signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const
+Promise<AudioSignalsMeterPtr> AudioOutputHandler::signalsMeter(const TrackSequenceId sequenceId, const TrackId trackId) const
 {
-    return Promise<AudioSignalChanges>([this, sequenceId, trackId](Promise<AudioSignalChanges>::Resolve resolve,
-                                                                   Promise<AudioSignalChanges>::Reject reject) {
+    return Promise<AudioSignalsMeterPtr>([this, sequenceId, trackId](Promise<AudioSignalsMeterPtr>::Resolve resolve,
+                                                                     Promise<AudioSignalsMeterPtr>::Reject reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         ITrackSequencePtr s = sequence(sequenceId);
@@ -147,21 +147,21 @@ Promise<AudioSignalChanges> AudioOutputHandler::signalChanges(const TrackSequenc
             return;
         }
 
-        resolve(s->audioIO()->audioSignalChanges(trackId));
+        resolve(s->audioIO()->audioSignalsMeter(trackId));
     }, AudioThread::ID);
 }
 
-Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
+Promise<AudioSignalsMeterPtr> AudioOutputHandler::masterSignalsMeter() const
 {
-    return Promise<AudioSignalChanges>([this](Promise<AudioSignalChanges>::Resolve resolve,
-                                              Promise<AudioSignalChanges>::Reject reject) {
+    return Promise<AudioSignalsMeterPtr>([this](Promise<AudioSignalsMeterPtr>::Resolve resolve,
+                                                Promise<AudioSignalsMeterPtr>::Reject reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
             reject(static_cast<int>(Err::Undefined), "undefined reference to a mixer");
         }
 
-        resolve(mixer()->masterAudioSignalChanges());
+        resolve(mixer()->masterAudioSignalsMeter());
     }, AudioThread::ID);
 }
 
@@ -49,8 +49,8 @@ public:
 
     async::Promise<AudioResourceMetaList> availableOutputResources() const override;
 
-    async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const override;
-    async::Promise<AudioSignalChanges> masterSignalChanges() const override;
+    async::Promise<AudioSignalsMeterPtr> signalsMeter(const TrackSequenceId sequenceId, const TrackId trackId) const override;
+    async::Promise<AudioSignalsMeterPtr> masterSignalsMeter() const override;
 
 private:
     std::shared_ptr<Mixer> mixer() const;
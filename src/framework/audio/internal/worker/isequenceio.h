@@ -43,10 +43,12 @@ public:
     virtual void setInputParams(const TrackId id, const AudioInputParams& params) = 0;
     virtual void setOutputParams(const TrackId id, const AudioOutputParams& params) = 0;
 
+    virtual void setMidiThruTrack(const TrackId id) = 0;
+
     virtual async::Channel<TrackId, AudioInputParams> inputParamsChanged() const = 0;
     virtual async::Channel<TrackId, AudioOutputParams> outputParamsChanged() const = 0;
 
-    virtual async::Channel<audioch_t, AudioSignalVal> audioSignalChanges(const TrackId id) const = 0;
+    virtual AudioSignalsMeterPtr audioSignalsMeter(const TrackId id) const = 0;
 };
 
 using ISequenceIOPtr = std::shared_ptr<ISequenceIO>;
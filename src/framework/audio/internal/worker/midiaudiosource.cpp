@@ -102,7 +102,11 @@ void MidiAudioSource::setupChannels()
         return;
     }
 
-    m_synth->setupMidiChannels(m_stream.controlEventsStream.val);
+    const std::vector<Event>& controlEvents = m_stream.controlEventsStream.val;
+    m_synth->setupMidiChannels(controlEvents);
+
+    //! NOTE The input is played with the first instrument of the track
+    m_midiThru.setChannel(!controlEvents.empty() && controlEvents.front().isChannelVoice() ? controlEvents.front().channel() : 0);
 }
 
 void MidiAudioSource::invalidateCaches(EventsBuffer& eventsBuffer)
@@ -270,6 +274,13 @@ bool MidiAudioSource::sendEvents(const std::vector<Event>& events)
     return true;
 }
 
+void MidiAudioSource::setMidiThruEnabled(bool enabled)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_midiThru.setEnabled(enabled);
+}
+
 void MidiAudioSource::seek(const msecs_t newPositionMsecs)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -302,6 +313,7 @@ void MidiAudioSource::applyInputParams(const AudioInputParams& requiredParams)
     });
 
     m_synth->setSampleRate(m_sampleRate);
+    m_midiThru.setSynthesizer(m_synth);
     setupChannels();
 
     m_params = m_synth->params();
@@ -362,6 +374,11 @@ bool MidiAudioSource::hasAnythingToPlayback(const msecs_t nextMsecsNumber) const
         return true;
     }
 
+    //! NOTE The input can start a note any moment and the released notes still sound for a while
+    if (m_midiThru.isEnabled()) {
+        return true;
+    }
+
     tick_t nextTicksNumber = tickFromMsec(nextMsecsNumber);
 
     return m_backgroundStreamEventsBuffer.hasEventsForNextTicks(nextTicksNumber);
@@ -35,6 +35,7 @@
 
 #include "isynthresolver.h"
 #include "track.h"
+#include "midithru.h"
 #include "audiotypes.h"
 
 namespace mu::audio {
@@ -56,6 +57,7 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
     void seek(const msecs_t newPositionMsecs) override;
+    void setMidiThruEnabled(bool enabled) override;
 
     const AudioInputParams& inputParams() const override;
     void applyInputParams(const AudioInputParams& requiredParams) override;
@@ -150,6 +152,8 @@ private:
     EventsBuffer m_mainStreamEventsBuffer;
     EventsBuffer m_backgroundStreamEventsBuffer;
 
+    MidiThru m_midiThru;
+
     unsigned int m_sampleRate = 0;
 
     struct TempoItem {
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "midithru.h"
+
+#include "log.h"
+
+#include "internal/audiosanitizer.h"
+
+using namespace mu::audio;
+using namespace mu::midi;
+
+bool MidiThru::isEnabled() const
+{
+    return m_enabled;
+}
+
+void MidiThru::setEnabled(bool enabled)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_enabled == enabled || !midiInPort()) {
+        return;
+    }
+
+    m_enabled = enabled;
+
+    //! NOTE Subscribed on the worker, so the port thread queues the events to the worker directly
+    if (m_enabled) {
+        midiInPort()->eventReceived().onReceive(this, [this](tick_t, const Event& event) {
+            onEventReceived(event);
+        });
+    } else {
+        midiInPort()->eventReceived().resetOnReceive(this);
+        releaseNotes();
+    }
+}
+
+void MidiThru::setSynthesizer(synth::ISynthesizerPtr synth)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_synth == synth) {
+        return;
+    }
+
+    releaseNotes();
+    m_synth = synth;
+}
+
+void MidiThru::setChannel(channel_t channel)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_channel == channel) {
+        return;
+    }
+
+    releaseNotes();
+    m_channel = channel;
+}
+
+bool MidiThru::hasSoundingNotes() const
+{
+    return m_soundingNotes.any();
+}
+
+void MidiThru::onEventReceived(const Event& event)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!m_synth || !event.isChannelVoice()) {
+        return;
+    }
+
+    Event e = event;
+    e.setChannel(m_channel);
+
+    if (e.opcode() == Event::Opcode::NoteOn && e.velocity() > 0) {
+        m_soundingNotes.set(e.note());
+    } else if (e.opcode() == Event::Opcode::NoteOn || e.opcode() == Event::Opcode::NoteOff) {
+        m_soundingNotes.reset(e.note());
+    }
+
+    m_synth->handleEvent(e);
+}
+
+void MidiThru::releaseNotes()
+{
+    if (!m_synth) {
+        m_soundingNotes.reset();
+        return;
+    }
+
+    for (size_t note = 0; note < m_soundingNotes.size(); ++note) {
+        if (!m_soundingNotes.test(note)) {
+            continue;
+        }
+
+        Event e(Event::Opcode::NoteOff);
+        e.setChannel(m_channel);
+        e.setNote(static_cast<uint8_t>(note));
+        m_synth->handleEvent(e);
+    }
+
+    m_soundingNotes.reset();
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_MIDITHRU_H
+#define MU_AUDIO_MIDITHRU_H
+
+#include <bitset>
+
+#include "modularity/ioc.h"
+#include "async/asyncable.h"
+#include "midi/imidiinport.h"
+
+#include "isynthesizer.h"
+
+namespace mu::audio {
+//! NOTE Plays the events of the MIDI input port on the synthesizer of a track.
+//! The events come from the port thread straight to the worker, so the monitoring
+//! does not depend on the main thread, the notation input still handles them there
+class MidiThru : public async::Asyncable
+{
+    INJECT(audio, midi::IMidiInPort, midiInPort)
+
+public:
+    MidiThru() = default;
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+    void setSynthesizer(synth::ISynthesizerPtr synth);
+    void setChannel(midi::channel_t channel);
+
+    bool hasSoundingNotes() const;
+
+private:
+    void onEventReceived(const midi::Event& event);
+    void releaseNotes();
+
+    bool m_enabled = false;
+    synth::ISynthesizerPtr m_synth = nullptr;
+    midi::channel_t m_channel = 0;
+    std::bitset<128> m_soundingNotes;
+};
+}
+
+#endif // MU_AUDIO_MIDITHRU_H
@@ -29,6 +29,7 @@
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/dspkernels.h"
 #include "audioerrors.h"
 
 using namespace mu;
@@ -36,8 +37,11 @@ using namespace mu::audio;
 using namespace mu::async;
 
 Mixer::Mixer()
+    : m_signalMeter(m_sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
+
+    updateGains();
 }
 
 Mixer::~Mixer()
@@ -97,6 +101,7 @@ void Mixer::setSampleRate(unsigned int sampleRate)
     ONLY_AUDIO_WORKER_THREAD;
 
     m_limiter = std::make_unique<dsp::Limiter>(sampleRate);
+    m_signalMeter.setSampleRate(sampleRate);
 
     AbstractAudioSource::setSampleRate(sampleRate);
 
@@ -138,7 +143,7 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 
     if (m_masterParams.muted || masterChannelSampleCount == 0) {
         for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0);
+            m_signalMeter.processSilence(audioChNum, samplesPerChannel);
         }
         return 0;
     }
@@ -184,6 +189,7 @@ void Mixer::setMasterOutputParams(const AudioOutputParams& params)
     }
 
     m_masterParams = params;
+    updateGains();
 
     m_masterFxProcessors.clear();
     m_masterFxProcessors = fxResolver()->resolveMasterFxList(params.fxChain);
@@ -199,9 +205,9 @@ Channel<AudioOutputParams> Mixer::masterOutputParamsChanged() const
     return m_masterOutputParamsChanged;
 }
 
-async::Channel<audioch_t, AudioSignalVal> Mixer::masterAudioSignalChanges() const
+AudioSignalsMeterPtr Mixer::masterAudioSignalsMeter() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_signalMeter.meter();
 }
 
 void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount)
@@ -214,13 +220,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int
         return;
     }
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        for (samples_t s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
-
-            outBuffer[idx] += inBuffer[idx];
-        }
-    }
+    dsp::mixAdd(outBuffer, inBuffer, samplesCount * audioChannelsCount());
 }
 
 void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
@@ -229,33 +229,32 @@ void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
         return;
     }
 
-    float totalSquaredSum = 0.f;
-
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+    IF_ASSERT_FAILED(audioChannelsCount() <= AudioSignalsMeter::MAX_CHANNELS) {
+        return;
+    }
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+    std::array<float, AudioSignalsMeter::MAX_CHANNELS> squaredSums;
+    std::array<float, AudioSignalsMeter::MAX_CHANNELS> peaks;
+    dsp::applyGainsAndMeasure(buffer, audioChannelsCount(), samplesPerChannel, m_gains.data(), squaredSums.data(), peaks.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    float totalSquaredSum = 0.f;
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+        totalSquaredSum += squaredSums[audioChNum];
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+        float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesPerChannel);
+        m_signalMeter.process(audioChNum, buffer, audioChannelsCount(), samplesPerChannel, rms, peaks[audioChNum]);
     }
 
     float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesPerChannel * audioChannelsCount());
     m_limiter->process(totalRms, buffer, audioChannelsCount(), samplesPerChannel);
 }
 
-void Mixer::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
+void Mixer::updateGains()
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    const float volume = dsp::linearFromDecibels(m_masterParams.volume);
+
+    for (audioch_t audioChNum = 0; audioChNum < m_gains.size(); ++audioChNum) {
+        m_gains[audioChNum] = dsp::balanceGain(m_masterParams.balance, audioChNum) * volume;
+    }
 }
@@ -31,6 +31,7 @@
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
 #include "internal/dsp/limiter.h"
+#include "internal/dsp/signalmeter.h"
 #include "ifxresolver.h"
 #include "iclock.h"
 
@@ -56,7 +57,7 @@ public:
     void setMasterOutputParams(const AudioOutputParams& params);
     async::Channel<AudioOutputParams> masterOutputParamsChanged() const;
 
-    async::Channel<audioch_t, AudioSignalVal> masterAudioSignalChanges() const;
+    AudioSignalsMeterPtr masterAudioSignalsMeter() const;
 
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
@@ -66,11 +67,12 @@ public:
 private:
     void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
-    void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void updateGains();
 
     std::vector<float> m_writeCacheBuff;
 
     AudioOutputParams m_masterParams;
+    std::array<gain_t, AudioSignalsMeter::MAX_CHANNELS> m_gains = {};
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
 
@@ -80,7 +82,7 @@ private:
     std::set<IClockPtr> m_clocks;
     audioch_t m_audioChannelsCount = 0;
 
-    mutable AudioSignalsNotifier m_audioSignalNotifier;
+    dsp::SignalMeter m_signalMeter;
 };
 
 using MixerPtr = std::shared_ptr<Mixer>;
@@ -26,6 +26,7 @@
 #include "log.h"
 
 #include "internal/dsp/audiomathutils.h"
+#include "internal/dsp/dspkernels.h"
 #include "internal/audiosanitizer.h"
 
 using namespace mu;
@@ -36,11 +37,13 @@ MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const
     : m_trackId(trackId),
     m_sampleRate(sampleRate),
     m_audioSource(std::move(source)),
-    m_compressor(std::make_unique<dsp::Compressor>(sampleRate))
+    m_compressor(std::make_unique<dsp::Compressor>(sampleRate)),
+    m_signalMeter(sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
     setSampleRate(sampleRate);
+    updateGains();
 }
 
 const AudioOutputParams& MixerChannel::outputParams() const
@@ -89,6 +92,7 @@ void MixerChannel::applyOutputParams(const AudioOutputParams& requiredParams)
     }
 
     m_params = resultParams;
+    updateGains();
     m_paramsChanges.send(std::move(resultParams));
 }
 
@@ -97,9 +101,9 @@ async::Channel<AudioOutputParams> MixerChannel::outputParamsChanged() const
     return m_paramsChanges;
 }
 
-async::Channel<audioch_t, AudioSignalVal> MixerChannel::audioSignalChanges() const
+AudioSignalsMeterPtr MixerChannel::audioSignalsMeter() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_signalMeter.meter();
 }
 
 bool MixerChannel::isActive() const
@@ -125,6 +129,7 @@ void MixerChannel::setSampleRate(unsigned int sampleRate)
     }
 
     m_audioSource->setSampleRate(sampleRate);
+    m_signalMeter.setSampleRate(sampleRate);
 
     for (IFxProcessorPtr fx : m_fxProcessors) {
         fx->setSampleRate(sampleRate);
@@ -167,7 +172,7 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         std::fill(buffer, buffer + samplesPerChannel * audioChannelsCount(), 0.f);
 
         for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-            notifyAboutAudioSignalChanges(audioChNum, 0.f);
+            m_signalMeter.processSilence(audioChNum, samplesPerChannel);
         }
 
         return processedSamplesCount;
@@ -185,36 +190,35 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
     return processedSamplesCount;
 }
 
-void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
+void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount)
 {
-    float totalSquaredSum = 0.f;
-
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
-
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+    IF_ASSERT_FAILED(audioChannelsCount() <= AudioSignalsMeter::MAX_CHANNELS) {
+        return;
+    }
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+    std::array<float, AudioSignalsMeter::MAX_CHANNELS> squaredSums;
+    std::array<float, AudioSignalsMeter::MAX_CHANNELS> peaks;
+    dsp::applyGainsAndMeasure(buffer, audioChannelsCount(), samplesCount, m_gains.data(), squaredSums.data(), peaks.data());
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+    float totalSquaredSum = 0.f;
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
-        }
+    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
+        totalSquaredSum += squaredSums[audioChNum];
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+        float rms = dsp::samplesRootMeanSquare(squaredSums[audioChNum], samplesCount);
 
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+        m_signalMeter.process(audioChNum, buffer, audioChannelsCount(), samplesCount, rms, peaks[audioChNum]);
     }
 
     float totalRms = dsp::samplesRootMeanSquare(totalSquaredSum, samplesCount * audioChannelsCount());
     m_compressor->process(totalRms, buffer, audioChannelsCount(), samplesCount);
 }
 
-void MixerChannel::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
+void MixerChannel::updateGains()
 {
-    m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
+    const float volume = dsp::linearFromDecibels(m_params.volume);
+
+    for (audioch_t audioChNum = 0; audioChNum < m_gains.size(); ++audioChNum) {
+        m_gains[audioChNum] = dsp::balanceGain(m_params.balance, audioChNum) * volume;
+    }
 }
@@ -30,6 +30,7 @@
 #include "ifxprocessor.h"
 #include "track.h"
 #include "internal/dsp/compressor.h"
+#include "internal/dsp/signalmeter.h"
 
 namespace mu::audio {
 class MixerChannel : public ITrackAudioOutput, public async::Asyncable
@@ -43,7 +44,7 @@ public:
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
     async::Channel<AudioOutputParams> outputParamsChanged() const override;
 
-    async::Channel<audioch_t, AudioSignalVal> audioSignalChanges() const override;
+    AudioSignalsMeterPtr audioSignalsMeter() const override;
 
     bool isActive() const override;
     void setIsActive(bool arg) override;
@@ -54,13 +55,14 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
 private:
-    void completeOutput(float* buffer, unsigned int samplesCount) const;
-    void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void completeOutput(float* buffer, unsigned int samplesCount);
+    void updateGains();
 
     TrackId m_trackId = -1;
 
     unsigned int m_sampleRate = 0;
     AudioOutputParams m_params;
+    std::array<gain_t, AudioSignalsMeter::MAX_CHANNELS> m_gains = {};
 
     IAudioSourcePtr m_audioSource = nullptr;
     std::vector<IFxProcessorPtr> m_fxProcessors = {};
@@ -68,7 +70,7 @@ private:
     dsp::CompressorPtr m_compressor = nullptr;
 
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
-    mutable AudioSignalsNotifier m_audioSignalNotifier;
+    dsp::SignalMeter m_signalMeter;
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
@@ -57,6 +57,11 @@ SequenceIO::SequenceIO(IGetTracks* getTracks)
 
         trackPtr->inputParamsChanged().resetOnReceive(this);
         trackPtr->outputParamsChanged().resetOnReceive(this);
+
+        if (trackPtr->id == m_midiThruTrackId) {
+            trackPtr->inputHandler->setMidiThruEnabled(false);
+            m_midiThruTrackId = -1;
+        }
     });
 }
 
@@ -134,6 +139,32 @@ void SequenceIO::setOutputParams(const TrackId id, const AudioOutputParams& para
     track->setOutputParams(params);
 }
 
+void SequenceIO::setMidiThruTrack(const TrackId id)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_getTracks) {
+        return;
+    }
+
+    if (m_midiThruTrackId == id) {
+        return;
+    }
+
+    TrackPtr previous = m_getTracks->track(m_midiThruTrackId);
+    if (previous && previous->inputHandler) {
+        previous->inputHandler->setMidiThruEnabled(false);
+    }
+
+    m_midiThruTrackId = -1;
+
+    TrackPtr track = m_getTracks->track(id);
+    if (track && track->inputHandler) {
+        track->inputHandler->setMidiThruEnabled(true);
+        m_midiThruTrackId = id;
+    }
+}
+
 Channel<TrackId, AudioInputParams> SequenceIO::inputParamsChanged() const
 {
     return m_inputParamsChanged;
@@ -144,18 +175,18 @@ Channel<TrackId, AudioOutputParams> SequenceIO::outputParamsChanged() const
     return m_outputParamsChanged;
 }
 
-Channel<audioch_t, AudioSignalVal> SequenceIO::audioSignalChanges(const TrackId id) const
+AudioSignalsMeterPtr SequenceIO::audioSignalsMeter(const TrackId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
 
     IF_ASSERT_FAILED(m_getTracks) {
-        return {};
+        return nullptr;
     }
 
     TrackPtr track = m_getTracks->track(id);
     IF_ASSERT_FAILED(track) {
-        return Channel<audioch_t, AudioSignalVal>();
+        return nullptr;
     }
 
-    return track->outputHandler->audioSignalChanges();
+    return track->outputHandler->audioSignalsMeter();
 }
@@ -43,13 +43,16 @@ public:
     void setInputParams(const TrackId id, const AudioInputParams& params) override;
     void setOutputParams(const TrackId id, const AudioOutputParams& params) override;
 
+    void setMidiThruTrack(const TrackId id) override;
+
     async::Channel<TrackId, AudioInputParams> inputParamsChanged() const override;
     async::Channel<TrackId, AudioOutputParams> outputParamsChanged() const override;
 
-    async::Channel<audioch_t, AudioSignalVal> audioSignalChanges(const TrackId id) const override;
+    AudioSignalsMeterPtr audioSignalsMeter(const TrackId id) const override;
 
 private:
     IGetTracks* m_getTracks = nullptr;
+    TrackId m_midiThruTrackId = -1;
 
     async::Channel<TrackId, AudioInputParams> m_inputParamsChanged;
     async::Channel<TrackId, AudioOutputParams> m_outputParamsChanged;
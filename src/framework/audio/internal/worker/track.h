@@ -46,6 +46,7 @@ public:
     virtual ~ITrackAudioInput() = default;
 
     virtual void seek(const msecs_t newPositionMsecs) = 0;
+    virtual void setMidiThruEnabled(bool enabled) = 0;
     virtual const AudioInputParams& inputParams() const = 0;
     virtual void applyInputParams(const AudioInputParams& requiredParams) = 0;
     virtual async::Channel<AudioInputParams> inputParamsChanged() const = 0;
@@ -60,7 +61,7 @@ public:
     virtual void applyOutputParams(const AudioOutputParams& requiredParams) = 0;
     virtual async::Channel<AudioOutputParams> outputParamsChanged() const = 0;
 
-    virtual async::Channel<audioch_t, AudioSignalVal> audioSignalChanges() const = 0;
+    virtual AudioSignalsMeterPtr audioSignalsMeter() const = 0;
 };
 
 using ITrackAudioInputPtr = std::shared_ptr<ITrackAudioInput>;
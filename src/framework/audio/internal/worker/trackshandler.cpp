@@ -224,6 +224,19 @@ Channel<TrackSequenceId, TrackId, AudioInputParams> TracksHandler::inputParamsCh
     return m_inputParamsChanged;
 }
 
+void TracksHandler::setMidiThruTrack(const TrackSequenceId sequenceId, const TrackId trackId)
+{
+    Async::call(this, [this, sequenceId, trackId]() {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        ITrackSequencePtr s = sequence(sequenceId);
+
+        if (s) {
+            s->audioIO()->setMidiThruTrack(trackId);
+        }
+    }, AudioThread::ID);
+}
+
 ITrackSequencePtr TracksHandler::sequence(const TrackSequenceId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
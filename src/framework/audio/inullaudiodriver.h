@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_INULLAUDIODRIVER_H
+#define MU_AUDIO_INULLAUDIODRIVER_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "modularity/imoduleexport.h"
+#include "io/path.h"
+
+namespace mu::audio {
+//! NOTE The audio driver without an audio device, for headless runs and benchmarks.
+//! It pulls the blocks by a simulated device clock and optionally writes them to a WAV file
+class INullAudioDriver : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(INullAudioDriver)
+
+public:
+    virtual ~INullAudioDriver() = default;
+
+    struct Options {
+        bool enabled = false;   // Use it instead of the platform audio driver
+        double speed = 1.0;     // Speed of the simulated clock: 1 - real time, greater - faster than real time
+        io::path wavFilePath;   // Write the played audio there, if not empty
+    };
+
+    struct Statistics {
+        uint64_t blocks = 0;
+        uint64_t underruns = 0;         // Blocks the engine had not rendered in time
+        uint64_t missedDeadlines = 0;   // Blocks whose callback returned after the device needed them
+        uint64_t renderedBlocks = 0;    // Blocks rendered by the audio worker, not of the device size
+        std::chrono::nanoseconds totalRenderTime { 0 };   // Time the worker spent rendering them
+        std::chrono::nanoseconds maxRenderTime { 0 };
+        std::chrono::nanoseconds minDeadlineSlack { 0 };   // The least time left before a deadline, negative if missed
+    };
+
+    //! NOTE Must be set before the audio module is initialized
+    virtual const Options& options() const = 0;
+    virtual void setOptions(const Options& options) = 0;
+
+    virtual Statistics statistics() const = 0;
+    virtual void resetStatistics() = 0;
+};
+}
+
+#endif // MU_AUDIO_INULLAUDIODRIVER_H
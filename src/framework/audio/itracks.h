@@ -55,6 +55,10 @@ public:
     virtual async::Promise<AudioInputParams> inputParams(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
     virtual void setInputParams(const TrackSequenceId sequenceId, const TrackId trackId, const AudioInputParams& params) = 0;
     virtual async::Channel<TrackSequenceId, TrackId, AudioInputParams> inputParamsChanged() const = 0;
+
+    //! NOTE Plays the events of the MIDI input port with the track's synthesizer directly on the worker,
+    //! an invalid track id switches it off
+    virtual void setMidiThruTrack(const TrackSequenceId sequenceId, const TrackId trackId) = 0;
 };
 
 using ITracksPtr = std::shared_ptr<ITracks>;
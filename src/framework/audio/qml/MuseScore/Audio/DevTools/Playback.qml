@@ -34,6 +34,8 @@ Rectangle {
     WaveFormModel {
         id: waveModel
 
+        metersActive: root.visible
+
         onCurrentSignalAmplitudeChanged: {
             waveView.requestPaint()
         }
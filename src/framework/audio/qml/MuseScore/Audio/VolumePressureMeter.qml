@@ -29,6 +29,7 @@ Canvas {
     id: root
 
     property real currentVolumePressure: -60.0
+    property real currentPeak: -60.0
     property real minDisplayedVolumePressure: -60.0
     property real maxDisplayedVolumePressure: 0.0
 
@@ -45,6 +46,7 @@ Canvas {
 
         readonly property real indicatorHeight: 140
         readonly property real indicatorWidth: 6
+        readonly property real peakMarkerHeight: 1
 
         // value ranges
         readonly property int fullValueRangeLength: Math.abs(root.minDisplayedVolumePressure) + Math.abs(root.maxDisplayedVolumePressure)
@@ -148,6 +150,13 @@ Canvas {
         ctx.fillStyle = prv.gradient
         ctx.fillRect(prv.overloadHeight, 0, prv.divisionPixels * (prv.fullValueRangeLength - Math.abs(root.currentVolumePressure)), prv.indicatorWidth)
 
+        if (root.currentPeak > root.minDisplayedVolumePressure) {
+            var peakPos = prv.overloadHeight + prv.divisionPixels * (prv.fullValueRangeLength - Math.abs(root.currentPeak))
+
+            ctx.fillStyle = ui.theme.fontPrimaryColor
+            ctx.fillRect(Math.min(peakPos, prv.indicatorHeight - prv.peakMarkerHeight), 0, prv.peakMarkerHeight, prv.indicatorWidth)
+        }
+
         if (prv.rulerNeedsPaint) {
             var originVPos = prv.overloadHeight
             var originHPos = prv.indicatorWidth + prv.strokeHorizontalMargin
@@ -160,6 +169,10 @@ Canvas {
         requestPaint()
     }
 
+    onCurrentPeakChanged: {
+        requestPaint()
+    }
+
     Component.onCompleted: {
         prv.rulerNeedsPaint = true
         requestPaint()
@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "internal/audiobuffer.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+namespace {
+//! NOTE Renders the sequence 0, 1, 2... so that the read samples show what was skipped or repeated
+class CountingSource : public IAudioSource
+{
+public:
+    CountingSource(audioch_t audioChannelsCount)
+        : m_audioChannelsCount(audioChannelsCount) {}
+
+    bool isActive() const override { return true; }
+    void setIsActive(bool) override {}
+    void setSampleRate(unsigned int) override {}
+    unsigned int audioChannelsCount() const override { return m_audioChannelsCount; }
+    async::Channel<unsigned int> audioChannelsCountChanged() const override { return {}; }
+
+    samples_t process(float* buffer, samples_t samplesPerChannel) override
+    {
+        for (samples_t i = 0; i < samplesPerChannel * m_audioChannelsCount; ++i) {
+            buffer[i] = static_cast<float>(m_next++);
+        }
+
+        m_processCount++;
+        return samplesPerChannel;
+    }
+
+    int processCount() const { return m_processCount; }
+
+private:
+    audioch_t m_audioChannelsCount = 0;
+    int m_next = 0;
+    int m_processCount = 0;
+};
+}
+
+class AudioBufferTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_source = std::make_shared<CountingSource>(CHANNELS);
+
+        m_buffer.init(CHANNELS, 8192);
+        m_buffer.setMinSampleLag(1024);
+        m_buffer.setSource(m_source);
+    }
+
+    static constexpr audioch_t CHANNELS = 2;
+
+    AudioBuffer m_buffer;
+    std::shared_ptr<CountingSource> m_source;
+};
+
+TEST_F(AudioBufferTests, PopAcrossWrapAround)
+{
+    std::vector<float> dest(1000 * CHANNELS);
+    int expected = 0;
+
+    //! [WHEN] The blocks are read in time, several times around the ring
+    for (int block = 0; block < 100; ++block) {
+        m_buffer.forward();
+
+        //! [THEN] Every block is rendered and the samples follow each other
+        ASSERT_TRUE(m_buffer.pop(dest.data(), 1000)) << "block: " << block;
+
+        for (float sample : dest) {
+            ASSERT_EQ(sample, static_cast<float>(expected++)) << "block: " << block;
+        }
+    }
+}
+
+TEST_F(AudioBufferTests, PopAfterUnderrun)
+{
+    //! [GIVEN] The worker rendered 2048 samples ahead
+    m_buffer.forward();
+    ASSERT_EQ(m_source->processCount(), 2);
+
+    //! [WHEN] The driver asks for more
+    std::vector<float> dest(4096 * CHANNELS, -1.f);
+    bool rendered = m_buffer.pop(dest.data(), 4096);
+
+    //! [THEN] It is an underrun, the rendered samples are read and the rest is silence
+    EXPECT_FALSE(rendered);
+
+    for (size_t i = 0; i < dest.size(); ++i) {
+        float expected = i < 2048 * CHANNELS ? static_cast<float>(i) : 0.f;
+        ASSERT_EQ(dest[i], expected) << "index: " << i;
+    }
+
+    //! [WHEN] The worker catches up
+    m_buffer.forward();
+
+    //! [THEN] The buffer is empty rather than wrapped around, so it is filled up again
+    EXPECT_EQ(m_source->processCount(), 4);
+
+    //! [THEN] The next block is rendered and continues right after the read samples
+    std::vector<float> next(1024 * CHANNELS);
+    EXPECT_TRUE(m_buffer.pop(next.data(), 1024));
+    EXPECT_EQ(next.front(), static_cast<float>(2048 * CHANNELS));
+    EXPECT_EQ(next.back(), static_cast<float>(3072 * CHANNELS - 1));
+}
@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "internal/dsp/dspkernels.h"
+
+//! NOTE Built with BUILD_BENCHMARKS only, the results are reported as test properties
+//! (see --gtest_output=xml)
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+namespace {
+std::vector<float> randomSamples(size_t count)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    std::vector<float> result(count);
+    for (float& sample : result) {
+        sample = distribution(generator);
+    }
+
+    return result;
+}
+}
+
+TEST(DspKernelsBenchmark, MixerBlock)
+{
+    //! [GIVEN] A stereo block of the typical size and a few tracks to mix
+    const samples_t samplesPerChannel = 512;
+    const audioch_t audioChannelsCount = 2;
+    const size_t count = samplesPerChannel * audioChannelsCount;
+    const int tracksCount = 8;
+    const int iterations = 2000;
+    const float gains[] = { 0.8f, 0.6f };
+
+    const std::vector<float> track = randomSamples(count);
+
+    ::testing::Test::RecordProperty("tracks", tracksCount);
+    ::testing::Test::RecordProperty("samples_per_channel", int(samplesPerChannel));
+
+    for (InstructionSet set : { InstructionSet::Scalar, InstructionSet::SSE, InstructionSet::AVX, InstructionSet::NEON }) {
+        if (!isSupported(set)) {
+            continue;
+        }
+
+        const Kernels& k = kernels(set);
+        std::vector<float> channel(count);
+        std::vector<float> master(count);
+        float sums[2] = {};
+        float peaks[2] = {};
+
+        //! [WHEN] Process the blocks as the mixer does: every track gets its gains and meters, then is mixed into the master
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+
+        for (int i = 0; i < iterations; ++i) {
+            std::fill(master.begin(), master.end(), 0.f);
+
+            for (int t = 0; t < tracksCount; ++t) {
+                std::copy(track.begin(), track.end(), channel.begin());
+                k.applyGainsAndMeasure(channel.data(), audioChannelsCount, samplesPerChannel, gains, sums, peaks);
+                k.mixAdd(master.data(), channel.data(), count);
+            }
+
+            k.applyGainsAndMeasure(master.data(), audioChannelsCount, samplesPerChannel, gains, sums, peaks);
+            k.applyGain(master.data(), count, 0.9f);
+        }
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+
+        //! [THEN] Something was measured
+        EXPECT_GT(peaks[0], 0.f);
+
+        ::testing::Test::RecordProperty(instructionSetName(set) + "_ns_per_block", int(elapsed / iterations));
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "internal/dsp/dspkernels.h"
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+namespace {
+const std::vector<InstructionSet> ALL_SETS = { InstructionSet::SSE, InstructionSet::AVX, InstructionSet::NEON };
+
+std::vector<float> randomSamples(size_t count)
+{
+    static std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    std::vector<float> result(count);
+    for (float& sample : result) {
+        sample = distribution(generator);
+    }
+
+    return result;
+}
+}
+
+class DspKernelsTests : public ::testing::Test
+{
+protected:
+    const Kernels& scalar() const
+    {
+        return kernels(InstructionSet::Scalar);
+    }
+};
+
+TEST_F(DspKernelsTests, MixAddMatchesScalar)
+{
+    //! [GIVEN] Buffers whose size is not a multiple of any vector width
+    const size_t count = 1027;
+    const std::vector<float> src = randomSamples(count);
+    const std::vector<float> dst = randomSamples(count);
+
+    std::vector<float> expected = dst;
+    scalar().mixAdd(expected.data(), src.data(), count);
+
+    for (InstructionSet set : ALL_SETS) {
+        if (!isSupported(set)) {
+            continue;
+        }
+
+        //! [WHEN] Mix them with the vectorized kernel
+        std::vector<float> actual = dst;
+        kernels(set).mixAdd(actual.data(), src.data(), count);
+
+        //! [THEN] The result is the same as the scalar one
+        EXPECT_EQ(actual, expected) << instructionSetName(set);
+    }
+}
+
+TEST_F(DspKernelsTests, ApplyGainMatchesScalar)
+{
+    //! [GIVEN] A buffer whose size is not a multiple of any vector width
+    const size_t count = 1027;
+    const std::vector<float> buffer = randomSamples(count);
+
+    std::vector<float> expected = buffer;
+    scalar().applyGain(expected.data(), count, 0.7f);
+
+    for (InstructionSet set : ALL_SETS) {
+        if (!isSupported(set)) {
+            continue;
+        }
+
+        //! [WHEN] Apply the gain with the vectorized kernel
+        std::vector<float> actual = buffer;
+        kernels(set).applyGain(actual.data(), count, 0.7f);
+
+        //! [THEN] The result is the same as the scalar one
+        EXPECT_EQ(actual, expected) << instructionSetName(set);
+    }
+}
+
+TEST_F(DspKernelsTests, ApplyGainsAndMeasureMatchesScalar)
+{
+    const samples_t samplesPerChannel = 509;
+    const float gains[] = { 0.9f, 0.4f, 1.f, 0.25f, 0.5f, 0.75f, 0.1f, 0.6f };
+
+    //! [GIVEN] Interleaved buffers with the different audio channels counts
+    for (audioch_t audioChannelsCount : { 1, 2, 3, 4, 6, 8 }) {
+        const std::vector<float> buffer = randomSamples(samplesPerChannel * audioChannelsCount);
+
+        std::vector<float> expected = buffer;
+        float expectedSums[8] = {};
+        float expectedPeaks[8] = {};
+        scalar().applyGainsAndMeasure(expected.data(), audioChannelsCount, samplesPerChannel, gains, expectedSums, expectedPeaks);
+
+        for (InstructionSet set : ALL_SETS) {
+            if (!isSupported(set)) {
+                continue;
+            }
+
+            //! [WHEN] Apply the gains and measure with the vectorized kernel
+            std::vector<float> actual = buffer;
+            float sums[8] = {};
+            float peaks[8] = {};
+            kernels(set).applyGainsAndMeasure(actual.data(), audioChannelsCount, samplesPerChannel, gains, sums, peaks);
+
+            //! [THEN] The samples and the peaks are the same as the scalar ones
+            EXPECT_EQ(actual, expected) << instructionSetName(set) << ", channels: " << int(audioChannelsCount);
+
+            for (audioch_t ch = 0; ch < audioChannelsCount; ++ch) {
+                EXPECT_EQ(peaks[ch], expectedPeaks[ch]) << instructionSetName(set) << ", channel: " << int(ch);
+
+                //! [THEN] The squared sums differ only by the order of the additions
+                EXPECT_NEAR(sums[ch], expectedSums[ch], expectedSums[ch] * 1e-4f) << instructionSetName(set) << ", channel: " << int(ch);
+            }
+        }
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "internal/worker/midithru.h"
+#include "internal/audiosanitizer.h"
+#include "midi/internal/dummymidiinport.h"
+
+#include "mocks/synthesizermock.h"
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::Truly;
+using ::testing::InSequence;
+
+using namespace mu;
+using namespace mu::audio;
+using namespace mu::audio::synth;
+using namespace mu::midi;
+
+class MidiThruTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        //! NOTE The test thread plays the worker, the port sends from it too
+        AudioSanitizer::setupWorkerThread();
+
+        m_port = std::make_shared<DummyMidiInPort>();
+        m_port->connect("dummy");
+
+        m_synth = std::make_shared<SynthesizerMock>();
+        ON_CALL(*m_synth, handleEvent(_)).WillByDefault(Return(true));
+
+        m_thru = std::make_shared<MidiThru>();
+        m_thru->setmidiInPort(m_port);
+        m_thru->setSynthesizer(m_synth);
+        m_thru->setChannel(3);
+    }
+
+    void TearDown() override
+    {
+        m_thru = nullptr;
+    }
+
+    static Event noteOn(uint8_t note)
+    {
+        return Event::fromMIDI10Package(0x90 | (note << 8) | (100 << 16)).toMIDI20();
+    }
+
+    static Event noteOff(uint8_t note)
+    {
+        return Event::fromMIDI10Package(0x80 | (note << 8)).toMIDI20();
+    }
+
+    static auto isNote(Event::Opcode opcode, uint8_t note, channel_t channel)
+    {
+        return Truly([opcode, note, channel](const Event& e) {
+            return e.opcode() == opcode && e.note() == note && e.channel() == channel;
+        });
+    }
+
+    std::shared_ptr<DummyMidiInPort> m_port;
+    std::shared_ptr<SynthesizerMock> m_synth;
+    std::shared_ptr<MidiThru> m_thru;
+};
+
+TEST_F(MidiThruTests, EventsAreNotPlayedWhenDisabled)
+{
+    //! [GIVEN] The thru is not enabled
+    EXPECT_CALL(*m_synth, handleEvent(_)).Times(0);
+
+    //! [WHEN] The port receives a note
+    m_port->simulateEventReceived(0, noteOn(60));
+
+    //! [THEN] Nothing is played
+    EXPECT_FALSE(m_thru->hasSoundingNotes());
+}
+
+TEST_F(MidiThruTests, EventsArePlayedOnTheTrackChannel)
+{
+    //! [GIVEN] The thru is enabled
+    m_thru->setEnabled(true);
+
+    //! [THEN] The notes come to the synth on the channel of the track
+    {
+        InSequence seq;
+        EXPECT_CALL(*m_synth, handleEvent(isNote(Event::Opcode::NoteOn, 60, 3))).Times(1);
+        EXPECT_CALL(*m_synth, handleEvent(isNote(Event::Opcode::NoteOff, 60, 3))).Times(1);
+    }
+
+    //! [WHEN] The port receives a note on
+    m_port->simulateEventReceived(0, noteOn(60));
+    EXPECT_TRUE(m_thru->hasSoundingNotes());
+
+    //! [WHEN] And the note off
+    m_port->simulateEventReceived(10, noteOff(60));
+    EXPECT_FALSE(m_thru->hasSoundingNotes());
+}
+
+TEST_F(MidiThruTests, HeldNotesAreReleasedWhenDisabled)
+{
+    //! [GIVEN] The thru is enabled and a key is held
+    m_thru->setEnabled(true);
+
+    EXPECT_CALL(*m_synth, handleEvent(isNote(Event::Opcode::NoteOn, 64, 3))).Times(1);
+    m_port->simulateEventReceived(0, noteOn(64));
+
+    //! [THEN] The held note is released
+    EXPECT_CALL(*m_synth, handleEvent(isNote(Event::Opcode::NoteOff, 64, 3))).Times(1);
+
+    //! [WHEN] The thru is switched off
+    m_thru->setEnabled(false);
+    EXPECT_FALSE(m_thru->hasSoundingNotes());
+
+    //! [THEN] The next events are not played anymore
+    m_port->simulateEventReceived(10, noteOn(65));
+}
+
+TEST_F(MidiThruTests, HeldNotesAreReleasedOnTheOldSynth)
+{
+    //! [GIVEN] The thru is enabled and a key is held
+    m_thru->setEnabled(true);
+
+    EXPECT_CALL(*m_synth, handleEvent(isNote(Event::Opcode::NoteOn, 67, 3))).Times(1);
+    m_port->simulateEventReceived(0, noteOn(67));
+
+    //! [THEN] The old synth gets the note off, the new one does not
+    EXPECT_CALL(*m_synth, handleEvent(isNote(Event::Opcode::NoteOff, 67, 3))).Times(1);
+
+    auto newSynth = std::make_shared<SynthesizerMock>();
+    EXPECT_CALL(*newSynth, handleEvent(_)).Times(0);
+
+    //! [WHEN] The track gets another synth
+    m_thru->setSynthesizer(newSynth);
+    EXPECT_FALSE(m_thru->hasSoundingNotes());
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_SYNTHESIZERMOCK_H
+#define MU_AUDIO_SYNTHESIZERMOCK_H
+
+#include <gmock/gmock.h>
+
+#include "isynthesizer.h"
+
+namespace mu::audio::synth {
+class SynthesizerMock : public ISynthesizer
+{
+public:
+    MOCK_METHOD(bool, isActive, (), (const, override));
+    MOCK_METHOD(void, setIsActive, (bool), (override));
+    MOCK_METHOD(void, setSampleRate, (unsigned int), (override));
+    MOCK_METHOD(unsigned int, audioChannelsCount, (), (const, override));
+    MOCK_METHOD(async::Channel<unsigned int>, audioChannelsCountChanged, (), (const, override));
+    MOCK_METHOD(samples_t, process, (float*, samples_t), (override));
+
+    MOCK_METHOD(bool, isValid, (), (const, override));
+    MOCK_METHOD(std::string, name, (), (const, override));
+    MOCK_METHOD(AudioSourceType, type, (), (const, override));
+    MOCK_METHOD(const audio::AudioInputParams&, params, (), (const, override));
+    MOCK_METHOD(async::Channel<audio::AudioInputParams>, paramsChanged, (), (const, override));
+    MOCK_METHOD(SoundFontFormats, soundFontFormats, (), (const, override));
+
+    MOCK_METHOD(Ret, init, (), (override));
+    MOCK_METHOD(Ret, addSoundFonts, (const std::vector<io::path>&), (override));
+    MOCK_METHOD(Ret, removeSoundFonts, (), (override));
+
+    MOCK_METHOD(Ret, setupMidiChannels, (const std::vector<midi::Event>&), (override));
+    MOCK_METHOD(bool, handleEvent, (const midi::Event&), (override));
+
+    MOCK_METHOD(void, allSoundsOff, (), (override));
+    MOCK_METHOD(void, flushSound, (), (override));
+    MOCK_METHOD(void, midiChannelSoundsOff, (midi::channel_t), (override));
+    MOCK_METHOD(bool, midiChannelVolume, (midi::channel_t, float), (override));
+    MOCK_METHOD(bool, midiChannelBalance, (midi::channel_t, float), (override));
+    MOCK_METHOD(bool, midiChannelPitch, (midi::channel_t, int16_t), (override));
+};
+}
+
+#endif // MU_AUDIO_SYNTHESIZERMOCK_H
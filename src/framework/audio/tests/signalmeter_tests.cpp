@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "internal/dsp/signalmeter.h"
+#include "internal/dsp/audiomathutils.h"
+
+using namespace mu::audio;
+using namespace mu::audio::dsp;
+
+static constexpr unsigned int SAMPLE_RATE = 48000;
+static constexpr samples_t BLOCK_SIZE = 512;
+
+class SignalMeterTests : public ::testing::Test
+{
+protected:
+    //! NOTE Process a mono block, the true peak is only measured from the buffer
+    void process(const audioch_t audioChNumber, const float linearRms, const float linearPeak)
+    {
+        std::vector<float> buffer(BLOCK_SIZE * AudioSignalsMeter::MAX_CHANNELS, 0.f);
+        m_signalMeter.process(audioChNumber, buffer.data(), AudioSignalsMeter::MAX_CHANNELS, BLOCK_SIZE, linearRms, linearPeak);
+    }
+
+    AudioSignalVal take(const audioch_t audioChNumber)
+    {
+        return m_signalMeter.meter()->takeSignalValue(audioChNumber);
+    }
+
+    SignalMeter m_signalMeter { SAMPLE_RATE };
+};
+
+TEST_F(SignalMeterTests, ProcessPublishesValues)
+{
+    //! [WHEN] A block with a known RMS and peak is processed
+    process(0, 0.5f, 0.9f);
+
+    //! [THEN] The meter exposes the RMS, its level in dBFS and the peak
+    AudioSignalVal val = take(0);
+    EXPECT_FLOAT_EQ(val.amplitude, 0.5f);
+    EXPECT_FLOAT_EQ(val.pressure, dbFromSample(0.5f));
+    EXPECT_FLOAT_EQ(val.peak, 0.9f);
+}
+
+TEST_F(SignalMeterTests, PressureIsClampedToMinimumLevel)
+{
+    //! [WHEN] A block which is almost silent is processed
+    process(0, 1e-12f, 1e-12f);
+
+    //! [THEN] The level does not go below the minimum operable one
+    EXPECT_FLOAT_EQ(take(0).pressure, MINIMUM_OPERABLE_DBFS_LEVEL);
+}
+
+TEST_F(SignalMeterTests, ProcessSilenceResetsValues)
+{
+    //! [GIVEN] A channel which had a signal, already read by the UI
+    process(1, 0.5f, 0.9f);
+    take(1);
+
+    //! [WHEN] Silence is processed
+    m_signalMeter.processSilence(1, BLOCK_SIZE);
+
+    //! [THEN] The values are reset
+    AudioSignalVal val = take(1);
+    EXPECT_FLOAT_EQ(val.amplitude, 0.f);
+    EXPECT_FLOAT_EQ(val.pressure, MINIMUM_OPERABLE_DBFS_LEVEL);
+    EXPECT_FLOAT_EQ(val.peak, 0.f);
+}
+
+TEST_F(SignalMeterTests, PeakIsKeptUntilRead)
+{
+    //! [WHEN] A short peak is followed by quieter blocks before the UI reads the meter
+    process(0, 0.5f, 0.9f);
+    process(0, 0.1f, 0.2f);
+    m_signalMeter.processSilence(0, BLOCK_SIZE);
+
+    //! [THEN] The first read reports the peak, the level is the latest one
+    AudioSignalVal val = take(0);
+    EXPECT_FLOAT_EQ(val.peak, 0.9f);
+    EXPECT_FLOAT_EQ(val.amplitude, 0.f);
+
+    //! [THEN] The read resets the peak
+    EXPECT_FLOAT_EQ(take(0).peak, 0.f);
+}
+
+TEST_F(SignalMeterTests, PeakHold)
+{
+    //! [GIVEN] Peak hold is enabled
+    m_signalMeter.meter()->setPeakHoldEnabled(true);
+
+    //! [WHEN] A peak is followed by a quieter block
+    process(0, 0.5f, 0.9f);
+    take(0);
+    process(0, 0.1f, 0.2f);
+
+    //! [THEN] The peak is still reported
+    EXPECT_FLOAT_EQ(take(0).peak, 0.9f);
+
+    //! [WHEN] The hold time has passed
+    for (samples_t s = 0; s < SAMPLE_RATE * 2; s += BLOCK_SIZE) {
+        process(0, 0.1f, 0.2f);
+    }
+    take(0);
+    process(0, 0.1f, 0.2f);
+
+    //! [THEN] The current peak is reported
+    EXPECT_FLOAT_EQ(take(0).peak, 0.2f);
+}
+
+TEST_F(SignalMeterTests, TruePeak)
+{
+    //! [GIVEN] True peak is enabled
+    m_signalMeter.meter()->setTruePeakEnabled(true);
+
+    //! [WHEN] A sine at a quarter of the sample rate is sampled between its crests
+    std::vector<float> buffer(BLOCK_SIZE);
+    float samplePeak = 0.f;
+    for (samples_t s = 0; s < BLOCK_SIZE; ++s) {
+        buffer[s] = float(std::sin(M_PI / 2 * s + M_PI / 4));
+        samplePeak = std::max(samplePeak, std::abs(buffer[s]));
+    }
+    m_signalMeter.process(0, buffer.data(), 1, BLOCK_SIZE, samplePeak / std::sqrt(2.f), samplePeak);
+
+    //! [THEN] The true peak is above the sample peak and close to the crest
+    AudioSignalVal val = take(0);
+    EXPECT_FLOAT_EQ(val.peak, samplePeak);
+    EXPECT_GT(val.truePeak, samplePeak);
+    EXPECT_NEAR(val.truePeak, 1.f, 0.05f);
+}
+
+TEST_F(SignalMeterTests, ChannelsAreIndependent)
+{
+    //! [WHEN] The channels get different signals
+    process(0, 0.5f, 0.9f);
+    process(1, 0.25f, 0.3f);
+
+    //! [THEN] Each channel keeps its own values
+    EXPECT_FLOAT_EQ(take(0).amplitude, 0.5f);
+    AudioSignalVal val = take(1);
+    EXPECT_FLOAT_EQ(val.amplitude, 0.25f);
+    EXPECT_FLOAT_EQ(val.peak, 0.3f);
+}
+
+TEST_F(SignalMeterTests, ChannelOutOfRangeIsIgnored)
+{
+    //! [WHEN] A channel beyond the supported count is processed
+    process(AudioSignalsMeter::MAX_CHANNELS, 0.5f, 0.9f);
+
+    //! [THEN] Nothing is published for it
+    AudioSignalVal val = take(AudioSignalsMeter::MAX_CHANNELS);
+    EXPECT_FLOAT_EQ(val.amplitude, 0.f);
+    EXPECT_FLOAT_EQ(val.peak, 0.f);
+}
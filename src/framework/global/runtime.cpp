@@ -22,11 +22,15 @@
 
 #include "runtime.h"
 
+#include "log.h"
+
 static thread_local std::string s_threadName;
 
 void mu::runtime::setThreadName(const std::string& name)
 {
     s_threadName = name;
+
+    TRACE_THREAD_NAME(name);
 }
 
 const std::string& mu::runtime::threadName()
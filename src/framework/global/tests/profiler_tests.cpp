@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "thirdparty/haw_profiler/src/profiler.h"
+
+using namespace haw::profiler;
+
+class ProfilerTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        Profiler::instance()->clearTrace();
+        Profiler::instance()->setTraceEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        Profiler::instance()->setTraceEnabled(false);
+        Profiler::instance()->clearTrace();
+    }
+
+    static QJsonArray traceEvents()
+    {
+        QJsonParseError error;
+        QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(Profiler::instance()->traceJson()), &error);
+        EXPECT_EQ(error.error, QJsonParseError::NoError) << error.errorString().toStdString();
+
+        return doc.object().value("traceEvents").toArray();
+    }
+};
+
+TEST_F(ProfilerTests, TraceWrapsAround)
+{
+    //! [GIVEN] More counter values than a thread buffer holds
+    const size_t capacity = Profiler::options().traceEventsPerThread;
+    const int count = static_cast<int>(capacity + capacity / 2);
+
+    //! [WHEN] A thread records them
+    std::thread th([count]() {
+        for (int i = 1; i <= count; ++i) {
+            TRACE_COUNTER("profiler test counter", i);
+        }
+    });
+    th.join();
+
+    //! [THEN] Only the newest values are exported, in order, and the slot that could be written at the moment is dropped
+    std::vector<int> values;
+    for (const QJsonValue& event : traceEvents()) {
+        QJsonObject obj = event.toObject();
+        if (obj.value("name").toString() == "profiler test counter") {
+            values.push_back(obj.value("args").toObject().value("value").toInt());
+        }
+    }
+
+    ASSERT_EQ(values.size(), capacity - 1);
+    EXPECT_EQ(values.front(), count - static_cast<int>(capacity) + 2);
+    EXPECT_EQ(values.back(), count);
+
+    for (size_t i = 1; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], values[i - 1] + 1);
+    }
+}
+
+TEST_F(ProfilerTests, TraceJsonExport)
+{
+    //! [WHEN] A named thread records a scope whose name needs escaping
+    std::thread th([]() {
+        TRACE_THREAD_NAME("profiler test thread");
+        TRACEFUNC_C("profiler \"test\" scope");
+    });
+    th.join();
+
+    //! [THEN] The export is valid JSON with the thread name and the begin and end of the scope in that thread
+    int tid = -1;
+    QJsonArray scopeEvents;
+    for (const QJsonValue& event : traceEvents()) {
+        QJsonObject obj = event.toObject();
+        if (obj.value("ph").toString() == "M" && obj.value("args").toObject().value("name").toString() == "profiler test thread") {
+            tid = obj.value("tid").toInt();
+        } else if (obj.value("name").toString() == "profiler \"test\" scope") {
+            scopeEvents.append(obj);
+        }
+    }
+
+    ASSERT_NE(tid, -1);
+    ASSERT_EQ(scopeEvents.size(), 2);
+
+    QJsonObject begin = scopeEvents.at(0).toObject();
+    QJsonObject end = scopeEvents.at(1).toObject();
+    EXPECT_EQ(begin.value("ph").toString(), "B");
+    EXPECT_EQ(end.value("ph").toString(), "E");
+    EXPECT_EQ(begin.value("tid").toInt(), tid);
+    EXPECT_EQ(end.value("tid").toInt(), tid);
+    EXPECT_LE(begin.value("ts").toDouble(), end.value("ts").toDouble());
+}
@@ -0,0 +1,124 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "thirdparty/deto_async/async/internal/queuedinvoker.h"
+
+//! NOTE Built with BUILD_BENCHMARKS only, the results are reported as test properties
+//! (see --gtest_output=xml)
+
+using namespace deto::async;
+
+namespace {
+//! NOTE A thread that processes its queued messages once started
+class Worker
+{
+public:
+    Worker()
+        : m_thread([this]() { loop(); }) {}
+
+    ~Worker()
+    {
+        m_running = false;
+        m_thread.join();
+    }
+
+    std::thread::id id() const { return m_thread.get_id(); }
+    void start() { m_processing = true; }
+
+private:
+    void loop()
+    {
+        while (m_running) {
+            if (m_processing) {
+                QueuedInvoker::instance()->processEvents();
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic<bool> m_running { true };
+    std::atomic<bool> m_processing { false };
+    std::thread m_thread;
+};
+
+bool waitFor(const std::atomic<bool>& flag)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!flag && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    return flag;
+}
+}
+
+TEST(QueuedInvokerBenchmark, RoundTripLatency)
+{
+    //! [GIVEN] Two running workers
+    Worker ping;
+    Worker pong;
+    ping.start();
+    pong.start();
+
+    //! [WHEN] Send a message from ping to pong and back, many times
+    using Clock = std::chrono::steady_clock;
+    const int count = 20000;
+    std::vector<Clock::duration> latencies;
+    latencies.reserve(count);
+    std::atomic<bool> done { false };
+
+    QueuedInvoker* invoker = QueuedInvoker::instance();
+    std::function<void()> roundTrip = [&]() {
+        if (int(latencies.size()) == count) {
+            done = true;
+            return;
+        }
+        const Clock::time_point start = Clock::now();
+        invoker->invoke(pong.id(), [&, start]() {
+            invoker->invoke(ping.id(), [&, start]() {
+                latencies.push_back(Clock::now() - start);
+                roundTrip();
+            });
+        });
+    };
+    invoker->invoke(ping.id(), roundTrip);
+
+    //! [THEN] All round trips are done
+    ASSERT_TRUE(waitFor(done));
+    ASSERT_EQ(int(latencies.size()), count);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto ns = [](Clock::duration d) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    };
+    ::testing::Test::RecordProperty("round_trips", count);
+    ::testing::Test::RecordProperty("median_ns", int(ns(latencies[count / 2])));
+    ::testing::Test::RecordProperty("p99_ns", int(ns(latencies[count * 99 / 100])));
+    ::testing::Test::RecordProperty("max_ns", int(ns(latencies.back())));
+}
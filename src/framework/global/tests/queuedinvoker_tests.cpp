@@ -0,0 +1,235 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "thirdparty/deto_async/async/async.h"
+#include "thirdparty/deto_async/async/internal/queuedinvoker.h"
+
+using namespace deto::async;
+
+namespace {
+//! NOTE A thread that processes its queued messages once started
+class Worker
+{
+public:
+    Worker()
+        : m_thread([this]() { loop(); }) {}
+
+    ~Worker()
+    {
+        m_running = false;
+        m_thread.join();
+    }
+
+    std::thread::id id() const { return m_thread.get_id(); }
+    void start() { m_processing = true; }
+
+private:
+    void loop()
+    {
+        while (m_running) {
+            if (m_processing) {
+                QueuedInvoker::instance()->processEvents();
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic<bool> m_running { true };
+    std::atomic<bool> m_processing { false };
+    std::thread m_thread;
+};
+
+bool waitFor(const std::atomic<bool>& flag)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!flag && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    return flag;
+}
+}
+
+class QueuedInvokerTests : public ::testing::Test
+{
+public:
+    void invoke(const Worker& worker, int count, std::vector<int>& received, std::atomic<bool>& done)
+    {
+        for (int i = 0; i < count; ++i) {
+            QueuedInvoker::instance()->invoke(worker.id(), [&received, i]() {
+                received.push_back(i);
+            });
+        }
+        QueuedInvoker::instance()->invoke(worker.id(), [&done]() {
+            done = true;
+        });
+    }
+
+    static bool isSequence(const std::vector<int>& received, int count)
+    {
+        if (int(received.size()) != count) {
+            return false;
+        }
+        for (int i = 0; i < count; ++i) {
+            if (received[i] != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(QueuedInvokerTests, InvokeKeepsOrder)
+{
+    //! [GIVEN] A running worker
+    Worker worker;
+    worker.start();
+
+    //! [WHEN] Send many messages
+    const int count = 10000;
+    std::vector<int> received;
+    std::atomic<bool> done { false };
+    invoke(worker, count, received, done);
+
+    //! [THEN] All of them are called in the order they were sent
+    ASSERT_TRUE(waitFor(done));
+    EXPECT_TRUE(isSequence(received, count));
+}
+
+TEST_F(QueuedInvokerTests, OverflowKeepsOrder)
+{
+    //! [GIVEN] A worker that does not process messages yet
+    Worker worker;
+
+    //! [WHEN] Send more messages than the queue can hold and start the worker
+    const int count = int(QueuedInvoker::QUEUE_CAPACITY) * 3;
+    std::vector<int> received;
+    std::atomic<bool> done { false };
+    invoke(worker, count, received, done);
+    worker.start();
+
+    //! [THEN] The overflowed messages are called after the queued ones
+    ASSERT_TRUE(waitFor(done));
+    EXPECT_TRUE(isSequence(received, count));
+}
+
+TEST_F(QueuedInvokerTests, InvokeLargeCallable)
+{
+    //! [GIVEN] A running worker
+    Worker worker;
+    worker.start();
+
+    //! [WHEN] Send a message that does not fit into a slot
+    std::array<int, 64> payload;
+    payload.fill(42);
+    int sum = 0;
+    std::atomic<bool> done { false };
+    QueuedInvoker::instance()->invoke(worker.id(), [payload, &sum, &done]() {
+        for (int v : payload) {
+            sum += v;
+        }
+        done = true;
+    });
+
+    //! [THEN] It is called with its captures intact
+    ASSERT_TRUE(waitFor(done));
+    EXPECT_EQ(sum, 42 * 64);
+}
+
+TEST_F(QueuedInvokerTests, ReentrantProcessEvents)
+{
+    //! [GIVEN] A worker that does not process messages yet
+    Worker worker;
+
+    //! [WHEN] A message processes the events of its thread again
+    int firstCalls = 0;
+    int secondCalls = 0;
+    std::atomic<bool> done { false };
+    QueuedInvoker::instance()->invoke(worker.id(), [&firstCalls]() {
+        ++firstCalls;
+        QueuedInvoker::instance()->processEvents();
+    });
+    QueuedInvoker::instance()->invoke(worker.id(), [&secondCalls, &done]() {
+        ++secondCalls;
+        done = true;
+    });
+    worker.start();
+
+    //! [THEN] Every message is called once
+    ASSERT_TRUE(waitFor(done));
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(secondCalls, 1);
+}
+
+TEST_F(QueuedInvokerTests, AsyncCallRunsOnThread)
+{
+    //! [GIVEN] A running worker and a caller
+    Worker worker;
+    worker.start();
+    Asyncable caller;
+
+    //! [WHEN] Call a function on the worker
+    std::thread::id calledOn;
+    int arg = 0;
+    std::atomic<bool> done { false };
+    Async::call(&caller, [&calledOn, &arg, &done](int value) {
+        calledOn = std::this_thread::get_id();
+        arg = value;
+        done = true;
+    }, 7, worker.id());
+
+    //! [THEN] It is called on the worker with its argument
+    ASSERT_TRUE(waitFor(done));
+    EXPECT_EQ(calledOn, worker.id());
+    EXPECT_EQ(arg, 7);
+}
+
+TEST_F(QueuedInvokerTests, AsyncCallSkippedAfterCallerDestroyed)
+{
+    //! [GIVEN] A worker that does not process messages yet
+    Worker worker;
+
+    //! [WHEN] Queue calls of two callers and destroy the first one
+    std::atomic<int> destroyedCalls { 0 };
+    std::atomic<bool> done { false };
+    {
+        Asyncable destroyed;
+        Async::call(&destroyed, [&destroyedCalls]() { ++destroyedCalls; }, worker.id());
+        Async::call(&destroyed, [&destroyedCalls]() { ++destroyedCalls; }, worker.id());
+    }
+
+    //! [WHEN] A new caller may reuse the token index of the destroyed one
+    Asyncable reused;
+    Async::call(&reused, [&done]() { done = true; }, worker.id());
+    worker.start();
+
+    //! [THEN] Only the call of the living caller is called
+    ASSERT_TRUE(waitFor(done));
+    EXPECT_EQ(destroyedCalls, 0);
+}
+
@@ -45,6 +45,7 @@ public:
     virtual bool isConnected() const = 0;
     virtual MidiDeviceID deviceID() const = 0;
 
+    //! NOTE Sent from the input thread, the tick is the timestamp of the event in the clock of the platform
     virtual async::Channel<tick_t, Event> eventReceived() const = 0;
 };
 }
@@ -36,6 +36,11 @@ std::vector<MidiDevice> DummyMidiInPort::devices() const
     return { d };
 }
 
+async::Notification DummyMidiInPort::devicesChanged() const
+{
+    return m_devicesChanged;
+}
+
 Ret DummyMidiInPort::connect(const MidiDeviceID& deviceID)
 {
     m_deviceID = deviceID;
@@ -61,3 +66,12 @@ async::Channel<tick_t, Event> DummyMidiInPort::eventReceived() const
 {
     return m_eventReceived;
 }
+
+void DummyMidiInPort::simulateEventReceived(tick_t timestamp, const Event& event)
+{
+    if (!isConnected()) {
+        return;
+    }
+
+    m_eventReceived.send(timestamp, event);
+}
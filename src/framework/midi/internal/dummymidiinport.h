@@ -32,6 +32,7 @@ public:
     void init();
 
     std::vector<MidiDevice> devices() const override;
+    async::Notification devicesChanged() const override;
 
     Ret connect(const MidiDeviceID& deviceID) override;
     void disconnect() override;
@@ -40,9 +41,13 @@ public:
 
     async::Channel<tick_t, Event> eventReceived() const override;
 
+    //! NOTE Sends the event as if it came from the device, from the calling thread
+    void simulateEventReceived(tick_t timestamp, const Event& event);
+
 private:
     MidiDeviceID m_deviceID;
     async::Channel<tick_t, Event> m_eventReceived;
+    async::Notification m_devicesChanged;
 };
 }
 
@@ -24,6 +24,10 @@
 #include <alsa/asoundlib.h>
 #include <alsa/seq.h>
 #include <alsa/seq_midi_event.h>
+#include <poll.h>
+
+#include <chrono>
+#include <vector>
 
 #include "log.h"
 #include "midierrors.h"
@@ -169,11 +173,12 @@ void AlsaMidiInPort::disconnect()
         return;
     }
 
+    //! NOTE The input thread must not read the sequencer while it is closed
+    stop();
+
     snd_seq_disconnect_to(m_alsa->midiIn, 0, m_alsa->client, m_alsa->port);
     snd_seq_close(m_alsa->midiIn);
 
-    stop();
-
     m_alsa->client = -1;
     m_alsa->port = -1;
     m_alsa->midiIn = nullptr;
@@ -223,85 +228,107 @@ void AlsaMidiInPort::process(AlsaMidiInPort* self)
     self->doProcess();
 }
 
-void AlsaMidiInPort::doProcess()
+static Event eventFromAlsa(const snd_seq_event_t* ev)
 {
-    snd_seq_event_t* ev = nullptr;
     uint32_t data = 0;
     uint32_t value = 0;
-    Event e;
 
-    while (m_running.load() && isConnected()) {
-        snd_seq_event_input(m_alsa->midiIn, &ev);
+    switch (ev->type) {
+    case SND_SEQ_EVENT_SYSEX:
+        NOT_SUPPORTED << "event type: SND_SEQ_EVENT_SYSEX";
+        return Event::NOOP();
+    case SND_SEQ_EVENT_NOTEOFF:
+        data = 0x80
+               | (ev->data.note.channel & 0x0F)
+               | ((ev->data.note.note & 0x7F) << 8)
+               | ((ev->data.note.velocity & 0x7F) << 16);
+        break;
+    case SND_SEQ_EVENT_NOTEON:
+        data = 0x90
+               | (ev->data.note.channel & 0x0F)
+               | ((ev->data.note.note & 0x7F) << 8)
+               | ((ev->data.note.velocity & 0x7F) << 16);
+        break;
+    case SND_SEQ_EVENT_KEYPRESS:
+        data = 0xA0
+               | (ev->data.note.channel & 0x0F)
+               | ((ev->data.note.note & 0x7F) << 8)
+               | ((ev->data.note.velocity & 0x7F) << 16);
+        break;
+    case SND_SEQ_EVENT_CONTROLLER:
+        data = 0xB0
+               | (ev->data.control.channel & 0x0F)
+               | ((ev->data.control.param & 0x7F) << 8)
+               | ((ev->data.control.value & 0x7F) << 16);
+        break;
+    case SND_SEQ_EVENT_PGMCHANGE:
+        data = 0xC0
+               | (ev->data.control.channel & 0x0F)
+               | ((ev->data.control.value & 0x7F) << 8);
+        break;
+    case SND_SEQ_EVENT_CHANPRESS:
+        data = 0xD0
+               | (ev->data.control.channel & 0x0F)
+               | ((ev->data.control.value & 0x7F) << 8);
+        break;
+    case SND_SEQ_EVENT_PITCHBEND:
+        value = ev->data.control.value + 8192;
+        data = 0xE0
+               | (ev->data.note.channel & 0x0F)
+               | ((value & 0x7F) << 8)
+               | (((value >> 7) & 0x7F) << 16);
+        break;
+    default:
+        NOT_SUPPORTED << "event type: " << ev->type;
+        return Event::NOOP();
+    }
 
-        auto sleep = []() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(2));
-        };
+    Event e = Event::fromMIDI10Package(data);
+    return e.toMIDI20();
+}
 
-        if (!ev) {
-            sleep();
-            continue;
-        }
+static tick_t currentTimestamp()
+{
+    using namespace std::chrono;
+    return static_cast<tick_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
 
-        switch (ev->type) {
-        case SND_SEQ_EVENT_SYSEX:
-        {
-            NOT_SUPPORTED << "event type: SND_SEQ_EVENT_SYSEX";
-            continue;
-        }
-        case SND_SEQ_EVENT_NOTEOFF:
-            data = 0x80
-                   | (ev->data.note.channel & 0x0F)
-                   | ((ev->data.note.note & 0x7F) << 8)
-                   | ((ev->data.note.velocity & 0x7F) << 16);
-            break;
-        case SND_SEQ_EVENT_NOTEON:
-            data = 0x90
-                   | (ev->data.note.channel & 0x0F)
-                   | ((ev->data.note.note & 0x7F) << 8)
-                   | ((ev->data.note.velocity & 0x7F) << 16);
-            break;
-        case SND_SEQ_EVENT_KEYPRESS:
-            data = 0xA0
-                   | (ev->data.note.channel & 0x0F)
-                   | ((ev->data.note.note & 0x7F) << 8)
-                   | ((ev->data.note.velocity & 0x7F) << 16);
-            break;
-        case SND_SEQ_EVENT_CONTROLLER:
-            data = 0xB0
-                   | (ev->data.control.channel & 0x0F)
-                   | ((ev->data.control.param & 0x7F) << 8)
-                   | ((ev->data.control.value & 0x7F) << 16);
-            break;
-        case SND_SEQ_EVENT_PGMCHANGE:
-            data = 0xC0
-                   | (ev->data.control.channel & 0x0F)
-                   | ((ev->data.control.value & 0x7F) << 8);
-            break;
-        case SND_SEQ_EVENT_CHANPRESS:
-            data = 0xD0
-                   | (ev->data.control.channel & 0x0F)
-                   | ((ev->data.control.value & 0x7F) << 8);
-            break;
-        case SND_SEQ_EVENT_PITCHBEND:
-            value = ev->data.control.value + 8192;
-            data = 0xE0
-                   | (ev->data.note.channel & 0x0F)
-                   | ((value & 0x7F) << 8)
-                   | (((value >> 7) & 0x7F) << 16);
-            break;
-        default:
-            NOT_SUPPORTED << "event type: " << ev->type;
+void AlsaMidiInPort::doProcess()
+{
+    //! NOTE The thread sleeps in poll() until the device has events,
+    //! the timeout only lets it notice that it was stopped
+    static constexpr int POLL_TIMEOUT_MS = 100;
+
+    int fdsCount = snd_seq_poll_descriptors_count(m_alsa->midiIn, POLLIN);
+    std::vector<pollfd> fds(fdsCount);
+    snd_seq_poll_descriptors(m_alsa->midiIn, fds.data(), fdsCount, POLLIN);
+
+    while (m_running.load() && isConnected()) {
+        int ret = poll(fds.data(), fds.size(), POLL_TIMEOUT_MS);
+        if (ret <= 0) {
             continue;
         }
 
-        e = Event::fromMIDI10Package(data);
+        //! NOTE All events read on a wake-up were received at the same time
+        tick_t timestamp = currentTimestamp();
 
-        e = e.toMIDI20();
-        if (e) {
-            m_eventReceived.send(static_cast<tick_t>(ev->time.tick), e);
-        }
+        for (;;) {
+            snd_seq_event_t* ev = nullptr;
+            int err = snd_seq_event_input(m_alsa->midiIn, &ev);
+            if (err == -ENOSPC) {
+                LOGW() << "input buffer overrun, events are lost";
+                continue;
+            }
+
+            if (err < 0 || !ev) {
+                break;
+            }
 
-        sleep();
+            Event e = eventFromAlsa(ev);
+            if (e) {
+                m_eventReceived.send(timestamp, e);
+            }
+        }
     }
 }
 
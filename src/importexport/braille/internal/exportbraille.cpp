@@ -632,6 +632,8 @@ void ExportBraille::instruments(QIODevice* dev)
 
 void ExportBraille::write(QIODevice* dev)
 {
+    score->doPendingLayout();
+
     credits(dev);
     instruments(dev);
     int nrStaves = score->staves().size();
@@ -23,6 +23,8 @@
 #include "importgtp.h"
 
 #include <QDebug>
+#include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "libmscore/factory.h"
@@ -248,6 +250,26 @@ int GuitarPro6::readBit(QByteArray* buffer)
     return bit;         // return the bit we calculated
 }
 
+//---------------------------------------------------------
+//   readBitChunk
+//    read up to the end of the current byte in one go,
+//    the first bit read ends up as the most significant one
+//---------------------------------------------------------
+
+int GuitarPro6::readBitChunk(const QByteArray* buffer, int bitsToRead, int* chunkSize)
+{
+    int byteIndex = position / BITS_IN_BYTE;
+    int bitsLeftInByte = BITS_IN_BYTE - (position % BITS_IN_BYTE);
+    int count = std::min(bitsLeftInByte, bitsToRead);
+
+    int byte = (byteIndex < buffer->size()) ? (uchar(buffer->constData()[byteIndex])) : 0;
+    int chunk = (byte >> (bitsLeftInByte - count)) & ((1 << count) - 1);
+
+    position += count;
+    *chunkSize = count;
+    return chunk;
+}
+
 //---------------------------------------------------------
 //   readBits
 //---------------------------------------------------------
@@ -255,8 +277,11 @@ int GuitarPro6::readBit(QByteArray* buffer)
 int GuitarPro6::readBits(QByteArray* buffer, int bitsToRead)
 {
     int bits = 0;
-    for (int i = (bitsToRead - 1); i >= 0; i--) {
-        bits |= (readBit(buffer) << i);
+    while (bitsToRead > 0) {
+        int count = 0;
+        int chunk = readBitChunk(buffer, bitsToRead, &count);
+        bits = (bits << count) | chunk;
+        bitsToRead -= count;
     }
     return bits;
 }
@@ -267,9 +292,27 @@ int GuitarPro6::readBits(QByteArray* buffer, int bitsToRead)
 
 int GuitarPro6::readBitsReversed(QByteArray* buffer, int bitsToRead)
 {
+    // bit-reversal of every byte value
+    static const std::array<uchar, 256> reversedBytes = []() {
+        std::array<uchar, 256> table {};
+        for (int i = 0; i < 256; ++i) {
+            int reversed = 0;
+            for (int bit = 0; bit < 8; ++bit) {
+                reversed |= ((i >> bit) & 0x01) << (7 - bit);
+            }
+            table[i] = uchar(reversed);
+        }
+        return table;
+    }();
+
     int bits = 0;
-    for (int i = 0; i < bitsToRead; i++) {
-        bits |= readBit(buffer) << i;
+    int shift = 0;
+    while (bitsToRead > 0) {
+        int count = 0;
+        int chunk = readBitChunk(buffer, bitsToRead, &count);
+        bits |= (reversedBytes[chunk] >> (BITS_IN_BYTE - count)) << shift;
+        shift += count;
+        bitsToRead -= count;
     }
     return bits;
 }
@@ -280,14 +323,10 @@ int GuitarPro6::readBitsReversed(QByteArray* buffer, int bitsToRead)
 
 QByteArray GuitarPro6::getBytes(QByteArray* buffer, int offset, int length)
 {
-    QByteArray newBytes;
-    // compute new bytes from our buffer and return byte array
-    for (int i = 0; i < length; i++) {
-        if (buffer->length() > offset + i) {
-            newBytes.insert(i, ((*buffer)[offset + i]));
-        }
+    if (offset >= buffer->length()) {
+        return QByteArray();
     }
-    return newBytes;
+    return buffer->mid(offset, length);
 }
 
 //---------------------------------------------------------
@@ -606,20 +645,34 @@ void GuitarPro6::readTrackProperties(const QDomNode& currentNode, Part* part, in
 }
 
 //---------------------------------------------------------
-//   getNode
+//   indexNodesById
 //---------------------------------------------------------
 
-QDomNode GuitarPro6::getNode(const QString& id, QDomNode currentDomNode)
+GuitarPro6::GPNodesById GuitarPro6::indexNodesById(QDomNode firstDomNode) const
 {
-    while (!(currentDomNode).isNull()) {
-        QString currentId = currentDomNode.attributes().namedItem("id").toAttr().value();
-        if (id.compare(currentId) == 0) {
-            return currentDomNode;
+    GPNodesById nodes;
+    for (QDomNode node = firstDomNode; !node.isNull(); node = node.nextSibling()) {
+        QString id = node.attributes().namedItem("id").toAttr().value();
+        // keep the first node with a given id, as the sibling walk used to
+        if (!nodes.contains(id)) {
+            nodes.insert(id, node);
         }
-        currentDomNode = currentDomNode.nextSibling();
+    }
+    return nodes;
+}
+
+//---------------------------------------------------------
+//   getNode
+//---------------------------------------------------------
+
+QDomNode GuitarPro6::getNode(const QString& id, const GPNodesById& nodes) const
+{
+    auto it = nodes.constFind(id);
+    if (it != nodes.cend()) {
+        return it.value();
     }
     qDebug() << "WARNING: A null node was returned when search for the identifier" << id << ". Your Guitar Pro file may be corrupted.";
-    return currentDomNode;
+    return QDomNode();
 }
 
 //---------------------------------------------------------
@@ -2396,11 +2449,11 @@ void GuitarPro6::readGpif(QByteArray* data)
 
     // set up the partInfo struct to contain information from the file
     partInfo.masterBars = masterBars.firstChild();
-    partInfo.bars       = b.firstChild();
-    partInfo.voices     = voices.firstChild();
-    partInfo.beats      = beats.firstChild();
-    partInfo.notes      = notes.firstChild();
-    partInfo.rhythms    = rhythms.firstChild();
+    partInfo.bars       = indexNodesById(b.firstChild());
+    partInfo.voices     = indexNodesById(voices.firstChild());
+    partInfo.beats      = indexNodesById(beats.firstChild());
+    partInfo.notes      = indexNodesById(notes.firstChild());
+    partInfo.rhythms    = indexNodesById(rhythms.firstChild());
 
     measures = findNumMeasures(&partInfo);
 
@@ -2498,7 +2551,9 @@ void GuitarPro6::readGPX(QByteArray* buffer)
         // this is  a compressed file.
         int length             = readInteger(buffer, position / BITS_IN_BYTE);
         QByteArray* bcfsBuffer = new QByteArray();
-        int positionCounter    = 0;
+        if (length > 0) {
+            bcfsBuffer->reserve(length);
+        }
         while (!f->error() && (position / BITS_IN_BYTE) < length) {
             // read the bit indicating compression information
             int flag = readBits(buffer, 1);
@@ -2508,17 +2563,20 @@ void GuitarPro6::readGPX(QByteArray* buffer)
                 int offs = readBitsReversed(buffer, bits);
                 int size = readBitsReversed(buffer, bits);
 
-                QByteArray bcfsBufferCopy = *bcfsBuffer;
-                int pos                   = (bcfsBufferCopy.length() - offs);
+                // copy from the already decompressed data; never more than offs bytes,
+                // so the source range is always complete before we append to it
+                int pos = (bcfsBuffer->length() - offs);
+                if (pos < 0) {
+                    qDebug() << "WARNING: Invalid back reference in compressed GPX data";
+                    break;
+                }
                 for (int i = 0; i < (size > offs ? offs : size); i++) {
-                    bcfsBuffer->insert(positionCounter, bcfsBufferCopy[pos + i]);
-                    positionCounter++;
+                    bcfsBuffer->append(bcfsBuffer->at(pos + i));
                 }
             } else {
                 int size = readBitsReversed(buffer, 2);
                 for (int i = 0; i < size; i++) {
-                    bcfsBuffer->insert(positionCounter, readBits(buffer, 8));
-                    positionCounter++;
+                    bcfsBuffer->append(char(readBits(buffer, 8)));
                 }
             }
         }
@@ -24,6 +24,7 @@
 #define __IMPORTGTP_H__
 
 #include <QDomNode>
+#include <QHash>
 
 #include "libmscore/score.h"
 #include "libmscore/vibrato.h"
@@ -381,20 +382,23 @@ class GuitarPro6 : public GuitarPro
     int position = 0;
     // a constant storing the amount of bits per byte
     const int BITS_IN_BYTE = 8;
+    // the children of a GPIF list node, indexed by their id attribute
+    using GPNodesById = QHash<QString, QDomNode>;
     // contains all the information about notes that will go in the parts
     struct GPPartInfo {
         QDomNode masterBars;
-        QDomNode bars;
-        QDomNode voices;
-        QDomNode beats;
-        QDomNode notes;
-        QDomNode rhythms;
+        GPNodesById bars;
+        GPNodesById voices;
+        GPNodesById beats;
+        GPNodesById notes;
+        GPNodesById rhythms;
     };
     Slur** legatos;
     // a mapping from identifiers to fret diagrams
     QMap<int, FretDiagram*> fretDiagrams;
     void parseFile(const char* filename, QByteArray* data);
     int readBit(QByteArray* buffer);
+    int readBitChunk(const QByteArray* buffer, int bitsToRead, int* chunkSize);
     QByteArray getBytes(QByteArray* buffer, int offset, int length);
     void readGPX(QByteArray* buffer);
     int readInteger(QByteArray* buffer, int offset);
@@ -413,7 +417,8 @@ class GuitarPro6 : public GuitarPro
     void readMasterBars(GPPartInfo* partInfo);
     Fraction rhythmToDuration(QString value);
     Fraction fermataToFraction(int numerator, int denominator);
-    QDomNode getNode(const QString& id, QDomNode currentDomNode);
+    GPNodesById indexNodesById(QDomNode firstDomNode) const;
+    QDomNode getNode(const QString& id, const GPNodesById& nodes) const;
     void unhandledNode(QString nodeName);
     void makeTie(Note* note);
     void addTremoloBar(Segment* segment, int track, int whammyOrigin, int whammyMiddle, int whammyEnd);
@@ -26,7 +26,7 @@
 #include "framework/fonts/fontsmodule.h"
 #include "instrumentsscene/instrumentsscenemodule.h"
 #include "framework/system/systemmodule.h"
-#include "importexport/guitarpro/guitarpromodule.h"
+#include "importexport/guitarpro_old/guitarpromodule.h"
 #include "engraving/engravingmodule.h"
 
 #include "libmscore/masterscore.h"
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+#include "testbase.h"
+
+#include <QDir>
+
+#include "libmscore/masterscore.h"
+
+#include "compat/scoreaccess.h"
+
+static const QString GUITARPRO_DIR("data/");
+
+namespace Ms {
+extern Score::FileError importGTP(MasterScore* score, const QString& name);
+}
+
+using namespace Ms;
+
+//---------------------------------------------------------
+//   BenchGuitarProImport
+//    import time of the Guitar Pro test data, without layout
+//---------------------------------------------------------
+
+class BenchGuitarProImport : public QObject, public MTest
+{
+    Q_OBJECT
+
+    void addFiles(const QString& ext);
+    void importFile();
+
+private slots:
+    void initTestCase();
+    void importGpx_data() { addFiles("gpx"); }
+    void importGpx() { importFile(); }
+    void importGp_data() { addFiles("gp"); }
+    void importGp() { importFile(); }
+    void importGp5_data() { addFiles("gp5"); }
+    void importGp5() { importFile(); }
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//---------------------------------------------------------
+
+void BenchGuitarProImport::initTestCase()
+{
+    initMTest(QString(iex_guitarpro_benchmark_DATA_ROOT));
+}
+
+//---------------------------------------------------------
+//   addFiles
+//---------------------------------------------------------
+
+void BenchGuitarProImport::addFiles(const QString& ext)
+{
+    QTest::addColumn<QString>("path");
+
+    QDir dir(root + "/" + GUITARPRO_DIR);
+    for (const QString& fileName : dir.entryList({ "*." + ext }, QDir::Files, QDir::Name)) {
+        QTest::newRow(qPrintable(fileName)) << dir.filePath(fileName);
+    }
+}
+
+//---------------------------------------------------------
+//   importFile
+//---------------------------------------------------------
+
+void BenchGuitarProImport::importFile()
+{
+    QFETCH(QString, path);
+
+    QBENCHMARK {
+        MasterScore* score = mu::engraving::compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        Score::FileError rv = importGTP(score, path);
+        delete score;
+        QCOMPARE(rv, Score::FileError::FILE_NO_ERROR);
+    }
+}
+
+QTEST_MAIN(BenchGuitarProImport)
+#include "tst_guitarpro_benchmark.moc"
@@ -55,6 +55,7 @@ mu::Ret SvgWriter::write(INotationPtr notation, Device& destinationDevice, const
         return make_ret(Ret::Code::UnknownError);
     }
 
+    score->doPendingLayout();
     score->setPrinting(true); // don’t print page break symbols etc.
 
     Ms::MScore::pdfPrinting = true;
@@ -39,6 +39,9 @@ public:
     virtual bool musicxmlImportLayout() const = 0;
     virtual void setMusicxmlImportLayout(bool value) = 0;
 
+    virtual bool musicxmlImportValidation() const = 0;
+    virtual void setMusicxmlImportValidation(bool value) = 0;
+
     virtual bool musicxmlExportLayout() const = 0;
     virtual void setMusicxmlExportLayout(bool value) = 0;
 
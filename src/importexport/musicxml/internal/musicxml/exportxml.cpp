@@ -7237,6 +7237,8 @@ static std::vector<const Jump*> findJumpElements(const Score* score)
 
 void ExportMusicXml::write(QIODevice* dev)
 {
+    score()->doPendingLayout();
+
     // must export in transposed pitch to prevent
     // losing the transposition information
     // if necessary, switch concert pitch mode off
@@ -7281,6 +7283,7 @@ void ExportMusicXml::write(QIODevice* dev)
     writeParts();
 
     _xml.endObject();
+    _xml.flush();
 
     if (concertPitch) {
         // restore concert pitch
@@ -7337,7 +7340,7 @@ bool saveXml(Score* score, const QString& name)
 //     </rootfiles>
 // </container>
 
-static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString& filename)
+static bool writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString& filename)
 {
     QBuffer cbuf;
     cbuf.open(QIODevice::ReadWrite);
@@ -7352,17 +7355,26 @@ static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString&
     xml.endObject();
     xml.endObject();
     xml.endObject();
+    xml.flush();
     cbuf.seek(0);
 
     //uz.addDirectory("META-INF");
     zipwriter.addFile("META-INF/container.xml", cbuf.data());
 
-    QBuffer dbuf;
-    dbuf.open(QIODevice::ReadWrite);
-    ExportMusicXml em(score);
-    em.write(&dbuf);
-    dbuf.seek(0);
-    zipwriter.addFile(filename, dbuf.data());
+    // the score is encoded and deflated into the archive as it is written,
+    // instead of first collecting the whole document in memory
+    QIODevice* entry = zipwriter.openFile(filename);
+    if (!entry) {
+        return false;
+    }
+
+    // the exporter's text stream writes to the entry device, it must be gone
+    // before closeFile() invalidates that device
+    {
+        ExportMusicXml em(score);
+        em.write(entry);
+    }
+    return zipwriter.closeFile() && zipwriter.status() == MQZipWriter::NoError;
 }
 
 bool saveMxl(Score* score, QIODevice* device)
@@ -7371,10 +7383,10 @@ bool saveMxl(Score* score, QIODevice* device)
 
     //anonymized filename since we don't know the actual one here
     QString fn = "score.xml";
-    writeMxlArchive(score, uz, fn);
+    bool res = writeMxlArchive(score, uz, fn);
     uz.close();
 
-    return true;
+    return res;
 }
 
 bool saveMxl(Score* score, const QString& name)
@@ -7383,9 +7395,10 @@ bool saveMxl(Score* score, const QString& name)
 
     QFileInfo fi(name);
     QString fn = fi.completeBaseName() + ".xml";
-    writeMxlArchive(score, uz, fn);
+    bool res = writeMxlArchive(score, uz, fn);
+    uz.close();
 
-    return true;
+    return res;
 }
 
 double ExportMusicXml::getTenthsFromInches(double inches) const
@@ -26,6 +26,7 @@
 #include "importmxmllogger.h"
 #include "importmxmlpass1.h"
 #include "importmxmlpass2.h"
+#include "importmxmlstreamreader.h"
 
 namespace Ms {
 //---------------------------------------------------------
@@ -62,17 +63,23 @@ Score::FileError importMusicXMLfromBuffer(Score* score, const QString& /*name*/,
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_INFO);
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_TRACE); // also include tracing
 
-    // pass 1
+    // tokenize the document once, both passes replay the same events
     dev->seek(0);
+    MxmlEventStream events;
+    if (!events.read(dev)) {
+        logger.logError(QString("XML error at line %1 column %2: %3")
+                        .arg(events.errorLine()).arg(events.errorColumn()).arg(events.errorString()));
+    }
+
+    // pass 1
     MusicXMLParserPass1 pass1(score, &logger);
-    Score::FileError res = pass1.parse(dev);
+    Score::FileError res = pass1.parse(events);
     const auto pass1_errors = pass1.errors();
 
     // pass 2
     MusicXMLParserPass2 pass2(score, pass1, &logger);
     if (res == Score::FileError::FILE_NO_ERROR) {
-        dev->seek(0);
-        res = pass2.parse(dev);
+        res = pass2.parse(events);
     }
 
     // report result
@@ -20,7 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <QXmlStreamReader>
+#include "importmxmlstreamreader.h"
 
 #include "engraving/types/fraction.h"
 #include "engraving/types/typesconv.h"
@@ -181,7 +181,7 @@ QString mxmlNoteDuration::checkTiming(const QString& type, const bool rest, cons
  Parse the /score-partwise/part/measure/note/duration node.
  */
 
-void mxmlNoteDuration::duration(QXmlStreamReader& e)
+void mxmlNoteDuration::duration(MxmlStreamReader& e)
 {
     _logger->logDebugTrace("MusicXMLParserPass1::duration", &e);
 
@@ -209,7 +209,7 @@ void mxmlNoteDuration::duration(QXmlStreamReader& e)
  Return true if handled.
  */
 
-bool mxmlNoteDuration::readProperties(QXmlStreamReader& e)
+bool mxmlNoteDuration::readProperties(MxmlStreamReader& e)
 {
     const QStringRef& tag(e.name());
     //qDebug("tag %s", qPrintable(tag.toString()));
@@ -235,7 +235,7 @@ bool mxmlNoteDuration::readProperties(QXmlStreamReader& e)
  Parse the /score-partwise/part/measure/note/time-modification node.
  */
 
-void mxmlNoteDuration::timeModification(QXmlStreamReader& e)
+void mxmlNoteDuration::timeModification(MxmlStreamReader& e)
 {
     _logger->logDebugTrace("MusicXMLParserPass1::timeModification", &e);
 
@@ -23,7 +23,7 @@
 #ifndef __IMPORTMXMLNOTEPITCH_H__
 #define __IMPORTMXMLNOTEPITCH_H__
 
-#include <QXmlStreamReader>
+#include "importmxmlstreamreader.h"
 
 #include "libmscore/accidental.h"
 
@@ -44,14 +44,14 @@ class mxmlNotePitch
 public:
     mxmlNotePitch(MxmlLogger* logger)
         : _logger(logger) { /* nothing so far */ }
-    void pitch(QXmlStreamReader& e);
-    bool readProperties(QXmlStreamReader& e, Score* score);
+    void pitch(MxmlStreamReader& e);
+    bool readProperties(MxmlStreamReader& e, Score* score);
     Accidental* acc() const { return _acc; }
     AccidentalType accType() const { return _accType; }
     int alter() const { return _alter; }
     int displayOctave() const { return _displayOctave; }
     int displayStep() const { return _displayStep; }
-    void displayStepOctave(QXmlStreamReader& e);
+    void displayStepOctave(MxmlStreamReader& e);
     int octave() const { return _octave; }
     int step() const { return _step; }
     bool unpitched() const { return _unpitched; }
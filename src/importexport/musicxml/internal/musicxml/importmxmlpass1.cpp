@@ -940,14 +940,14 @@ static void fixupSigmap(MxmlLogger* logger, Score* score, const QVector<Fraction
 //---------------------------------------------------------
 
 /**
- Parse MusicXML in \a device and extract pass 1 data.
+ Parse the MusicXML \a events and extract pass 1 data.
  */
 
-Score::FileError MusicXMLParserPass1::parse(QIODevice* device)
+Score::FileError MusicXMLParserPass1::parse(const MxmlEventStream& events)
 {
-    _logger->logDebugTrace("MusicXMLParserPass1::parse device");
+    _logger->logDebugTrace("MusicXMLParserPass1::parse events");
     _parts.clear();
-    _e.setDevice(device);
+    _e.setEventStream(&events);
     auto res = parse();
     if (res != Score::FileError::FILE_NO_ERROR) {
         return res;
@@ -1260,7 +1260,7 @@ static QString decodeEntities(const QString& src)
  Read the next part of a MusicXML formatted string and convert to MuseScore internal encoding.
  */
 
-static QString nextPartOfFormattedString(QXmlStreamReader& e)
+static QString nextPartOfFormattedString(MxmlStreamReader& e)
 {
     //QString lang       = e.attribute(QString("xml:lang"), "it");
     QString fontWeight = e.attributes().value("font-weight").toString();
@@ -2383,7 +2383,7 @@ void MusicXMLParserPass1::clef(const QString& /* partId */)
 
 // TODO: share between pass 1 and pass 2
 
-static bool determineTimeSig(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static bool determineTimeSig(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                              const QString beats, const QString beatType, const QString timeSymbol,
                              TimeSigType& st, int& bts, int& btp)
 {
@@ -25,6 +25,7 @@
 
 #include "libmscore/masterscore.h"
 #include "importxmlfirstpass.h"
+#include "importmxmlstreamreader.h"
 #include "musicxml.h" // for the creditwords and MusicXmlPartGroupList definitions
 #include "musicxmlsupport.h"
 
@@ -117,7 +118,7 @@ class MusicXMLParserPass1
 public:
     MusicXMLParserPass1(Score* score, MxmlLogger* logger);
     void initPartState(const QString& partId);
-    Score::FileError parse(QIODevice* device);
+    Score::FileError parse(const MxmlEventStream& events);
     Score::FileError parse();
     QString errors() const { return _errors; }
     void scorePartwise();
@@ -175,7 +176,7 @@ private:
     void addError(const QString& error);        ///< Add an error to be shown in the GUI
 
     // generic pass 1 data
-    QXmlStreamReader _e;
+    MxmlStreamReader _e;
     int _divs;                                  ///< Current MusicXML divisions value
     QMap<QString, MusicXmlPart> _parts;         ///< Parts data, mapped on part id
     std::set<int> _systemStartMeasureNrs;       ///< Measure numbers of measures starting a page
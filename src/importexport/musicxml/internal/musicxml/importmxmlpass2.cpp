@@ -570,7 +570,7 @@ static void updatePartWithInstrumentChange(Part* const part, const MusicXMLInstr
  - MusicXMLInstruments: instrument details from score-part and part
  */
 
-static void setPartInstruments(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static void setPartInstruments(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                                Part* part, const QString& partId,
                                Score* score,
                                const MusicXmlInstrList& instrList,
@@ -750,7 +750,7 @@ static QString decodeEntities(const QString& src)
  */
 
 namespace xmlpass2 {
-static QString nextPartOfFormattedString(QXmlStreamReader& e)
+static QString nextPartOfFormattedString(MxmlStreamReader& e)
 {
     //QString lang       = e.attribute(QString("xml:lang"), "it");
     QString fontWeight = e.attributes().value("font-weight").toString();
@@ -837,7 +837,7 @@ static QString nextPartOfFormattedString(QXmlStreamReader& e)
  Add a single lyric to the score or delete it (if number too high)
  */
 
-static void addLyric(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static void addLyric(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                      ChordRest* cr, Lyrics* l, int lyricNo, MusicXmlLyricsExtend& extendedLyrics)
 {
     if (lyricNo > MAX_LYRICS) {
@@ -859,7 +859,7 @@ static void addLyric(MxmlLogger* logger, const QXmlStreamReader* const xmlreader
  Add a notes lyrics to the score
  */
 
-static void addLyrics(MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+static void addLyrics(MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                       ChordRest* cr,
                       const QMap<int, Lyrics*>& numbrdLyrics,
                       const QSet<Lyrics*>& extLyrics,
@@ -1546,13 +1546,13 @@ void MusicXMLParserPass2::skipLogCurrElem()
 //---------------------------------------------------------
 
 /**
- Parse MusicXML in \a device and extract pass 2 data.
+ Parse the MusicXML \a events and extract pass 2 data.
  */
 
-Score::FileError MusicXMLParserPass2::parse(QIODevice* device)
+Score::FileError MusicXMLParserPass2::parse(const MxmlEventStream& events)
 {
     //qDebug("MusicXMLParserPass2::parse()");
-    _e.setDevice(device);
+    _e.setEventStream(&events);
     Score::FileError res = parse();
     //qDebug("MusicXMLParserPass2::parse() res %d", int(res));
     return res;
@@ -2490,7 +2490,7 @@ void MusicXMLParserPass2::measureStyle(Measure* measure)
 //   calcTicks
 //---------------------------------------------------------
 
-static Fraction calcTicks(const QString& text, int divs, MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+static Fraction calcTicks(const QString& text, int divs, MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     Fraction dura(0, 0);                // invalid unless set correctly
 
@@ -4280,7 +4280,7 @@ static void addFiguredBassElemens(FiguredBassList& fbl, const Fraction noteStart
 static void addTremolo(ChordRest* cr,
                        const int tremoloNr, const QString& tremoloType,
                        Chord*& tremStart,
-                       MxmlLogger* logger, const QXmlStreamReader* const xmlreader,
+                       MxmlLogger* logger, const MxmlStreamReader* const xmlreader,
                        Fraction& timeMod)
 {
     if (!cr->isChord()) {
@@ -5363,7 +5363,7 @@ void MusicXMLParserPass2::backup(Fraction& dura)
 //---------------------------------------------------------
 
 MusicXMLParserLyric::MusicXMLParserLyric(const LyricNumberHandler lyricNumberHandler,
-                                         QXmlStreamReader& e, Score* score, MxmlLogger* logger)
+                                         MxmlStreamReader& e, Score* score, MxmlLogger* logger)
     : _lyricNumberHandler(lyricNumberHandler), _e(e), _score(score), _logger(logger)
 {
     // nothing
@@ -5493,7 +5493,7 @@ void MusicXMLParserNotations::slur()
 //---------------------------------------------------------
 
 static void addSlur(const Notation& notation, SlurStack& slurs, ChordRest* cr, const int tick,
-                    MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                    MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     auto slurNo = notation.attribute("number").toInt();
     if (slurNo > 0) {
@@ -5859,7 +5859,7 @@ void MusicXMLParserNotations::glissandoSlide()
 
 static void addGlissandoSlide(const Notation& notation, Note* note,
                               Glissando* glissandi[MAX_NUMBER_LEVEL][2], MusicXmlSpannerMap& spanners,
-                              MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                              MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     auto glissandoNumber = notation.attribute("number").toInt();
     if (glissandoNumber > 0) {
@@ -5918,7 +5918,7 @@ static void addGlissandoSlide(const Notation& notation, Note* note,
 //---------------------------------------------------------
 
 static void addArpeggio(ChordRest* cr, const QString& arpeggioType,
-                        MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                        MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     // no support for arpeggio on rest
     if (!arpeggioType.isEmpty() && cr->type() == ElementType::CHORD) {
@@ -5963,7 +5963,7 @@ static void addArticLaissezVibrer(const Note* const note)
 //---------------------------------------------------------
 
 static void addTie(const Notation& notation, Score* score, Note* note, const int track,
-                   Tie*& tie, MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                   Tie*& tie, MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     IF_ASSERT_FAILED(note) {
         return;
@@ -6018,7 +6018,7 @@ static void addTie(const Notation& notation, Score* score, Note* note, const int
 static void addWavyLine(ChordRest* cr, const Fraction& tick,
                         const int wavyLineNo, const QString& wavyLineType,
                         MusicXmlSpannerMap& spanners, TrillStack& trills,
-                        MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                        MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     if (!wavyLineType.isEmpty()) {
         const auto ticks = cr->ticks();
@@ -6077,7 +6077,7 @@ static void addBreath(ChordRest* cr, const Fraction& tick, SymId breath)
 //---------------------------------------------------------
 
 static void addChordLine(const Notation& notation, Note* note,
-                         MxmlLogger* logger, const QXmlStreamReader* const xmlreader)
+                         MxmlLogger* logger, const MxmlStreamReader* const xmlreader)
 {
     const QString& chordLineType = notation.subType();
     if (chordLineType != "") {
@@ -6165,7 +6165,7 @@ QString Notation::print() const
 //   MusicXMLParserNotations
 //---------------------------------------------------------
 
-MusicXMLParserNotations::MusicXMLParserNotations(QXmlStreamReader& e, Score* score, MxmlLogger* logger)
+MusicXMLParserNotations::MusicXMLParserNotations(MxmlStreamReader& e, Score* score, MxmlLogger* logger)
     : _e(e), _score(score), _logger(logger)
 {
     // nothing
@@ -6463,7 +6463,7 @@ void MusicXMLParserNotations::tuplet()
  MusicXMLParserDirection constructor.
  */
 
-MusicXMLParserDirection::MusicXMLParserDirection(QXmlStreamReader& e,
+MusicXMLParserDirection::MusicXMLParserDirection(MxmlStreamReader& e,
                                                  Score* score,
                                                  const MusicXMLParserPass1& pass1,
                                                  MusicXMLParserPass2& pass2,
@@ -0,0 +1,381 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "importmxmlstreamreader.h"
+
+#include <QIODevice>
+#include <QXmlStreamReader>
+
+namespace Ms {
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void MxmlEventStream::clear()
+{
+    _events.clear();
+    _names.clear();
+    _nameIndices.clear();
+    _attributes.clear();
+    _text.clear();
+    _lastTextIsWhitespace = false;
+    _errorString.clear();
+    _errorLine = 0;
+    _errorColumn = 0;
+}
+
+//---------------------------------------------------------
+//   internName
+//---------------------------------------------------------
+
+int MxmlEventStream::internName(const QStringRef& name)
+{
+    QString key = name.toString();
+    auto it = _nameIndices.constFind(key);
+    if (it != _nameIndices.cend()) {
+        return it.value();
+    }
+
+    int idx = int(_names.size());
+    _names.push_back(key);
+    _nameIndices.insert(key, idx);
+    return idx;
+}
+
+//---------------------------------------------------------
+//   addEvent
+//---------------------------------------------------------
+
+void MxmlEventStream::addEvent(EventType type, int data, int size, int line, int column)
+{
+    Event ev;
+    ev.type = type;
+    ev.data = data;
+    ev.size = size;
+    ev.firstAttribute = int(_attributes.size());
+    ev.line = line;
+    ev.column = column;
+    _events.push_back(ev);
+}
+
+//---------------------------------------------------------
+//   dropWhitespace
+//    remove the text event at the end of the list
+//    if it contains only whitespace
+//---------------------------------------------------------
+
+void MxmlEventStream::dropWhitespace()
+{
+    if (_events.empty() || _events.back().type != EventType::Characters || !_lastTextIsWhitespace) {
+        return;
+    }
+    _text.truncate(_events.back().data);
+    _events.pop_back();
+}
+
+//---------------------------------------------------------
+//   read
+//---------------------------------------------------------
+
+/**
+ Tokenize the document in \a device. Return false on an XML error,
+ in which case the events up to the error are kept (as QXmlStreamReader
+ would have delivered them).
+ */
+
+bool MxmlEventStream::read(QIODevice* device)
+{
+    clear();
+
+    QXmlStreamReader e(device);
+
+    while (!e.atEnd()) {
+        QXmlStreamReader::TokenType token = e.readNext();
+        const int line = int(e.lineNumber());
+        const int column = int(e.columnNumber());
+
+        switch (token) {
+        case QXmlStreamReader::StartElement: {
+            // whitespace between elements is never read by the parsers
+            dropWhitespace();
+            const QXmlStreamAttributes attributes = e.attributes();
+            addEvent(EventType::StartElement, internName(e.name()), attributes.size(), line, column);
+            for (const QXmlStreamAttribute& a : attributes) {
+                const QStringRef value = a.value();
+                _attributes.push_back({ internName(a.qualifiedName()), _text.size(), value.size() });
+                _text.append(value);
+            }
+        }
+        break;
+        case QXmlStreamReader::EndElement:
+            // whitespace is only kept as the text of an element without children,
+            // as readElementText() must return it then
+            if (_events.size() < 2 || _events[_events.size() - 2].type != EventType::StartElement) {
+                dropWhitespace();
+            }
+            addEvent(EventType::EndElement, internName(e.name()), 0, line, column);
+            break;
+        case QXmlStreamReader::Characters:
+            if (!_events.empty() && _events.back().type == EventType::Characters) {
+                // merge adjacent text, e.g. around comments and CDATA sections
+                _events.back().size += e.text().size();
+                _lastTextIsWhitespace = _lastTextIsWhitespace && e.isWhitespace();
+            } else {
+                addEvent(EventType::Characters, _text.size(), e.text().size(), line, column);
+                _lastTextIsWhitespace = e.isWhitespace();
+            }
+            _text.append(e.text());
+            break;
+        default:
+            // comments, processing instructions, DTD and document start/end are not needed
+            break;
+        }
+    }
+    dropWhitespace();
+
+    if (e.hasError()) {
+        _errorString = e.errorString();
+        _errorLine = int(e.lineNumber());
+        _errorColumn = int(e.columnNumber());
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   setEventStream
+//---------------------------------------------------------
+
+void MxmlStreamReader::setEventStream(const MxmlEventStream* stream)
+{
+    _stream = stream;
+    _current = -1;
+    _errorString.clear();
+    _attributesEvent = -1;
+    _attributes.clear();
+}
+
+//---------------------------------------------------------
+//   currentEvent
+//---------------------------------------------------------
+
+const MxmlEventStream::Event* MxmlStreamReader::currentEvent() const
+{
+    if (!_stream || _current < 0 || _current >= _stream->eventCount()) {
+        return nullptr;
+    }
+    return &_stream->event(_current);
+}
+
+//---------------------------------------------------------
+//   readNext
+//    return false at the end of the stream or after an error
+//---------------------------------------------------------
+
+bool MxmlStreamReader::readNext()
+{
+    if (!_stream || hasError() || _current >= _stream->eventCount()) {
+        return false;
+    }
+
+    ++_current;
+    if (_current >= _stream->eventCount()) {
+        if (_stream->hasError()) {
+            _errorString = _stream->errorString();
+        }
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------
+//   raiseError
+//---------------------------------------------------------
+
+void MxmlStreamReader::raiseError(const QString& message)
+{
+    _errorString = message;
+    if (_stream) {
+        _current = _stream->eventCount();
+    }
+}
+
+//---------------------------------------------------------
+//   readNextStartElement
+//---------------------------------------------------------
+
+bool MxmlStreamReader::readNextStartElement()
+{
+    while (readNext()) {
+        if (isEndElement()) {
+            return false;
+        } else if (isStartElement()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------
+//   skipCurrentElement
+//---------------------------------------------------------
+
+void MxmlStreamReader::skipCurrentElement()
+{
+    int depth = 1;
+    while (depth && readNext()) {
+        if (isEndElement()) {
+            --depth;
+        } else if (isStartElement()) {
+            ++depth;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   readElementText
+//---------------------------------------------------------
+
+QString MxmlStreamReader::readElementText()
+{
+    if (!isStartElement()) {
+        return QString();
+    }
+
+    QString result;
+    while (readNext()) {
+        const MxmlEventStream::Event* ev = currentEvent();
+        switch (ev->type) {
+        case MxmlEventStream::EventType::Characters:
+            result += _stream->text(ev->data, ev->size);
+            break;
+        case MxmlEventStream::EventType::EndElement:
+            return result;
+        case MxmlEventStream::EventType::StartElement:
+            raiseError(QXmlStreamReader::tr("Expected character data."));
+            return result;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   name
+//---------------------------------------------------------
+
+QStringRef MxmlStreamReader::name() const
+{
+    const MxmlEventStream::Event* ev = currentEvent();
+    if (!ev || ev->type == MxmlEventStream::EventType::Characters) {
+        return QStringRef();
+    }
+    return QStringRef(&_stream->name(ev->data));
+}
+
+//---------------------------------------------------------
+//   attributes
+//---------------------------------------------------------
+
+const QXmlStreamAttributes& MxmlStreamReader::attributes() const
+{
+    if (_attributesEvent != _current) {
+        _attributesEvent = _current;
+        _attributes.clear();
+        const MxmlEventStream::Event* ev = currentEvent();
+        if (ev && ev->type == MxmlEventStream::EventType::StartElement) {
+            for (int i = 0; i < ev->size; ++i) {
+                const MxmlEventStream::Attribute& a = _stream->attribute(ev->firstAttribute + i);
+                _attributes.append(_stream->name(a.name), _stream->text(a.offset, a.length));
+            }
+        }
+    }
+    return _attributes;
+}
+
+//---------------------------------------------------------
+//   token type
+//---------------------------------------------------------
+
+bool MxmlStreamReader::isStartElement() const
+{
+    const MxmlEventStream::Event* ev = currentEvent();
+    return ev && ev->type == MxmlEventStream::EventType::StartElement;
+}
+
+bool MxmlStreamReader::isEndElement() const
+{
+    const MxmlEventStream::Event* ev = currentEvent();
+    return ev && ev->type == MxmlEventStream::EventType::EndElement;
+}
+
+bool MxmlStreamReader::isCharacters() const
+{
+    const MxmlEventStream::Event* ev = currentEvent();
+    return ev && ev->type == MxmlEventStream::EventType::Characters;
+}
+
+bool MxmlStreamReader::atEnd() const
+{
+    return !_stream || hasError() || _current >= _stream->eventCount();
+}
+
+QString MxmlStreamReader::tokenString() const
+{
+    if (hasError()) {
+        return "Invalid";
+    }
+    const MxmlEventStream::Event* ev = currentEvent();
+    if (!ev) {
+        return _current < 0 ? "NoToken" : "EndDocument";
+    }
+    switch (ev->type) {
+    case MxmlEventStream::EventType::StartElement:
+        return "StartElement";
+    case MxmlEventStream::EventType::EndElement:
+        return "EndElement";
+    case MxmlEventStream::EventType::Characters:
+        return "Characters";
+    }
+    return "Invalid";
+}
+
+//---------------------------------------------------------
+//   location
+//---------------------------------------------------------
+
+qint64 MxmlStreamReader::lineNumber() const
+{
+    if (const MxmlEventStream::Event* ev = currentEvent()) {
+        return ev->line;
+    }
+    return _stream && _stream->hasError() ? _stream->errorLine() : 0;
+}
+
+qint64 MxmlStreamReader::columnNumber() const
+{
+    if (const MxmlEventStream::Event* ev = currentEvent()) {
+        return ev->column;
+    }
+    return _stream && _stream->hasError() ? _stream->errorColumn() : 0;
+}
+} // namespace Ms
@@ -0,0 +1,147 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __IMPORTMXMLSTREAMREADER_H__
+#define __IMPORTMXMLSTREAMREADER_H__
+
+#include <vector>
+
+#include <QHash>
+#include <QString>
+#include <QStringRef>
+#include <QXmlStreamAttributes>
+
+class QIODevice;
+
+namespace Ms {
+//---------------------------------------------------------
+//   MxmlEventStream
+//---------------------------------------------------------
+
+/**
+ The tokenized MusicXML document: a flat list of start element, end element
+ and text events. Element and attribute names are interned, text and attribute
+ values are stored back to back in a single string, whitespace between elements
+ is dropped. The document is tokenized once and replayed by both import passes.
+ */
+
+class MxmlEventStream
+{
+public:
+    enum class EventType : char {
+        StartElement, EndElement, Characters
+    };
+
+    struct Event {
+        EventType type = EventType::StartElement;
+        int data = -1;                 // name index for elements, text offset for characters
+        int size = 0;                  // attribute count for start elements, text length for characters
+        int firstAttribute = 0;
+        int line = 0;
+        int column = 0;
+    };
+
+    struct Attribute {
+        int name = -1;
+        int offset = 0;
+        int length = 0;
+    };
+
+    MxmlEventStream() {}
+    bool read(QIODevice* device);
+    void clear();
+
+    int eventCount() const { return int(_events.size()); }
+    const Event& event(int idx) const { return _events[idx]; }
+    const QString& name(int idx) const { return _names[idx]; }
+    QString text(int offset, int length) const { return _text.mid(offset, length); }
+    const Attribute& attribute(int idx) const { return _attributes[idx]; }
+
+    bool hasError() const { return !_errorString.isEmpty(); }
+    QString errorString() const { return _errorString; }
+    int errorLine() const { return _errorLine; }
+    int errorColumn() const { return _errorColumn; }
+
+private:
+    int internName(const QStringRef& name);
+    void addEvent(EventType type, int data, int size, int line, int column);
+    void dropWhitespace();
+
+    std::vector<Event> _events;
+    std::vector<QString> _names;
+    QHash<QString, int> _nameIndices;
+    std::vector<Attribute> _attributes;
+    QString _text;
+    bool _lastTextIsWhitespace = false;
+    QString _errorString;
+    int _errorLine = 0;
+    int _errorColumn = 0;
+};
+
+//---------------------------------------------------------
+//   MxmlStreamReader
+//---------------------------------------------------------
+
+/**
+ Replays an MxmlEventStream through the subset of the QXmlStreamReader
+ interface used by the MusicXML import.
+ */
+
+class MxmlStreamReader
+{
+public:
+    MxmlStreamReader() {}
+    void setEventStream(const MxmlEventStream* stream);
+
+    bool readNextStartElement();
+    void skipCurrentElement();
+    QString readElementText();
+
+    QStringRef name() const;
+    const QXmlStreamAttributes& attributes() const;
+
+    bool isStartElement() const;
+    bool isEndElement() const;
+    bool isCharacters() const;
+    bool atEnd() const;
+    QString tokenString() const;
+
+    qint64 lineNumber() const;
+    qint64 columnNumber() const;
+
+    bool hasError() const { return !_errorString.isEmpty(); }
+    QString errorString() const { return _errorString; }
+
+private:
+    bool readNext();
+    const MxmlEventStream::Event* currentEvent() const;
+    void raiseError(const QString& message);
+
+    const MxmlEventStream* _stream = nullptr;
+    int _current = -1;
+    QString _errorString;
+    mutable int _attributesEvent = -1;
+    mutable QXmlStreamAttributes _attributes;
+};
+} // namespace Ms
+
+#endif
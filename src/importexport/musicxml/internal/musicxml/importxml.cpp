@@ -32,7 +32,25 @@
 #include "thirdparty/qzip/qzipreader_p.h"
 #include "importmxml.h"
 
+#include "modularity/ioc.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
+
 namespace Ms {
+//---------------------------------------------------------
+//   MusicXmlImportSettings
+//---------------------------------------------------------
+
+class MusicXmlImportSettings
+{
+    INJECT_STATIC(iex_musicxml, mu::iex::musicxml::IMusicXmlConfiguration, configuration)
+
+public:
+    static bool validate()
+    {
+        return configuration() ? configuration()->musicxmlImportValidation() : true;
+    }
+};
+
 //---------------------------------------------------------
 //   tupletAssert -- check assertions for tuplet handling
 //---------------------------------------------------------
@@ -233,11 +251,14 @@ static Score::FileError doValidateAndImport(Score* score, const QString& name, Q
     // verify tuplet DurationType dependencies
     tupletAssert();
 
-    // validate the file
+    // validate the file, this builds a complete model of the document,
+    // so it is skipped when the user has switched it off
     Score::FileError res;
-    res = doValidate(name, dev);
-    if (res != Score::FileError::FILE_NO_ERROR) {
-        return res;
+    if (MusicXmlImportSettings::validate()) {
+        res = doValidate(name, dev);
+        if (res != Score::FileError::FILE_NO_ERROR) {
+            return res;
+        }
     }
 
     // actually do the import
@@ -31,6 +31,7 @@
 #include "libmscore/chord.h"
 
 #include "musicxmlsupport.h"
+#include "importmxmlstreamreader.h"
 
 namespace Ms {
 NoteList::NoteList()
@@ -281,7 +282,7 @@ void domNotImplemented(const QDomElement& e)
 //   xmlReaderLocation
 //---------------------------------------------------------
 
-QString xmlReaderLocation(const QXmlStreamReader& e)
+QString xmlReaderLocation(const MxmlStreamReader& e)
 {
     return QObject::tr("line %1 column %2").arg(e.lineNumber()).arg(e.columnNumber());
 }
@@ -290,7 +291,7 @@ QString xmlReaderLocation(const QXmlStreamReader& e)
 //   checkAtEndElement
 //---------------------------------------------------------
 
-QString checkAtEndElement(const QXmlStreamReader& e, const QString& expName)
+QString checkAtEndElement(const MxmlStreamReader& e, const QString& expName)
 {
     if (e.isEndElement() && e.name() == expName) {
         return "";
@@ -0,0 +1,173 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+#include "testbase.h"
+
+#include <QBuffer>
+#include <QTemporaryDir>
+
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measurebase.h"
+
+static const QString XML_IO_DATA_DIR("data/");
+static const int TARGET_PAGES = 400;
+
+namespace Ms {
+extern bool saveXml(Score*, QIODevice*);
+extern bool saveMxl(Score*, const QString&);
+}
+
+using namespace Ms;
+
+//---------------------------------------------------------
+//   BenchMxmlExport
+//    MusicXML export of a ~400 page score; peak RSS is
+//    reported after each case. Peak RSS never decreases,
+//    so the in-memory case runs last as the baseline.
+//---------------------------------------------------------
+
+class BenchMxmlExport : public QObject, public MTest
+{
+    Q_OBJECT
+
+    MasterScore* m_score = nullptr;
+    QTemporaryDir m_outDir;
+
+    void reportPeakRss(const char* label) const;
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void exportMxlStreamed();
+    void exportXmlToFile();
+    void exportXmlToBuffer();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//    build the test score by appending copies of a piano
+//    piece until it lays out to TARGET_PAGES pages
+//---------------------------------------------------------
+
+void BenchMxmlExport::initTestCase()
+{
+    initMTest(QString(iex_musicxml_benchmark_DATA_ROOT));
+    QVERIFY(m_outDir.isValid());
+
+    MasterScore* source = readScore(XML_IO_DATA_DIR + "testVoicePiano1.xml");
+    QVERIFY(source);
+    source->doLayout();
+    const int pagesPerCopy = qMax(1, source->npages());
+
+    m_score = readScore(XML_IO_DATA_DIR + "testVoicePiano1.xml");
+    QVERIFY(m_score);
+    m_score->doLayout();
+    while (m_score->npages() < TARGET_PAGES) {
+        const int copies = qMax(1, (TARGET_PAGES - m_score->npages()) / pagesPerCopy);
+        for (int i = 0; i < copies; ++i) {
+            m_score->appendMeasuresFromScore(source, Fraction(0, 1), source->last()->endTick());
+        }
+        m_score->doLayout();
+    }
+    delete source;
+
+    qInfo("score: %d measures, %d pages", m_score->nmeasures(), m_score->npages());
+    reportPeakRss("after layout");
+}
+
+void BenchMxmlExport::cleanupTestCase()
+{
+    delete m_score;
+    m_score = nullptr;
+}
+
+//---------------------------------------------------------
+//   reportPeakRss
+//---------------------------------------------------------
+
+void BenchMxmlExport::reportPeakRss(const char* label) const
+{
+#ifdef Q_OS_UNIX
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef Q_OS_MACOS
+        const long kb = usage.ru_maxrss / 1024;
+#else
+        const long kb = usage.ru_maxrss;
+#endif
+        qInfo("peak RSS %s: %ld kB", label, kb);
+    }
+#else
+    Q_UNUSED(label);
+#endif
+}
+
+//---------------------------------------------------------
+//   exportMxlStreamed
+//    document is deflated into the archive while it is written
+//---------------------------------------------------------
+
+void BenchMxmlExport::exportMxlStreamed()
+{
+    QBENCHMARK {
+        QVERIFY(saveMxl(m_score, m_outDir.filePath("benchmark_export.mxl")));
+    }
+    reportPeakRss("after mxl export");
+}
+
+//---------------------------------------------------------
+//   exportXmlToFile
+//---------------------------------------------------------
+
+void BenchMxmlExport::exportXmlToFile()
+{
+    QBENCHMARK {
+        QFile file(m_outDir.filePath("benchmark_export.xml"));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QVERIFY(saveXml(m_score, &file));
+    }
+    reportPeakRss("after xml export");
+}
+
+//---------------------------------------------------------
+//   exportXmlToBuffer
+//    whole document in memory, as mxl export used to do
+//---------------------------------------------------------
+
+void BenchMxmlExport::exportXmlToBuffer()
+{
+    QBENCHMARK {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        QVERIFY(saveXml(m_score, &buffer));
+        QVERIFY(buffer.size() > 0);
+    }
+    reportPeakRss("after in-memory xml export");
+}
+
+QTEST_MAIN(BenchMxmlExport)
+#include "tst_mxml_benchmark.moc"
@@ -0,0 +1,239 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "testing/qtestsuite.h"
+
+#include <QBuffer>
+
+#include "importexport/musicxml/internal/musicxml/importmxmlstreamreader.h"
+
+using namespace Ms;
+
+//---------------------------------------------------------
+//   tokenize
+//---------------------------------------------------------
+
+static bool tokenize(MxmlEventStream& events, const QByteArray& data)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    return events.read(&buffer);
+}
+
+//---------------------------------------------------------
+//   TestMxmlStreamReader
+//---------------------------------------------------------
+
+class TestMxmlStreamReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void elementText();
+    void whitespaceAfterComment();
+    void skipElement();
+    void attributes();
+    void location();
+    void malformed();
+    void replay();
+};
+
+//---------------------------------------------------------
+//   elementText
+//    text is returned across comments and CDATA sections
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::elementText()
+{
+    MxmlEventStream events;
+    QVERIFY(tokenize(events, "<note><step>C<!-- c -->D<![CDATA[E]]></step><octave>4</octave></note>"));
+
+    MxmlStreamReader e;
+    e.setEventStream(&events);
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.name().toString(), QString("note"));
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.name().toString(), QString("step"));
+    QCOMPARE(e.readElementText(), QString("CDE"));
+    QVERIFY(e.isEndElement());
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.readElementText(), QString("4"));
+    QVERIFY(!e.readNextStartElement());
+    QVERIFY(e.isEndElement());
+    QCOMPARE(e.name().toString(), QString("note"));
+    QVERIFY(!e.hasError());
+}
+
+//---------------------------------------------------------
+//   whitespaceAfterComment
+//    whitespace following a comment is part of the text
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::whitespaceAfterComment()
+{
+    MxmlEventStream events;
+    QVERIFY(tokenize(events, "<words>a<!-- c -->  b</words>"));
+
+    MxmlStreamReader e;
+    e.setEventStream(&events);
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.readElementText(), QString("a  b"));
+
+    MxmlEventStream events2;
+    QVERIFY(tokenize(events2, "<words><!-- c --> </words>"));
+    e.setEventStream(&events2);
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.readElementText(), QString(" "));
+}
+
+//---------------------------------------------------------
+//   skipElement
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::skipElement()
+{
+    MxmlEventStream events;
+    QVERIFY(tokenize(events, "<measure>\n"
+                   "  <print><system-layout><system-distance>1</system-distance></system-layout></print>\n"
+                   "  <!-- comment -->\n"
+                   "  <note/>\n"
+                   "</measure>\n"));
+
+    MxmlStreamReader e;
+    e.setEventStream(&events);
+    QVERIFY(e.readNextStartElement());
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.name().toString(), QString("print"));
+    e.skipCurrentElement();
+    QVERIFY(e.isEndElement());
+    QCOMPARE(e.name().toString(), QString("print"));
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.name().toString(), QString("note"));
+    e.skipCurrentElement();
+    QVERIFY(!e.readNextStartElement());
+    QCOMPARE(e.name().toString(), QString("measure"));
+}
+
+//---------------------------------------------------------
+//   attributes
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::attributes()
+{
+    MxmlEventStream events;
+    QVERIFY(tokenize(events, "<part id=\"P1\"><measure number=\"12\" width=\"300.5\"/></part>"));
+
+    MxmlStreamReader e;
+    e.setEventStream(&events);
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.attributes().value("id").toString(), QString("P1"));
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.attributes().size(), 2);
+    QCOMPARE(e.attributes().value("number").toString(), QString("12"));
+    QCOMPARE(e.attributes().value("width").toString(), QString("300.5"));
+    QVERIFY(!e.attributes().hasAttribute("id"));
+}
+
+//---------------------------------------------------------
+//   location
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::location()
+{
+    MxmlEventStream events;
+    QVERIFY(tokenize(events, "<a>\n"
+                   "  <b/>\n"
+                   "  <c>x</c>\n"
+                   "</a>\n"));
+
+    MxmlStreamReader e;
+    e.setEventStream(&events);
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.lineNumber(), qint64(1));
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.lineNumber(), qint64(2));
+    e.skipCurrentElement();
+    QVERIFY(e.readNextStartElement());
+    QCOMPARE(e.lineNumber(), qint64(3));
+    QCOMPARE(e.tokenString(), QString("StartElement"));
+}
+
+//---------------------------------------------------------
+//   malformed
+//    errors are reported and end the stream
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::malformed()
+{
+    MxmlEventStream events;
+    QVERIFY(!tokenize(events, "<a>\n<b></a>"));
+
+    MxmlStreamReader e;
+    e.setEventStream(&events);
+    QVERIFY(e.readNextStartElement());
+    QVERIFY(e.readNextStartElement());
+    QVERIFY(!e.readNextStartElement());
+    QVERIFY(e.hasError());
+    QVERIFY(!e.errorString().isEmpty());
+    QCOMPARE(e.lineNumber(), qint64(2));
+    QVERIFY(e.atEnd());
+}
+
+//---------------------------------------------------------
+//   replay
+//    each reader replays the stream from the start,
+//    whitespace between elements is not kept
+//---------------------------------------------------------
+
+void TestMxmlStreamReader::replay()
+{
+    MxmlEventStream events;
+    QVERIFY(tokenize(events, "<part>\n"
+                             "  <measure>\n"
+                             "    <words> </words>\n"
+                             "  </measure>\n"
+                             "</part>\n"));
+    // part, measure, words, text, and their end elements
+    QCOMPARE(events.eventCount(), 7);
+
+    for (int pass = 0; pass < 2; ++pass) {
+        MxmlStreamReader e;
+        e.setEventStream(&events);
+        QVERIFY(e.readNextStartElement());
+        QCOMPARE(e.name().toString(), QString("part"));
+        QVERIFY(e.readNextStartElement());
+        QCOMPARE(e.name().toString(), QString("measure"));
+        QVERIFY(e.readNextStartElement());
+        QCOMPARE(e.readElementText(), QString(" "));
+        QVERIFY(!e.readNextStartElement());
+        QCOMPARE(e.name().toString(), QString("measure"));
+        QVERIFY(!e.readNextStartElement());
+        QCOMPARE(e.name().toString(), QString("part"));
+        QVERIFY(!e.readNextStartElement());
+        QVERIFY(e.atEnd());
+        QVERIFY(!e.hasError());
+    }
+}
+
+QTEST_MAIN(TestMxmlStreamReader)
+#include "tst_mxml_streamreader.moc"
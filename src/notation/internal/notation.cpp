@@ -183,6 +183,14 @@ void Notation::setOpened(bool opened)
     }
 
     m_opened.set(opened);
+
+    //! NOTE Open parts are laid out after every edit, others when they are needed
+    if (m_score && !m_score->isMaster()) {
+        m_score->setLayoutOnDemand(!opened);
+        if (opened) {
+            m_score->doPendingLayout();
+        }
+    }
 }
 
 void Notation::notifyAboutNotationChanged()
@@ -25,6 +25,7 @@
 
 #include "engraving/libmscore/score.h"
 #include "engraving/paint/paint.h"
+#include "engraving/layout/layoutstatistics.h"
 
 #include "notation.h"
 #include "notationinteraction.h"
@@ -72,6 +73,7 @@ int NotationPainting::pageCount() const
         return 0;
     }
 
+    score()->doPendingLayout();
     return score()->npages();
 }
 
@@ -81,6 +83,8 @@ SizeF NotationPainting::pageSizeInch() const
         return SizeF();
     }
 
+    score()->doPendingLayout();
+
     //! NOTE If now it is not PAGE view mode,
     //! then the page sizes will differ from the standard sizes (in PAGE view mode)
     if (score()->npages() > 0) {
@@ -113,11 +117,17 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
         return;
     }
 
+    //! NOTE Parts that are not being edited are laid out on demand, see Score::update()
+    score()->doPendingLayout();
+
     const QList<Ms::Page*>& pages = score()->pages();
     if (pages.empty()) {
         return;
     }
 
+    engraving::LayoutStatistics::PhaseTimer phaseTimer(engraving::LayoutStatistics::Phase::Paint);
+    engraving::LayoutStatistics::add(engraving::LayoutStatistics::Counter::PaintPasses);
+
     //! NOTE This is DPI of paint device,  ex screen, image, printer and etc.
     //! Should be set, but if not set, we will use our default DPI.
     const int DEVICE_DPI = opt.deviceDpi > 0 ? opt.deviceDpi : Ms::DPI;
@@ -198,6 +208,7 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
             painter->setClipRect(pageRect);
             QList<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
             engraving::Paint::paintElements(*painter, elements);
+            engraving::LayoutStatistics::add(engraving::LayoutStatistics::Counter::ElementsPainted, elements.size());
             painter->setClipping(false);
 
             if (opt.isMultiPage) {
@@ -22,7 +22,10 @@
 
 #include "timeline.h"
 
+#include <QGraphicsSceneHoverEvent>
 #include <QGraphicsTextItem>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
 #include <QMenu>
 #include <QScrollBar>
 #include <QTextDocument>
@@ -698,6 +701,233 @@ QString TRowLabels::cursorIsOn()
     }
 }
 
+//---------------------------------------------------------
+//   TimelineGrid
+//---------------------------------------------------------
+
+TimelineGrid::TimelineGrid(Timeline* timeline)
+    : m_timeline(timeline)
+{
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+    setAcceptHoverEvents(true);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::boundingRect
+//---------------------------------------------------------
+
+QRectF TimelineGrid::boundingRect() const
+{
+    return QRectF(0, m_top, m_cols * m_cellWidth, m_rows * m_cellHeight);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::paint
+//---------------------------------------------------------
+
+void TimelineGrid::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*)
+{
+    int firstCol, firstRow, lastCol, lastRow;
+    if (!cellsIn(option->exposedRect, &firstCol, &firstRow, &lastCol, &lastRow)) {
+        return;
+    }
+
+    const TimelineTheme& theme = m_timeline->activeTheme();
+    const QColor emptyColor(224, 224, 224);
+
+    painter->setPen(QPen(theme.backgroundColor));
+    for (int col = firstCol; col <= lastCol; ++col) {
+        for (int row = firstRow; row <= lastRow; ++row) {
+            QColor color = isOccupied(col, row) ? theme.colorBoxColor : emptyColor;
+            if (isCellSelected(col, row)) {
+                color = QColor(color.red(), color.green(), 255);
+            }
+            painter->setBrush(color);
+            painter->drawRect(cellRect(col, row));
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::setGeometry
+//---------------------------------------------------------
+
+void TimelineGrid::setGeometry(int cellWidth, int cellHeight, qreal top)
+{
+    if (m_cellWidth == cellWidth && m_cellHeight == cellHeight && qFuzzyCompare(m_top, top)) {
+        return;
+    }
+
+    prepareGeometryChange();
+    m_cellWidth = cellWidth;
+    m_cellHeight = cellHeight;
+    m_top = top;
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::setSize
+//    resets all cells if the size changes
+//---------------------------------------------------------
+
+void TimelineGrid::setSize(int rows, int cols)
+{
+    if (m_rows == rows && m_cols == cols) {
+        return;
+    }
+
+    prepareGeometryChange();
+    m_rows = rows;
+    m_cols = cols;
+    m_measures.assign(cols, nullptr);
+    m_columns.clear();
+    m_occupied = QBitArray(rows * cols);
+    m_selected = QBitArray(rows * cols);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::setMeasure
+//---------------------------------------------------------
+
+void TimelineGrid::setMeasure(int col, Measure* measure)
+{
+    Measure*& current = m_measures[col];
+    if (current == measure) {
+        return;
+    }
+
+    if (current && m_columns.value(current) == col) {
+        m_columns.remove(current);
+    }
+    current = measure;
+    m_columns.insert(measure, col);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::measure
+//---------------------------------------------------------
+
+Measure* TimelineGrid::measure(int col) const
+{
+    if (col < 0 || col >= m_cols) {
+        return nullptr;
+    }
+    return m_measures[col];
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::updateOccupancy
+//    a cell is occupied if its staff has a chord or a
+//    measure repeat in the measure
+//---------------------------------------------------------
+
+void TimelineGrid::updateOccupancy(int col)
+{
+    for (int row = 0; row < m_rows; ++row) {
+        m_occupied.clearBit(index(col, row));
+    }
+
+    const Measure* measure = m_measures[col];
+    if (!measure) {
+        return;
+    }
+
+    const int tracks = m_rows * VOICES;
+    for (Segment* seg = measure->first(); seg; seg = seg->next()) {
+        if (!seg->isChordRestType()) {
+            continue;
+        }
+        for (int track = 0; track < tracks; ++track) {
+            ChordRest* chordRest = seg->cr(track);
+            if (chordRest && (chordRest->isChord() || chordRest->isMeasureRepeat())) {
+                m_occupied.setBit(index(col, track / VOICES));
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::clearCellSelection
+//---------------------------------------------------------
+
+void TimelineGrid::clearCellSelection()
+{
+    m_selected.fill(false);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::cellRect
+//---------------------------------------------------------
+
+QRectF TimelineGrid::cellRect(int col, int row) const
+{
+    return QRectF(col * m_cellWidth, m_top + row * m_cellHeight, m_cellWidth, m_cellHeight);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::columnsRect
+//---------------------------------------------------------
+
+QRectF TimelineGrid::columnsRect(int firstCol, int lastCol) const
+{
+    return QRectF(firstCol * m_cellWidth, m_top, (lastCol - firstCol + 1) * m_cellWidth, m_rows * m_cellHeight);
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::cellAt
+//---------------------------------------------------------
+
+bool TimelineGrid::cellAt(const QPointF& pos, int* col, int* row) const
+{
+    if (!m_cellWidth || !m_cellHeight || !boundingRect().contains(pos)) {
+        return false;
+    }
+
+    *col = qBound(0, int(pos.x() / m_cellWidth), m_cols - 1);
+    *row = qBound(0, int((pos.y() - m_top) / m_cellHeight), m_rows - 1);
+    return true;
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::cellsIn
+//    range of cells intersecting the given rectangle
+//---------------------------------------------------------
+
+bool TimelineGrid::cellsIn(const QRectF& rect, int* firstCol, int* firstRow, int* lastCol, int* lastRow) const
+{
+    if (!m_cellWidth || !m_cellHeight) {
+        return false;
+    }
+
+    const QRectF area = rect.intersected(boundingRect());
+    if (area.isEmpty()) {
+        return false;
+    }
+
+    *firstCol = qBound(0, int(area.left() / m_cellWidth), m_cols - 1);
+    *lastCol = qBound(0, int(area.right() / m_cellWidth), m_cols - 1);
+    *firstRow = qBound(0, int((area.top() - m_top) / m_cellHeight), m_rows - 1);
+    *lastRow = qBound(0, int((area.bottom() - m_top) / m_cellHeight), m_rows - 1);
+    return true;
+}
+
+//---------------------------------------------------------
+//   TimelineGrid::hoverMoveEvent
+//---------------------------------------------------------
+
+void TimelineGrid::hoverMoveEvent(QGraphicsSceneHoverEvent* event)
+{
+    int col, row;
+    const Measure* currMeasure = cellAt(event->pos(), &col, &row) ? measure(col) : nullptr;
+    if (!currMeasure) {
+        setToolTip(QString());
+        return;
+    }
+
+    QChar initialLetter = Timeline::tr("Measure")[0];
+    QString partName = row < m_rowNames.size() ? m_rowNames.at(row) : QString();
+    setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
+}
+
 //---------------------------------------------------------
 //   Timeline
 //---------------------------------------------------------
@@ -965,7 +1195,6 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         gridRows != globalRows || gridCols != globalCols
         || (startMeasure == 0 && 2 * (endMeasure - startMeasure) > globalCols)  // rebuild all if more than half of score has changed
         );
-    const bool rebuildPartial = !rebuildAll && (startMeasure >= 0);
 
     const unsigned numMetas = nmetas();
 
@@ -974,19 +1203,6 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         startMeasure = 0;
         endMeasure = globalCols;
     } else {
-        if (rebuildPartial) {
-            const QRectF replacedRect
-                = getMeasureRect(startMeasure, 0, numMetas) | getMeasureRect(endMeasure - 1, globalRows - 1, numMetas);
-            const QList<QGraphicsItem*> replacedItems = scene()->items(replacedRect, Qt::ContainsItemShape);
-            for (QGraphicsItem* item : replacedItems) {
-                if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_MEASURE) {
-                    continue;
-                }
-                scene()->removeItem(item);
-                delete item;
-            }
-        }
-
         // Meta rows are still rebuilt from scratch, remove old meta rows manually
         const QList<QGraphicsItem*> items = scene()->items();
         for (QGraphicsItem* item : items) {
@@ -1010,45 +1226,29 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
     _globalZValue = 1;
 
     // Draw grid
-    Measure* currMeasure = score()->firstMeasure();
-    for (int i = 0; i < startMeasure; ++i) {
-        currMeasure = currMeasure->nextMeasure();
+    if (!_gridItem) {
+        _gridItem = new TimelineGrid(this);
+        _gridItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
+        _gridItem->setZValue(-3);
+        scene()->addItem(_gridItem);
     }
+    _gridItem->setGeometry(_gridWidth, _gridHeight, getMeasureRect(0, 0, numMetas).top());
+    _gridItem->setSize(globalRows, globalCols);
+    _gridItem->setRowNames(getRowNames());
 
-    QList<Part*> partList = getParts();
-
-    for (int col = startMeasure; col < endMeasure; col++) {
-        for (int row = 0; row < globalRows; row++) {
-            QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
-            graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
-
-            setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
-
-            QString translateMeasure = tr("Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
-                }
-            }
-
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
-            graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
-            graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            graphicsRectItem->setZValue(-3);
-            scene()->addItem(graphicsRectItem);
-        }
-
-        currMeasure = currMeasure->nextMeasure();
+    // Measures may have been inserted or removed before the changed range,
+    // so refresh the column mapping, but only recompute the changed cells
+    int col = 0;
+    for (Measure* currMeasure = score()->firstMeasure(); currMeasure && col < globalCols; currMeasure = currMeasure->nextMeasure()) {
+        _gridItem->setMeasure(col++, currMeasure);
+    }
+    for (col = startMeasure; col < endMeasure; ++col) {
+        _gridItem->updateOccupancy(col);
     }
+    if (startMeasure < endMeasure) {
+        _gridItem->update(_gridItem->columnsRect(startMeasure, endMeasure - 1));
+    }
+
     setSceneRect(0, 0, getWidth(), getHeight());
 
     // Draw meta rows and separator
@@ -1844,6 +2044,7 @@ void Timeline::clearScene()
     nonVisiblePathItem = nullptr;
     visiblePathItem = nullptr;
     selectionItem = nullptr;
+    _gridItem = nullptr;
 }
 
 //---------------------------------------------------------
@@ -2085,20 +2286,36 @@ void Timeline::drawSelection()
                 }
             }
         }
-        // Change color from gray to only blue
-        else if (it != metaLabelsSet.end()) {
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            graphicsRectItem->setBrush(QBrush(QColor(graphicsRectItem->brush().color().red(),
-                                                     graphicsRectItem->brush().color().green(),
-                                                     255)));
-            _selectionPath.addRect(graphicsRectItem->rect());
-        } else {
-            // Ensure unselected measures are not marked selected
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            if (graphicsRectItem && graphicsRectItem->data(keyItemType).value<ItemType>() == ItemType::TYPE_MEASURE) {
-                graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
+    }
+
+    // Mark the selected measure cells, the grid paints them in blue
+    if (_gridItem) {
+        _gridItem->clearCellSelection();
+        for (const std::tuple<Measure*, int, ElementType>& label : metaLabelsSet) {
+            const int stave = std::get<1>(label);
+            if (stave < 0 || stave >= _gridItem->rows() || std::get<2>(label) != ElementType::INVALID) {
+                continue;
+            }
+            const int col = _gridItem->column(std::get<0>(label));
+            if (col >= 0) {
+                _gridItem->setCellSelected(col, stave);
+            }
+        }
+
+        // Add the selected cells to the selection path as one rect per run of a row
+        for (int row = 0; row < _gridItem->rows(); ++row) {
+            for (int col = 0; col < _gridItem->cols(); ++col) {
+                if (!_gridItem->isCellSelected(col, row)) {
+                    continue;
+                }
+                const int firstCol = col;
+                while (col + 1 < _gridItem->cols() && _gridItem->isCellSelected(col + 1, row)) {
+                    ++col;
+                }
+                _selectionPath.addRect(_gridItem->cellRect(firstCol, row) | _gridItem->cellRect(col, row));
             }
         }
+        _gridItem->update();
     }
 
     if (selectionItem) {
@@ -2158,146 +2375,117 @@ void Timeline::mousePressEvent(QMouseEvent* event)
             maxZValue = graphicsItem->zValue();
         }
     }
-    if (currGraphicsItem) {
-        int stave = currGraphicsItem->data(0).value<int>();
-        Measure* currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
-        if (numToStaff(stave) && !numToStaff(stave)->show()) {
-            return;
-        }
 
-        if (!currMeasure) {
-            int nmeta = nmetas();
-            int bottomOfMeta = nmeta * _gridHeight + verticalScrollBar()->value();
+    // Measure cells are not separate items, look them up in the grid
+    int stave = 0;
+    Measure* currMeasure = nullptr;
+    if (currGraphicsItem) {
+        stave = currGraphicsItem->data(0).value<int>();
+        currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
+    } else if (!gridCellAt(scenePt, &currMeasure, &stave)) {
+        interaction()->clearSelection();
+        return;
+    }
 
-            // Handle measure box clicks
-            if (scenePt.y() > (nmeta - 1) * _gridHeight + verticalScrollBar()->value()
-                && scenePt.y() < bottomOfMeta) {
-                QRectF tmp(scenePt.x(), 0, 3, nmeta * _gridHeight + nstaves() * _gridHeight);
-                QList<QGraphicsItem*> gl = scene()->items(tmp);
-                Measure* measure = nullptr;
+    if (numToStaff(stave) && !numToStaff(stave)->show()) {
+        return;
+    }
 
-                for (QGraphicsItem* graphicsItem : gl) {
-                    measure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                    //-3 z value is the grid square values
-                    if (graphicsItem->zValue() == -3 && measure) {
-                        break;
-                    }
-                }
-            }
-            if (scenePt.y() < bottomOfMeta) {
-                return;
-            }
+    if (!currMeasure) {
+        int nmeta = nmetas();
+        int bottomOfMeta = nmeta * _gridHeight + verticalScrollBar()->value();
+        if (scenePt.y() < bottomOfMeta) {
+            return;
+        }
 
-            QList<QGraphicsItem*> gl = items(event->pos());
-            for (QGraphicsItem* graphicsItem : gl) {
-                currMeasure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                stave = graphicsItem->data(0).value<int>();
-                if (currMeasure) {
-                    break;
-                }
-            }
-            if (!currMeasure) {
-                interaction()->clearSelection();
-                return;
-            }
+        if (!gridCellAt(scenePt, &currMeasure, &stave)) {
+            interaction()->clearSelection();
+            return;
         }
+    }
 
-        bool metaValueClicked = currGraphicsItem->data(3).value<bool>();
+    bool metaValueClicked = currGraphicsItem && currGraphicsItem->data(3).value<bool>();
 
-        scene()->clearSelection();
-        if (metaValueClicked) {
-            _metaValue = true;
-            _oldSelectionRect = QRect();
+    scene()->clearSelection();
+    if (metaValueClicked) {
+        _metaValue = true;
+        _oldSelectionRect = QRect();
 
-            verticalScrollBar()->setValue(0);
+        verticalScrollBar()->setValue(0);
 
-            Segment* seg = static_cast<Segment*>(currGraphicsItem->data(6).value<void*>());
+        Segment* seg = static_cast<Segment*>(currGraphicsItem->data(6).value<void*>());
 
-            if (seg) {
-                std::vector<EngravingItem*> elements;
+        if (seg) {
+            std::vector<EngravingItem*> elements;
 
-                for (int track = 0; track < score()->nstaves() * VOICES; track++) {
-                    EngravingItem* element = seg->element(track);
-                    if (element) {
-                        elements.push_back(element);
-                    }
+            for (int track = 0; track < score()->nstaves() * VOICES; track++) {
+                EngravingItem* element = seg->element(track);
+                if (element) {
+                    elements.push_back(element);
                 }
+            }
 
-                if (elements.empty()) {
-                    interaction()->clearSelection();
-                } else {
-                    interaction()->select(elements);
-                }
+            if (elements.empty()) {
+                interaction()->clearSelection();
             } else {
-                // Also select the elements that they correspond to
-                ElementType elementType = currGraphicsItem->data(1).value<ElementType>();
-                SegmentType segmentType = SegmentType::Invalid;
-                if (elementType == ElementType::KEYSIG) {
-                    segmentType = SegmentType::KeySig;
-                } else if (elementType == ElementType::TIMESIG) {
-                    segmentType = SegmentType::TimeSig;
-                }
-
-                if (segmentType != SegmentType::Invalid) {
-                    Segment* currSeg = currMeasure->first();
-                    for (; currSeg && currSeg->segmentType() != segmentType; currSeg = currSeg->next()) {
-                    }
-                    if (currSeg) {
-                        std::vector<EngravingItem*> elements;
-
-                        for (int j = 0; j < score()->nstaves(); j++) {
-                            EngravingItem* element = currSeg->firstElement(j);
-                            if (element) {
-                                elements.push_back(element);
-                            }
-                        }
-
-                        if (elements.empty()) {
-                            interaction()->clearSelection();
-                        } else {
-                            interaction()->select(elements);
-                        }
-                    }
-                } else {
-                    // Select just the element for tempo_text
-                    EngravingItem* element = static_cast<EngravingItem*>(currGraphicsItem->data(4).value<void*>());
-                    if (element) {
-                        interaction()->select({ element });
-                    } else if (currMeasure) {
-                        interaction()->select({ currMeasure });
-                    } else {
-                        interaction()->clearSelection();
-                    }
-                }
+                interaction()->select(elements);
             }
         } else {
-            // Handle cell clicks
-            if (event->modifiers() == Qt::ShiftModifier) {
-                if (currMeasure->mmRest()) {
-                    currMeasure = currMeasure->mmRest();
-                } else if (currMeasure->mmRestCount() == -1) {
-                    currMeasure = currMeasure->prevMeasureMM();
-                }
+            // Also select the elements that they correspond to
+            ElementType elementType = currGraphicsItem->data(1).value<ElementType>();
+            SegmentType segmentType = SegmentType::Invalid;
+            if (elementType == ElementType::KEYSIG) {
+                segmentType = SegmentType::KeySig;
+            } else if (elementType == ElementType::TIMESIG) {
+                segmentType = SegmentType::TimeSig;
+            }
 
-                if (currMeasure) {
-                    interaction()->select({ currMeasure }, SelectType::RANGE, stave);
+            if (segmentType != SegmentType::Invalid) {
+                Segment* currSeg = currMeasure->first();
+                for (; currSeg && currSeg->segmentType() != segmentType; currSeg = currSeg->next()) {
                 }
-            } else if (event->modifiers() == Qt::ControlModifier) {
-                if (interaction()->selection()->isNone()) {
-                    if (currMeasure->mmRest()) {
-                        currMeasure = currMeasure->mmRest();
-                    } else if (currMeasure->mmRestCount() == -1) {
-                        currMeasure = currMeasure->prevMeasureMM();
+                if (currSeg) {
+                    std::vector<EngravingItem*> elements;
+
+                    for (int j = 0; j < score()->nstaves(); j++) {
+                        EngravingItem* element = currSeg->firstElement(j);
+                        if (element) {
+                            elements.push_back(element);
+                        }
                     }
 
-                    if (currMeasure) {
-                        interaction()->select({ currMeasure }, SelectType::RANGE, 0);
-                        interaction()->select({ currMeasure }, SelectType::RANGE, score()->nstaves() - 1);
+                    if (elements.empty()) {
+                        interaction()->clearSelection();
+                    } else {
+                        interaction()->select(elements);
                     }
+                }
+            } else {
+                // Select just the element for tempo_text
+                EngravingItem* element = static_cast<EngravingItem*>(currGraphicsItem->data(4).value<void*>());
+                if (element) {
+                    interaction()->select({ element });
+                } else if (currMeasure) {
+                    interaction()->select({ currMeasure });
                 } else {
                     interaction()->clearSelection();
                 }
-            } else {
+            }
+        }
+    } else {
+        // Handle cell clicks
+        if (event->modifiers() == Qt::ShiftModifier) {
+            if (currMeasure->mmRest()) {
+                currMeasure = currMeasure->mmRest();
+            } else if (currMeasure->mmRestCount() == -1) {
+                currMeasure = currMeasure->prevMeasureMM();
+            }
+
+            if (currMeasure) {
+                interaction()->select({ currMeasure }, SelectType::RANGE, stave);
+            }
+        } else if (event->modifiers() == Qt::ControlModifier) {
+            if (interaction()->selection()->isNone()) {
                 if (currMeasure->mmRest()) {
                     currMeasure = currMeasure->mmRest();
                 } else if (currMeasure->mmRestCount() == -1) {
@@ -2305,15 +2493,42 @@ void Timeline::mousePressEvent(QMouseEvent* event)
                 }
 
                 if (currMeasure) {
-                    interaction()->select({ currMeasure }, SelectType::SINGLE, stave);
+                    interaction()->select({ currMeasure }, SelectType::RANGE, 0);
+                    interaction()->select({ currMeasure }, SelectType::RANGE, score()->nstaves() - 1);
                 }
+            } else {
+                interaction()->clearSelection();
+            }
+        } else {
+            if (currMeasure->mmRest()) {
+                currMeasure = currMeasure->mmRest();
+            } else if (currMeasure->mmRestCount() == -1) {
+                currMeasure = currMeasure->prevMeasureMM();
+            }
+
+            if (currMeasure) {
+                interaction()->select({ currMeasure }, SelectType::SINGLE, stave);
             }
         }
-    } else {
-        interaction()->clearSelection();
     }
 }
 
+//---------------------------------------------------------
+//   Timeline::gridCellAt
+//---------------------------------------------------------
+
+bool Timeline::gridCellAt(const QPointF& scenePos, Measure** measure, int* stave) const
+{
+    int col, row;
+    if (!_gridItem || !_gridItem->cellAt(scenePos, &col, &row)) {
+        return false;
+    }
+
+    *measure = _gridItem->measure(col);
+    *stave = row;
+    return *measure != nullptr;
+}
+
 //---------------------------------------------------------
 //   Timeline::mouseMoveEvent
 //---------------------------------------------------------
@@ -2383,52 +2598,11 @@ void Timeline::mouseReleaseEvent(QMouseEvent*)
         scene()->removeItem(_selectionBox);
         interaction()->clearSelection();
 
-        int width, height;
-        QPoint loc = mapFromScene(_selectionBox->rect().topLeft());
-        width = int(_selectionBox->rect().width());
-        height = int(_selectionBox->rect().height());
-
-        QList<QGraphicsItem*> graphicsItemList = items(QRect(loc.x(), loc.y(), width, height));
-        // Find top left and bottom right to create selection
-        QGraphicsItem* tlGraphicsItem = nullptr;
-        QGraphicsItem* brGraphicsItem = nullptr;
-        for (QGraphicsItem* graphicsItem : graphicsItemList) {
-            Measure* currMeasure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-            if (!currMeasure) {
-                continue;
-            }
-            int stave = graphicsItem->data(0).value<int>();
-            if (stave == -1) {
-                continue;
-            }
-
-            if (!tlGraphicsItem && !brGraphicsItem) {
-                tlGraphicsItem = graphicsItem;
-                brGraphicsItem = graphicsItem;
-                continue;
-            }
-
-            if (graphicsItem->boundingRect().top() < tlGraphicsItem->boundingRect().top()) {
-                tlGraphicsItem = graphicsItem;
-            }
-            if (graphicsItem->boundingRect().left() < tlGraphicsItem->boundingRect().left()) {
-                tlGraphicsItem = graphicsItem;
-            }
-
-            if (graphicsItem->boundingRect().bottom() > brGraphicsItem->boundingRect().bottom()) {
-                brGraphicsItem = graphicsItem;
-            }
-            if (graphicsItem->boundingRect().right() > brGraphicsItem->boundingRect().right()) {
-                brGraphicsItem = graphicsItem;
-            }
-        }
-
-        // Select single tlGraphicsItem and then range brGraphicsItem
-        if (tlGraphicsItem && brGraphicsItem) {
-            Measure* tlMeasure = static_cast<Measure*>(tlGraphicsItem->data(2).value<void*>());
-            int tlStave = tlGraphicsItem->data(0).value<int>();
-            Measure* brMeasure = static_cast<Measure*>(brGraphicsItem->data(2).value<void*>());
-            int brStave = brGraphicsItem->data(0).value<int>();
+        // Find top left and bottom right cells to create selection
+        int tlCol, tlStave, brCol, brStave;
+        if (_gridItem && _gridItem->cellsIn(_selectionBox->rect(), &tlCol, &tlStave, &brCol, &brStave)) {
+            Measure* tlMeasure = _gridItem->measure(tlCol);
+            Measure* brMeasure = _gridItem->measure(brCol);
             if (tlMeasure && brMeasure) {
                 // Focus selection of mmRests here
                 if (tlMeasure->mmRest()) {
@@ -2639,7 +2813,10 @@ void Timeline::updateView()
     int measureIndex = 0;
     const int numMetas = nmetas();
 
-    for (Measure* currMeasure = score()->firstMeasure(); currMeasure; currMeasure = currMeasure->nextMeasure(), ++measureIndex) {
+    // Nothing of the score can intersect an empty canvas, skip walking all measures and staves
+    Measure* firstMeasure = canvas.isEmpty() ? nullptr : score()->firstMeasure();
+
+    for (Measure* currMeasure = firstMeasure; currMeasure; currMeasure = currMeasure->nextMeasure(), ++measureIndex) {
         System* system = currMeasure->system();
 
         if (currMeasure->mmRest() && score()->styleB(Sid::createMultiMeasureRests)) {
@@ -2753,28 +2930,34 @@ int Timeline::nstaves() const
 }
 
 //---------------------------------------------------------
-//   Timeline::colorBox
+//   Timeline::getRowNames
+//    plain text part names used in the grid tooltips
 //---------------------------------------------------------
 
-QColor Timeline::colorBox(QGraphicsRectItem* item)
+QStringList Timeline::getRowNames()
 {
-    Measure* measure = static_cast<Measure*>(item->data(2).value<void*>());
-    int stave = item->data(0).value<int>();
-    for (Segment* seg = measure->first(); seg; seg = seg->next()) {
-        if (!seg->isChordRestType()) {
+    QStringList names;
+    QTextDocument doc;
+    const Part* prevPart = nullptr;
+    for (const Part* part : getParts()) {
+        if (part == prevPart) {         // Staves of the same part share the name
+            names << names.last();
             continue;
         }
-        for (int track = stave * VOICES; track < stave * VOICES + VOICES; track++) {
-            ChordRest* chordRest = seg->cr(track);
-            if (chordRest) {
-                ElementType crt = chordRest->type();
-                if (crt == ElementType::CHORD || crt == ElementType::MEASURE_REPEAT) {
-                    return activeTheme().colorBoxColor;
-                }
-            }
+        prevPart = part;
+
+        doc.setHtml(part->longName());
+        QString partName = doc.toPlainText();
+        if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+            doc.setHtml(part->partName());
+            partName = doc.toPlainText();
+        }
+        if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+            partName = part->instrumentName();
         }
+        names << partName;
     }
-    return QColor(224, 224, 224);
+    return names;
 }
 
 //---------------------------------------------------------
@@ -3174,6 +3357,9 @@ QString Timeline::cursorIsOn(const QPoint& cursorPos)
     for (QGraphicsItem* currGraphicsItem : graphicsItemList) {
         Measure* currMeasure = static_cast<Measure*>(currGraphicsItem->data(2).value<void*>());
         int stave = currGraphicsItem->data(0).value<int>();
+        if (currGraphicsItem == _gridItem && !gridCellAt(cursorPos, &currMeasure, &stave)) {
+            continue;
+        }
         const Staff* st = numToStaff(stave);
         if (currMeasure && !(st && st->show())) {
             return "invalid";
@@ -32,7 +32,10 @@
 #include "actions/iactionsdispatcher.h"
 
 #include <vector>
+#include <QBitArray>
+#include <QGraphicsItem>
 #include <QGraphicsView>
+#include <QHash>
 #include <QSplitter>
 
 namespace Ms {
@@ -112,6 +115,66 @@ struct TimelineTheme {
     QColor metaValuePenColor, metaValueBrushColor;
 };
 
+//---------------------------------------------------------
+//   TimelineGrid
+//    The measure cells of all staves, painted as a single
+//    item. Only the cells within the exposed area are drawn,
+//    their state is kept in per measure/staff bitmaps.
+//---------------------------------------------------------
+
+class TimelineGrid : public QGraphicsItem
+{
+public:
+    TimelineGrid(Timeline* timeline);
+
+    QRectF boundingRect() const override;
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+
+    void setGeometry(int cellWidth, int cellHeight, qreal top);
+    void setSize(int rows, int cols);
+    void setRowNames(const QStringList& names) { m_rowNames = names; }
+
+    int rows() const { return m_rows; }
+    int cols() const { return m_cols; }
+
+    void setMeasure(int col, Measure* measure);
+    Measure* measure(int col) const;
+    int column(const Measure* measure) const { return m_columns.value(measure, -1); }
+
+    void updateOccupancy(int col);
+    bool isOccupied(int col, int row) const { return m_occupied.testBit(index(col, row)); }
+
+    void clearCellSelection();
+    void setCellSelected(int col, int row) { m_selected.setBit(index(col, row)); }
+    bool isCellSelected(int col, int row) const { return m_selected.testBit(index(col, row)); }
+
+    QRectF cellRect(int col, int row) const;
+    QRectF columnsRect(int firstCol, int lastCol) const;
+    bool cellAt(const QPointF& pos, int* col, int* row) const;
+    bool cellsIn(const QRectF& rect, int* firstCol, int* firstRow, int* lastCol, int* lastRow) const;
+
+protected:
+    void hoverMoveEvent(QGraphicsSceneHoverEvent* event) override;
+
+private:
+    int index(int col, int row) const { return col * m_rows + row; }
+
+    Timeline* m_timeline = nullptr;
+
+    int m_cellWidth = 0;
+    int m_cellHeight = 0;
+    qreal m_top = 0;
+
+    int m_rows = 0;
+    int m_cols = 0;
+
+    std::vector<Measure*> m_measures;
+    QHash<const Measure*, int> m_columns;
+    QBitArray m_occupied;
+    QBitArray m_selected;
+    QStringList m_rowNames;
+};
+
 //---------------------------------------------------------
 //   Timeline
 //---------------------------------------------------------
@@ -143,6 +206,7 @@ public:
 
 private:
     friend class TRowLabels;
+    friend class TimelineGrid;
 
     enum class ViewState {
         NORMAL,
@@ -179,6 +243,7 @@ private:
     QGraphicsPathItem* nonVisiblePathItem = nullptr;
     QGraphicsPathItem* visiblePathItem = nullptr;
     QGraphicsPathItem* selectionItem = nullptr;
+    TimelineGrid* _gridItem = nullptr;
 
     QGraphicsRectItem* _selectionBox { nullptr };
     std::vector<std::pair<QGraphicsItem*, int> > _metaRows;
@@ -231,6 +296,8 @@ private:
 
     void clearScene();
 
+    bool gridCellAt(const QPointF& scenePos, Measure** measure, int* stave) const;
+
     void updateGrid(int startMeasure = -1, int endMeasure = -1);
 
     mu::notation::INotationInteractionPtr interaction() const;
@@ -266,7 +333,7 @@ private:
 
     void updateGridFull() { updateGrid(0, -1); }
 
-    QColor colorBox(QGraphicsRectItem* item);
+    QStringList getRowNames();
 
     std::vector<std::pair<QString, bool> > getLabels();
 
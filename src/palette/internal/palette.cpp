@@ -608,6 +608,7 @@ std::function<void(PaletteCellPtr)> Palette::cellHandlerByPaletteType(const Pale
             if (bracket->bracketType() == BracketType::BRACE) {
                 bracket->setStaffSpan(0, 1);
                 cellPtr->mag = 1.2;
+                cellPtr->markChanged();
             }
         };
     default:
@@ -170,6 +170,15 @@ void PaletteCell::setElementTranslated(bool translate)
     } else {
         untranslatedElement.reset();
     }
+
+    markChanged();
+}
+
+void PaletteCell::markChanged()
+{
+    //! NOTE Unique across the cells, as the cells that take the id of another one get a new revision
+    static int lastRevision = 0;
+    revision = ++lastRevision;
 }
 
 bool PaletteCell::read(XmlReader& e)
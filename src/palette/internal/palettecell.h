@@ -89,9 +89,14 @@ public:
     static PaletteCellPtr fromMimeData(const QByteArray& data);
     static PaletteCellPtr fromElementMimeData(const QByteArray& data);
 
+    //! NOTE The rendered icons are cached by the id and the revision,
+    //! so it is to be called whenever the cell would look different
+    void markChanged();
+
     Ms::ElementPtr element;
     Ms::ElementPtr untranslatedElement;
     QString id;
+    int revision { 0 };
     QString name; // used for tool tip
 
     bool drawStaff { false };
@@ -21,6 +21,9 @@
  */
 #include "palettecelliconengine.h"
 
+#include <QPainter>
+#include <QPixmapCache>
+
 #include "engraving/infrastructure/draw/geometry.h"
 #include "engraving/infrastructure/draw/painter.h"
 #include "engraving/infrastructure/draw/pen.h"
@@ -35,6 +38,8 @@ using namespace mu::palette;
 using namespace mu::draw;
 using namespace Ms;
 
+static int s_cacheGeneration = 0;
+
 PaletteCellIconEngine::PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag)
     : QIconEngine(), m_cell(cell), m_extraMag(extraMag)
 {
@@ -47,11 +52,79 @@ QIconEngine* PaletteCellIconEngine::clone() const
 
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
-    p.restore();
+    if (rect.isEmpty()) {
+        return;
+    }
+
+    const qreal dpr = qp->device() ? qp->device()->devicePixelRatioF() : 1.0;
+    qp->drawPixmap(rect.topLeft(), cachedPixmap(rect.size(), dpr, mode, state));
+}
+
+QPixmap PaletteCellIconEngine::pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state)
+{
+    if (size.isEmpty()) {
+        return QPixmap();
+    }
+
+    return cachedPixmap(size, 1.0, mode, state);
+}
+
+void PaletteCellIconEngine::clearCache()
+{
+    // old entries are not found anymore and are evicted by QPixmapCache
+    ++s_cacheGeneration;
+}
+
+/// Render the cell once per size, pixel ratio and state, the palettes repaint
+/// their cells on every scroll and hover.
+QPixmap PaletteCellIconEngine::cachedPixmap(const QSize& size, qreal dpr, QIcon::Mode mode, QIcon::State state) const
+{
+    const QString key = cacheKey(size, dpr, mode, state);
+
+    QPixmap pm;
+    if (QPixmapCache::find(key, &pm)) {
+        return pm;
+    }
+
+    pm = QPixmap(size * dpr);
+    pm.setDevicePixelRatio(dpr);
+    pm.fill(Qt::transparent);
+
+    {
+        QPainter qp(&pm);
+        Painter p(&qp, "palettecell");
+        p.setAntialiasing(true);
+        paintCell(p, RectF(0.0, 0.0, size.width(), size.height()), mode == QIcon::Selected, state == QIcon::On);
+    }
+
+    QPixmapCache::insert(key, pm);
+    return pm;
+}
+
+QString PaletteCellIconEngine::cacheKey(const QSize& size, qreal dpr, QIcon::Mode mode, QIcon::State state) const
+{
+    //! NOTE The cells change their revision when they are edited
+    QString key = QString("palettecell_%1_%2_%3_%4x%5_%6_%7_%8")
+                  .arg(s_cacheGeneration)
+                  .arg(m_cell ? m_cell->id : QString())
+                  .arg(m_cell ? m_cell->revision : 0)
+                  .arg(size.width()).arg(size.height())
+                  .arg(dpr)
+                  .arg(int(mode))
+                  .arg(int(state));
+
+    key += QString("_%1_%2_%3_%4")
+           .arg(m_extraMag)
+           .arg(configuration()->paletteSpatium())
+           .arg(uiConfiguration()->guiScaling())
+           .arg(uiConfiguration()->dpi());
+
+    if (m_cell && m_cell->element && m_cell->element->score()) {
+        //! NOTE The elements are laid out and drawn with the style of their score
+        key += QString("_%1").arg(m_cell->element->score()->style().revision());
+    }
+
+    return key;
 }
 
 void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current) const
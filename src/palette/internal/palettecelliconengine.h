@@ -42,10 +42,18 @@ public:
     QIconEngine* clone() const override;
 
     void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) override;
+    QPixmap pixmap(const QSize& size, QIcon::Mode mode, QIcon::State state) override;
 
     static void paintPaletteElement(void* data, Ms::EngravingItem* element);
 
+    //! NOTE Drops the rendered cells, to be called when they
+    //! would look different, e.g. on a theme or language change
+    static void clearCache();
+
 private:
+    QPixmap cachedPixmap(const QSize& size, qreal dpr, QIcon::Mode mode, QIcon::State state) const;
+    QString cacheKey(const QSize& size, qreal dpr, QIcon::Mode mode, QIcon::State state) const;
+
     void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, Ms::EngravingItem* element) const;
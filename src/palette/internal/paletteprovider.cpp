@@ -524,6 +524,7 @@ void UserPaletteController::editCellProperties(const QModelIndex& index)
         cell->drawStaff = config.drawStaff;
         cell->xoffset = config.xOffset;
         cell->yoffset = config.yOffset;
+        cell->markChanged();
         _userPalette->itemDataChanged(srcIndex);
     });
 
@@ -575,9 +576,6 @@ void PaletteProvider::init()
     m_userPaletteModel = new Ms::PaletteTreeModel(std::make_shared<PaletteTree>(), this);
     connect(m_userPaletteModel, &PaletteTreeModel::treeChanged, this, &PaletteProvider::notifyAboutUserPaletteChanged);
 
-    m_masterPaletteModel = new Ms::PaletteTreeModel(PaletteCreator::newMasterPaletteTree());
-    m_masterPaletteModel->setParent(this);
-
     m_searchFilterModel = new PaletteCellFilterProxyModel(this);
     m_searchFilterModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
     m_searchFilterModel->setSourceModel(m_userPaletteModel);
@@ -668,7 +666,7 @@ FilterPaletteTreeModel* PaletteProvider::poolPaletteModel(const QModelIndex& ind
         return nullptr;
     }
 
-    FilterPaletteTreeModel* m = new FilterPaletteTreeModel(filter, m_masterPaletteModel);
+    FilterPaletteTreeModel* m = new FilterPaletteTreeModel(filter, masterPaletteModel());
     QQmlEngine::setObjectOwnership(m, QQmlEngine::JavaScriptOwnership);
     return m;
 }
@@ -699,12 +697,13 @@ QAbstractItemModel* PaletteProvider::availableExtraPalettesModel() const
 
     QStandardItem* root = m->invisibleRootItem();
 
-    const int masterRows = m_masterPaletteModel->rowCount();
+    PaletteTreeModel* masterModel = masterPaletteModel();
+    const int masterRows = masterModel->rowCount();
     for (int row = 0; row < masterRows; ++row) {
-        const QModelIndex idx = m_masterPaletteModel->index(row, 0);
+        const QModelIndex idx = masterModel->index(row, 0);
         // add everything that cannot be found in user palette
         if (!convertIndex(idx, m_userPaletteModel).isValid()) {
-            const QString name = m_masterPaletteModel->data(idx, Qt::DisplayRole).toString();
+            const QString name = masterModel->data(idx, Qt::DisplayRole).toString();
             QStandardItem* item = new QStandardItem(name);
             item->setData(false, CustomRole);       // this palette is from master palette, hence not custom
             item->setData(QPersistentModelIndex(idx), PaletteIndexRole);
@@ -799,19 +798,14 @@ bool PaletteProvider::resetPalette(const QModelIndex& index)
         return false;
     }
 
-    Q_ASSERT(m_defaultPaletteModel != m_userPaletteModel);
-
-    QAbstractItemModel* resetModel = nullptr;
-    QModelIndex resetIndex;
+    Q_ASSERT(defaultPaletteModel() != m_userPaletteModel);
 
-    if (m_defaultPaletteModel) {
-        resetModel = m_defaultPaletteModel;
-        resetIndex = convertIndex(index, m_defaultPaletteModel);
-    }
+    QAbstractItemModel* resetModel = defaultPaletteModel();
+    QModelIndex resetIndex = convertIndex(index, resetModel);
 
     if (!resetIndex.isValid()) {
-        resetModel = m_masterPaletteModel;
-        resetIndex = convertIndex(index, m_masterPaletteModel);
+        resetModel = masterPaletteModel();
+        resetIndex = convertIndex(index, resetModel);
     }
 
     const QModelIndex userPaletteIndex = convertProxyIndex(index, m_userPaletteModel);
@@ -930,6 +924,25 @@ void PaletteProvider::setUserPaletteTree(PaletteTreePtr tree)
     }
 }
 
+//! NOTE Creating all the elements of a palette tree takes a while, so the
+//! master and the default palettes are created when they are needed first
+
+PaletteTreeModel* PaletteProvider::masterPaletteModel() const
+{
+    if (!m_masterPaletteModel) {
+        m_masterPaletteModel = new PaletteTreeModel(PaletteCreator::newMasterPaletteTree(), const_cast<PaletteProvider*>(this));
+    }
+    return m_masterPaletteModel;
+}
+
+PaletteTreeModel* PaletteProvider::defaultPaletteModel() const
+{
+    if (!m_defaultPaletteModel) {
+        m_defaultPaletteModel = new PaletteTreeModel(PaletteCreator::newDefaultPaletteTree(), const_cast<PaletteProvider*>(this));
+    }
+    return m_defaultPaletteModel;
+}
+
 void PaletteProvider::setDefaultPaletteTree(PaletteTreePtr tree)
 {
     if (m_defaultPaletteModel) {
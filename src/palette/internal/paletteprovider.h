@@ -247,8 +247,12 @@ public:
     void retranslate()
     {
         m_userPaletteModel->retranslate();
-        m_masterPaletteModel->retranslate();
-        m_defaultPaletteModel->retranslate();
+        if (m_masterPaletteModel) {
+            m_masterPaletteModel->retranslate();
+        }
+        if (m_defaultPaletteModel) {
+            m_defaultPaletteModel->retranslate();
+        }
     }
 
 signals:
@@ -271,14 +275,17 @@ private:
     QAbstractItemModel* mainPaletteModel();
     AbstractPaletteController* mainPaletteController();
 
+    PaletteTreeModel* masterPaletteModel() const;
+    PaletteTreeModel* defaultPaletteModel() const;
+
     FilterPaletteTreeModel* customElementsPaletteModel();
     AbstractPaletteController* customElementsPaletteController();
 
     QString getPaletteFilename(bool open, const QString& name = "") const;
 
     PaletteTreeModel* m_userPaletteModel;
-    PaletteTreeModel* m_masterPaletteModel;
-    PaletteTreeModel* m_defaultPaletteModel; // palette used by "Reset palette" action
+    mutable PaletteTreeModel* m_masterPaletteModel = nullptr;
+    mutable PaletteTreeModel* m_defaultPaletteModel = nullptr; // palette used by "Reset palette" action
 
     mu::async::Notification m_userPaletteChanged;
 
@@ -21,6 +21,7 @@
  */
 #include "palettemodule.h"
 
+#include <QPixmapCache>
 #include <QQmlEngine>
 
 #include "log.h"
@@ -152,6 +153,11 @@ void PaletteModule::onInit(const framework::IApplication::RunMode& mode)
         return;
     }
 
+    //! NOTE The palette cells are cached as pixmaps (see PaletteCellIconEngine),
+    //! the default limit holds only a couple of palettes on a HiDPI screen
+    constexpr int PIXMAP_CACHE_LIMIT_KB = 64 * 1024;
+    QPixmapCache::setCacheLimit(qMax(QPixmapCache::cacheLimit(), PIXMAP_CACHE_LIMIT_KB));
+
     s_configuration->init();
     s_actionsController->init();
     s_paletteUiActions->init();
@@ -55,6 +55,7 @@ PaletteTreeModel::PaletteTreeModel(PaletteTreePtr tree, QObject* parent)
     connect(this, &QAbstractItemModel::rowsRemoved, this, &PaletteTreeModel::setTreeChanged);
 
     configuration()->colorsChanged().onNotify(this, [this]() {
+        PaletteCellIconEngine::clearCache();
         notifyAboutCellsChanged(Qt::DecorationRole);
     });
 }
@@ -476,6 +477,7 @@ bool PaletteTreeModel::setData(const QModelIndex& index, const QVariant& value,
             cell->untranslatedElement = newCell->untranslatedElement;
             cell->name = newCell->name;
             cell->id = newCell->id;
+            cell->markChanged();
             emit dataChanged(index, index);
             return true;
         };
@@ -513,6 +515,7 @@ bool PaletteTreeModel::setData(const QModelIndex& index, const QVariant& value,
                 cell->untranslatedElement = newCell->untranslatedElement;
                 cell->name = newCell->name;
                 cell->id = newCell->id;
+                cell->markChanged();
             } else if (map.contains(mu::commonscene::MIME_SYMBOL_FORMAT)) {
                 const QByteArray elementMimeData = map[mu::commonscene::MIME_SYMBOL_FORMAT].toByteArray();
                 PaletteCellPtr newCell = PaletteCell::fromElementMimeData(elementMimeData);
@@ -521,6 +524,7 @@ bool PaletteTreeModel::setData(const QModelIndex& index, const QVariant& value,
                 cell->untranslatedElement = newCell->untranslatedElement;
                 cell->name = newCell->name;
                 cell->id = newCell->id;
+                cell->markChanged();
 
                 cell->custom = true;               // mark the updated cell custom
             } else {
@@ -926,6 +930,7 @@ void PaletteTreeModel::updateCellsState(const Selection& sel)
 void PaletteTreeModel::retranslate()
 {
     _paletteTree->retranslate();
+    PaletteCellIconEngine::clearCache();
 }
 
 //---------------------------------------------------------
@@ -236,6 +236,12 @@ void PlaybackController::onNotationChanged()
         setLoop(boundaries);
     });
 
+    m_notation->interaction()->selectionChanged().onNotify(this, [this]() {
+        updateMidiThruTrack();
+    });
+
+    updateMidiThruTrack();
+
     m_isPlayAllowedChanged.notify();
 }
 
@@ -350,6 +356,7 @@ void PlaybackController::toggleMidiInput()
     bool midiInputEnabled = notationConfiguration()->isMidiInputEnabled();
     notationConfiguration()->setIsMidiInputEnabled(!midiInputEnabled);
     notifyActionCheckedChanged(MIDI_ON_CODE);
+    updateMidiThruTrack();
 }
 
 void PlaybackController::toggleCountIn()
@@ -466,6 +473,7 @@ void PlaybackController::resetCurrentSequence()
 
     playback()->removeSequence(m_currentSequenceId);
     m_currentSequenceId = -1;
+    m_midiThruTrackId = -1;
 }
 
 void PlaybackController::setCurrentTick(const tick_t tick)
@@ -497,6 +505,8 @@ void PlaybackController::addTrack(const ID& partId, const std::string& title)
 
         audioSettings()->setTrackInputParams(partId, appliedParams.in);
         audioSettings()->setTrackOutputParams(partId, appliedParams.out);
+
+        updateMidiThruTrack();
     })
     .onReject(this, [](int code, const std::string& msg) {
         LOGE() << "can't add a new track, code: [" << code << "] " << msg;
@@ -519,6 +529,46 @@ void PlaybackController::removeTrack(const ID& partId)
     audioSettings()->removeTrackParams(partId);
 }
 
+void PlaybackController::updateMidiThruTrack()
+{
+    if (m_currentSequenceId == -1) {
+        return;
+    }
+
+    //! NOTE The MIDI keyboard is heard with the instrument of the selection, or of the first part
+    const Part* part = nullptr;
+    if (notationConfiguration()->isMidiInputEnabled()) {
+        const EngravingItem* element = selection() ? selection()->element() : nullptr;
+        if (element) {
+            part = element->part();
+        } else if (selection() && selection()->isRange()) {
+            //! NOTE A range selection has no single element, the instrument of its first staff is used
+            const Staff* staff = m_notation->elements()->msScore()->staff(selection()->range()->startStaffIndex());
+            part = staff ? staff->part() : nullptr;
+        }
+
+        if (!part && masterNotationParts()) {
+            NotifyList<const Part*> partList = masterNotationParts()->partList();
+            part = !partList.empty() ? partList.front() : nullptr;
+        }
+    }
+
+    TrackId trackId = -1;
+    if (part) {
+        auto search = m_trackIdMap.find(part->id());
+        if (search != m_trackIdMap.end()) {
+            trackId = search->second;
+        }
+    }
+
+    if (trackId == m_midiThruTrackId) {
+        return;
+    }
+
+    m_midiThruTrackId = trackId;
+    playback()->tracks()->setMidiThruTrack(m_currentSequenceId, trackId);
+}
+
 void PlaybackController::setupNewCurrentSequence(const TrackSequenceId sequenceId)
 {
     playback()->tracks()->removeAllTracks(m_currentSequenceId);
@@ -132,6 +132,8 @@ private:
     void addTrack(const ID& partId, const std::string& title);
     void removeTrack(const ID& partId);
 
+    void updateMidiThruTrack();
+
     notation::INotationPtr m_notation;
     notation::IMasterNotationPtr m_masterNotation;
 
@@ -151,6 +153,7 @@ private:
     midi::tick_t m_currentTick = 0;
 
     std::map<ID /*partId*/, audio::TrackId> m_trackIdMap;
+    audio::TrackId m_midiThruTrackId = -1;
 };
 }
 
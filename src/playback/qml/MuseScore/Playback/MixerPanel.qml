@@ -88,6 +88,8 @@ Rectangle {
         MixerPanelModel {
             id: mixerPanelModel
 
+            metersActive: root.visible
+
             Component.onCompleted: {
                 mixerPanelModel.load(root.navigationSection)
             }
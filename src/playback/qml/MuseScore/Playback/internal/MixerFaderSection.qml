@@ -75,11 +75,13 @@ MixerPanelSection {
                 VolumePressureMeter {
                     id: leftPressure
                     currentVolumePressure: channelItem.leftChannelPressure
+                    currentPeak: channelItem.leftChannelPeak
                 }
 
                 VolumePressureMeter {
                     id: rightPressure
                     currentVolumePressure: channelItem.rightChannelPressure
+                    currentPeak: channelItem.rightChannelPeak
                     showRuler: true
                 }
             }
@@ -22,6 +22,9 @@
 
 #include "mixerchannelitem.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "translation.h"
 
 using namespace mu::playback;
@@ -30,6 +33,20 @@ using namespace mu::audio;
 static constexpr volume_dbfs_t MAX_DISPLAYED_DBFS = 0.f; // 100%
 static constexpr volume_dbfs_t MIN_DISPLAYED_DBFS = -60.f; // 0%
 
+static volume_dbfs_t displayedDbfs(const volume_dbfs_t value)
+{
+    return std::min(std::max(value, MIN_DISPLAYED_DBFS), MAX_DISPLAYED_DBFS);
+}
+
+static volume_dbfs_t displayedPeakDbfs(const float linearPeak)
+{
+    if (linearPeak <= 0.f) {
+        return MIN_DISPLAYED_DBFS;
+    }
+
+    return displayedDbfs(20.f * std::log10(linearPeak));
+}
+
 static constexpr float BALANCE_SCALING_FACTOR = 100.f;
 
 static constexpr int OUTPUT_RESOURCE_COUNT_LIMIT = 4;
@@ -46,7 +63,9 @@ MixerChannelItem::MixerChannelItem(QObject* parent, const audio::TrackId id, con
     m_id(id),
     m_isMaster(isMaster),
     m_leftChannelPressure(MIN_DISPLAYED_DBFS),
-    m_rightChannelPressure(MIN_DISPLAYED_DBFS)
+    m_rightChannelPressure(MIN_DISPLAYED_DBFS),
+    m_leftChannelPeak(MIN_DISPLAYED_DBFS),
+    m_rightChannelPeak(MIN_DISPLAYED_DBFS)
 {
     m_inputResourceItem = buildInputResourceItem();
 
@@ -59,7 +78,6 @@ MixerChannelItem::MixerChannelItem(QObject* parent, const audio::TrackId id, con
 
 MixerChannelItem::~MixerChannelItem()
 {
-    m_audioSignalChanges.resetOnReceive(this);
 }
 
 TrackId MixerChannelItem::id() const
@@ -87,6 +105,16 @@ float MixerChannelItem::rightChannelPressure() const
     return m_rightChannelPressure;
 }
 
+float MixerChannelItem::leftChannelPeak() const
+{
+    return m_leftChannelPeak;
+}
+
+float MixerChannelItem::rightChannelPeak() const
+{
+    return m_rightChannelPeak;
+}
+
 float MixerChannelItem::volumeLevel() const
 {
     return m_outParams.volume;
@@ -168,26 +196,37 @@ void MixerChannelItem::loadOutputParams(AudioOutputParams&& newParams)
     ensureBlankOutputResourceSlot();
 }
 
-void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioSignalChanges)
+AudioSignalsMeterPtr MixerChannelItem::audioSignalsMeter() const
+{
+    return m_audioSignalsMeter;
+}
+
+void MixerChannelItem::setAudioSignalsMeter(AudioSignalsMeterPtr meter)
 {
-    m_audioSignalChanges = audioSignalChanges;
+    m_audioSignalsMeter = std::move(meter);
+}
+
+void MixerChannelItem::updateAudioSignalValues()
+{
+    if (!m_audioSignalsMeter) {
+        return;
+    }
+
+    for (audioch_t audioChNum = 0; audioChNum < 2; ++audioChNum) {
+        //!Note The peaks are taken even when the mixer channel is muted,
+        //!     so that the ones of the blocks processed before muting don't show up after unmuting
+        const AudioSignalVal newValue = m_audioSignalsMeter->takeSignalValue(audioChNum);
 
-    m_audioSignalChanges.onReceive(this, [this](const audioch_t audioChNum, const AudioSignalVal& newValue) {
-        //!Note There should be no signal changes when the mixer channel is muted.
-        //!     But some audio signal changes still might be "on the way" from the times when the mixer channel wasn't muted
+        //!Note There should be no signal when the mixer channel is muted.
+        //!     But the meter might still hold the values of the blocks processed before muting
         //!     So that we have to just ignore them
         if (muted()) {
-            return;
+            continue;
         }
 
-        if (newValue.pressure < MIN_DISPLAYED_DBFS) {
-            setAudioChannelVolumePressure(audioChNum, MIN_DISPLAYED_DBFS);
-        } else if (newValue.pressure > MAX_DISPLAYED_DBFS) {
-            setAudioChannelVolumePressure(audioChNum, MAX_DISPLAYED_DBFS);
-        } else {
-            setAudioChannelVolumePressure(audioChNum, newValue.pressure);
-        }
-    });
+        setAudioChannelVolumePressure(audioChNum, displayedDbfs(newValue.pressure));
+        setAudioChannelPeak(audioChNum, displayedPeakDbfs(std::max(newValue.peak, newValue.truePeak)));
+    }
 }
 
 void MixerChannelItem::setTitle(QString title)
@@ -220,6 +259,26 @@ void MixerChannelItem::setRightChannelPressure(float rightChannelPressure)
     emit rightChannelPressureChanged(m_rightChannelPressure);
 }
 
+void MixerChannelItem::setLeftChannelPeak(float leftChannelPeak)
+{
+    if (qFuzzyCompare(m_leftChannelPeak, leftChannelPeak)) {
+        return;
+    }
+
+    m_leftChannelPeak = leftChannelPeak;
+    emit leftChannelPeakChanged(m_leftChannelPeak);
+}
+
+void MixerChannelItem::setRightChannelPeak(float rightChannelPeak)
+{
+    if (qFuzzyCompare(m_rightChannelPeak, rightChannelPeak)) {
+        return;
+    }
+
+    m_rightChannelPeak = rightChannelPeak;
+    emit rightChannelPeakChanged(m_rightChannelPeak);
+}
+
 void MixerChannelItem::setVolumeLevel(float volumeLevel)
 {
     if (qFuzzyCompare(m_outParams.volume, volumeLevel)) {
@@ -291,10 +350,21 @@ void MixerChannelItem::setAudioChannelVolumePressure(const audio::audioch_t chNu
     }
 }
 
+void MixerChannelItem::setAudioChannelPeak(const audio::audioch_t chNum, const float newValue)
+{
+    if (chNum == 0) {
+        setLeftChannelPeak(newValue);
+    } else {
+        setRightChannelPeak(newValue);
+    }
+}
+
 void MixerChannelItem::resetAudioChannelsVolumePressure()
 {
     setLeftChannelPressure(MIN_DISPLAYED_DBFS);
     setRightChannelPressure(MIN_DISPLAYED_DBFS);
+    setLeftChannelPeak(MIN_DISPLAYED_DBFS);
+    setRightChannelPeak(MIN_DISPLAYED_DBFS);
 }
 
 void MixerChannelItem::applyMuteToOutputParams(const bool isMuted)
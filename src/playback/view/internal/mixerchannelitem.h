@@ -47,6 +47,8 @@ class MixerChannelItem : public QObject, public async::Asyncable
 
     Q_PROPERTY(float leftChannelPressure READ leftChannelPressure NOTIFY leftChannelPressureChanged)
     Q_PROPERTY(float rightChannelPressure READ rightChannelPressure NOTIFY rightChannelPressureChanged)
+    Q_PROPERTY(float leftChannelPeak READ leftChannelPeak NOTIFY leftChannelPeakChanged)
+    Q_PROPERTY(float rightChannelPeak READ rightChannelPeak NOTIFY rightChannelPeakChanged)
 
     Q_PROPERTY(float volumeLevel READ volumeLevel WRITE setVolumeLevel NOTIFY volumeLevelChanged)
     Q_PROPERTY(int balance READ balance WRITE setBalance NOTIFY balanceChanged)
@@ -72,6 +74,9 @@ public:
     float leftChannelPressure() const;
     float rightChannelPressure() const;
 
+    float leftChannelPeak() const;
+    float rightChannelPeak() const;
+
     float volumeLevel() const;
     int balance() const;
 
@@ -85,7 +90,9 @@ public:
     void loadInputParams(audio::AudioInputParams&& newParams);
     void loadOutputParams(audio::AudioOutputParams&& newParams);
 
-    void subscribeOnAudioSignalChanges(audio::AudioSignalChanges&& audioSignalChanges);
+    audio::AudioSignalsMeterPtr audioSignalsMeter() const;
+    void setAudioSignalsMeter(audio::AudioSignalsMeterPtr meter);
+    void updateAudioSignalValues();
 
     bool outputOnly() const;
 
@@ -99,6 +106,9 @@ public slots:
     void setLeftChannelPressure(float leftChannelPressure);
     void setRightChannelPressure(float rightChannelPressure);
 
+    void setLeftChannelPeak(float leftChannelPeak);
+    void setRightChannelPeak(float rightChannelPeak);
+
     void setVolumeLevel(float volumeLevel);
     void setBalance(int balance);
 
@@ -112,6 +122,9 @@ signals:
     void leftChannelPressureChanged(float leftChannelPressure);
     void rightChannelPressureChanged(float rightChannelPressure);
 
+    void leftChannelPeakChanged(float leftChannelPeak);
+    void rightChannelPeakChanged(float rightChannelPeak);
+
     void volumeLevelChanged(float volumeLevel);
     void balanceChanged(int balance);
 
@@ -129,6 +142,7 @@ signals:
 
 private:
     void setAudioChannelVolumePressure(const audio::audioch_t chNum, const float newValue);
+    void setAudioChannelPeak(const audio::audioch_t chNum, const float newValue);
     void resetAudioChannelsVolumePressure();
 
     void applyMuteToOutputParams(const bool isMuted);
@@ -151,7 +165,7 @@ private:
     InputResourceItem* m_inputResourceItem = nullptr;
     QList<OutputResourceItem*> m_outputResourceItemList;
 
-    audio::AudioSignalChanges m_audioSignalChanges;
+    audio::AudioSignalsMeterPtr m_audioSignalsMeter = nullptr;
 
     bool m_isMaster = false;
     QString m_title;
@@ -159,6 +173,9 @@ private:
     float m_leftChannelPressure = 0.0;
     float m_rightChannelPressure = 0.0;
 
+    float m_leftChannelPeak = 0.0;
+    float m_rightChannelPeak = 0.0;
+
     bool m_mutedBySolo = false;
     bool m_mutedManually = false;
 
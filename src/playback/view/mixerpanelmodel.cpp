@@ -28,12 +28,45 @@
 using namespace mu::playback;
 using namespace mu::audio;
 
+//! NOTE The meters are polled at display rate instead of being notified about every processed block
+static constexpr int AUDIO_SIGNALS_UPDATE_INTERVAL_MS = 33;
+
 MixerPanelModel::MixerPanelModel(QObject* parent)
     : QAbstractListModel(parent)
 {
     controller()->currentTrackSequenceIdChanged().onNotify(this, [this]() {
         load(QVariant::fromValue(m_itemsNavigationSection));
     });
+
+    audioConfiguration()->meterOptionsChanged().onNotify(this, [this]() {
+        for (const MixerChannelItem* item : m_mixerChannelList) {
+            applyMeterOptions(item->audioSignalsMeter());
+        }
+    });
+
+    m_audioSignalsTimer.setInterval(AUDIO_SIGNALS_UPDATE_INTERVAL_MS);
+    connect(&m_audioSignalsTimer, &QTimer::timeout, this, &MixerPanelModel::updateAudioSignalValues);
+}
+
+bool MixerPanelModel::metersActive() const
+{
+    return m_audioSignalsTimer.isActive();
+}
+
+//! NOTE The meters are only polled while the panel is visible
+void MixerPanelModel::setMetersActive(bool active)
+{
+    if (metersActive() == active) {
+        return;
+    }
+
+    if (active) {
+        m_audioSignalsTimer.start();
+    } else {
+        m_audioSignalsTimer.stop();
+    }
+
+    emit metersActiveChanged();
 }
 
 void MixerPanelModel::load(const QVariant& navigationSection)
@@ -176,6 +209,24 @@ void MixerPanelModel::clear()
     m_mixerChannelList.clear();
 }
 
+void MixerPanelModel::updateAudioSignalValues()
+{
+    for (MixerChannelItem* item : m_mixerChannelList) {
+        item->updateAudioSignalValues();
+    }
+}
+
+//! NOTE The options are read by the audio worker on the next processed block
+void MixerPanelModel::applyMeterOptions(const AudioSignalsMeterPtr& meter) const
+{
+    if (!meter) {
+        return;
+    }
+
+    meter->setPeakHoldEnabled(audioConfiguration()->isMeterPeakHoldEnabled());
+    meter->setTruePeakEnabled(audioConfiguration()->isMeterTruePeakEnabled());
+}
+
 MixerChannelItem* MixerPanelModel::buildTrackChannelItem(const audio::TrackSequenceId& sequenceId, const audio::TrackId& trackId)
 {
     MixerChannelItem* item = new MixerChannelItem(this, trackId);
@@ -230,12 +281,13 @@ MixerChannelItem* MixerPanelModel::buildTrackChannelItem(const audio::TrackSeque
         item->loadOutputParams(std::move(params));
     });
 
-    playback()->audioOutput()->signalChanges(sequenceId, trackId)
-    .onResolve(this, [item](AudioSignalChanges signalChanges) {
-        item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+    playback()->audioOutput()->signalsMeter(sequenceId, trackId)
+    .onResolve(this, [this, item](AudioSignalsMeterPtr meter) {
+        applyMeterOptions(meter);
+        item->setAudioSignalsMeter(std::move(meter));
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from mixer channel, error code: " << errCode
+        LOGE() << "unable to get audio signals meter of mixer channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -276,12 +328,13 @@ MixerChannelItem* MixerPanelModel::buildMasterChannelItem()
                << ", " << text;
     });
 
-    playback()->audioOutput()->masterSignalChanges()
-    .onResolve(this, [item](AudioSignalChanges signalChanges) {
-        item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+    playback()->audioOutput()->masterSignalsMeter()
+    .onResolve(this, [this, item](AudioSignalsMeterPtr meter) {
+        applyMeterOptions(meter);
+        item->setAudioSignalsMeter(std::move(meter));
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from master channel, error code: " << errCode
+        LOGE() << "unable to get audio signals meter of master channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -25,11 +25,13 @@
 
 #include <QAbstractListModel>
 #include <QList>
+#include <QTimer>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
 #include "audio/itracks.h"
 #include "audio/iplayback.h"
+#include "audio/iaudioconfiguration.h"
 #include "ui/view/navigationsection.h"
 
 #include "iplaybackcontroller.h"
@@ -42,8 +44,10 @@ class MixerPanelModel : public QAbstractListModel, public async::Asyncable
 
     INJECT(playback, audio::IPlayback, playback)
     INJECT(playback, IPlaybackController, controller)
+    INJECT(playback, audio::IAudioConfiguration, audioConfiguration)
 
     Q_PROPERTY(int count READ rowCount NOTIFY rowCountChanged)
+    Q_PROPERTY(bool metersActive READ metersActive WRITE setMetersActive NOTIFY metersActiveChanged)
 
 public:
     explicit MixerPanelModel(QObject* parent = nullptr);
@@ -55,8 +59,12 @@ public:
     int rowCount(const QModelIndex& parent = QModelIndex()) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+    bool metersActive() const;
+    void setMetersActive(bool active);
+
 signals:
     void rowCountChanged();
+    void metersActiveChanged();
 
 private:
     enum Roles {
@@ -69,6 +77,8 @@ private:
     void sortItems();
     void updateItemsPanelsOrder();
     void clear();
+    void updateAudioSignalValues();
+    void applyMeterOptions(const audio::AudioSignalsMeterPtr& meter) const;
 
     MixerChannelItem* buildTrackChannelItem(const audio::TrackSequenceId& sequenceId, const audio::TrackId& trackId);
     MixerChannelItem* buildMasterChannelItem();
@@ -77,6 +87,8 @@ private:
     audio::TrackSequenceId m_currentTrackSequenceId = -1;
 
     ui::NavigationSection* m_itemsNavigationSection = nullptr;
+
+    QTimer m_audioSignalsTimer;
 };
 }
 
@@ -21,15 +21,21 @@
  */
 
 #include "score.h"
+
+#include <atomic>
+
 #include "cursor.h"
 #include "elements.h"
 
+#include "libmscore/chord.h"
 #include "libmscore/factory.h"
 #include "libmscore/instrtemplate.h"
 #include "libmscore/measure.h"
 #include "libmscore/masterscore.h"
+#include "libmscore/note.h"
 #include "libmscore/segment.h"
 #include "libmscore/text.h"
+#include "libmscore/undo.h"
 
 namespace Ms {
 namespace PluginAPI {
@@ -215,5 +221,180 @@ void Score::startCmd()
 {
     score()->startCmd();
 }
+
+//---------------------------------------------------------
+//   BatchState
+//    Batches are kept per master score rather than in the
+//    wrapper, which may be collected in the middle of one
+//---------------------------------------------------------
+
+namespace {
+struct BatchState {
+    int level = 0;
+    bool rollback = false;
+    bool ownsCmd = false; // false if started inside a command of the caller
+};
+
+QHash<const Ms::MasterScore*, BatchState>& batches()
+{
+    static QHash<const Ms::MasterScore*, BatchState> b;
+    return b;
+}
+
+//! NOTE Checked by the delete listener, which is called for every deleted object on any thread
+std::atomic<bool> s_hasBatches { false };
+}
+
+//---------------------------------------------------------
+//   endOpenBatches
+//---------------------------------------------------------
+
+void endOpenBatches()
+{
+    if (batches().isEmpty()) {
+        return;
+    }
+
+    const QHash<const Ms::MasterScore*, BatchState> open = batches();
+    batches().clear();
+    s_hasBatches.store(false, std::memory_order_release);
+
+    for (auto it = open.cbegin(); it != open.cend(); ++it) {
+        qWarning("endOpenBatches: the plugin has not ended its batch, the changes are kept as one command");
+
+        Ms::MasterScore* ms = const_cast<Ms::MasterScore*>(it.key());
+        if (it->ownsCmd) {
+            ms->endCmd(it->rollback);
+        } else if (it->rollback) {
+            ms->undoStack()->current()->unwind();
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   dropBatch
+//---------------------------------------------------------
+
+void dropBatch(const Ms::EngravingObject* e)
+{
+    if (!s_hasBatches.load(std::memory_order_acquire) || !e->isType(Ms::ElementType::SCORE)) {
+        return;
+    }
+
+    for (auto it = batches().begin(); it != batches().end(); ++it) {
+        if (static_cast<const Ms::EngravingObject*>(it.key()) == e) {
+            batches().erase(it);
+            break;
+        }
+    }
+
+    s_hasBatches.store(!batches().isEmpty(), std::memory_order_release);
+}
+
+//---------------------------------------------------------
+//   Score::endCmd
+//---------------------------------------------------------
+
+void Score::endCmd(bool rollback)
+{
+    auto it = batches().find(score()->masterScore());
+    if (it != batches().end()) {
+        // the command is ended (and the score laid out) by endBatch()
+        it->rollback |= rollback;
+        return;
+    }
+
+    score()->endCmd(rollback);
+}
+
+//---------------------------------------------------------
+//   Score::startBatch
+//---------------------------------------------------------
+
+void Score::startBatch()
+{
+    BatchState& b = batches()[score()->masterScore()];
+    s_hasBatches.store(true, std::memory_order_release);
+    if (b.level++ == 0) {
+        b.ownsCmd = !score()->undoStack()->active();
+        score()->startCmd();
+    }
+}
+
+//---------------------------------------------------------
+//   Score::endBatch
+//---------------------------------------------------------
+
+void Score::endBatch(bool rollback)
+{
+    auto it = batches().find(score()->masterScore());
+    if (it == batches().end()) {
+        qWarning("Score::endBatch: no batch started");
+        return;
+    }
+
+    it->rollback |= rollback;
+    if (--it->level > 0) {
+        return;
+    }
+
+    const BatchState b = *it;
+    batches().erase(it);
+    s_hasBatches.store(!batches().isEmpty(), std::memory_order_release);
+    if (b.ownsCmd) {
+        score()->endCmd(b.rollback);
+    } else if (b.rollback) {
+        score()->undoStack()->current()->unwind();
+    }
+}
+
+//---------------------------------------------------------
+//   Score::notesInRange
+//---------------------------------------------------------
+
+QVariantMap Score::notesInRange(int startTick, int endTick, int startStaff, int endStaff)
+{
+    QVector<int> pitch;
+    QVector<int> tpc;
+    QVector<int> tick;
+    QVector<int> duration;
+    QVector<int> track;
+
+    const Fraction stick = Fraction::fromTicks(qMax(startTick, 0));
+    const Fraction etick = endTick < 0 ? score()->endTick() : Fraction::fromTicks(endTick);
+    const int strack = qMax(startStaff, 0) * VOICES;
+    const int etrack = (endStaff < 0 ? score()->nstaves() : qMin(endStaff, score()->nstaves())) * VOICES;
+
+    Ms::Measure* m = score()->tick2measure(stick);
+    Ms::Segment* s = m ? m->first(Ms::SegmentType::ChordRest) : nullptr;
+    for (; s && s->tick() < etick; s = s->next1(Ms::SegmentType::ChordRest)) {
+        if (s->tick() < stick) {
+            continue;
+        }
+        for (int t = strack; t < etrack; ++t) {
+            Ms::EngravingItem* el = s->element(t);
+            if (!el || !el->isChord()) {
+                continue;
+            }
+            const Ms::Chord* chord = Ms::toChord(el);
+            const int ticks = chord->actualTicks().ticks();
+            for (const Ms::Note* note : chord->notes()) {
+                pitch.push_back(note->pitch());
+                tpc.push_back(note->tpc());
+                tick.push_back(s->tick().ticks());
+                duration.push_back(ticks);
+                track.push_back(t);
+            }
+        }
+    }
+
+    return {
+        { "pitch", QVariant::fromValue(pitch) },
+        { "tpc", QVariant::fromValue(tpc) },
+        { "tick", QVariant::fromValue(tick) },
+        { "duration", QVariant::fromValue(duration) },
+        { "track", QVariant::fromValue(track) },
+    };
+}
 }
 }
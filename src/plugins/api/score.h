@@ -225,7 +225,48 @@ public:
      * \param rollback If true, reverts all the changes
      * made since the last startCmd() invocation.
      */
-    Q_INVOKABLE void endCmd(bool rollback = false) { score()->endCmd(rollback); }
+    Q_INVOKABLE void endCmd(bool rollback = false);
+
+    /**
+     * Starts a batch of modifications. Until the matching
+     * endBatch() call all startCmd() / endCmd() pairs are
+     * merged into one undoable command, and the score is
+     * laid out only once, by endBatch(), for the whole
+     * range of the changes. Layout dependent properties
+     * (positions, bounding boxes, systems and pages) are
+     * not updated inside a batch.
+     * Batches can be nested.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE void startBatch();
+    /**
+     * Ends a batch started with startBatch() and lays out
+     * the modified part of the score.
+     * \param rollback If true, reverts all the changes made
+     * since the outermost startBatch() invocation, or the
+     * whole command if the batch was started inside one.
+     * Calling endCmd(true) inside the batch has the same effect.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE void endBatch(bool rollback = false);
+
+    /**
+     * Returns the notes of a range of the score as arrays
+     * of numbers, which is much faster than walking the
+     * score element by element for analysis plugins.
+     * Grace notes are not included.
+     * \param startTick First tick of the range.
+     * \param endTick End tick of the range (exclusive), -1 for
+     * the end of the score.
+     * \param startStaff First staff of the range.
+     * \param endStaff End staff of the range (exclusive), -1 for
+     * the last staff of the score.
+     * \returns An object with the arrays \p pitch, \p tpc,
+     * \p tick, \p duration (in ticks) and \p track, all of the
+     * same length, one entry per note, ordered by tick and track.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE QVariantMap notesInRange(int startTick = 0, int endTick = -1, int startStaff = 0, int endStaff = -1);
 
     /**
      * Create PlayEvents for all notes based on ornamentation.
@@ -247,6 +288,25 @@ public:
     static const Ms::InstrumentTemplate* instrTemplateFromName(const QString& name);   // used by PluginAPI::newScore()
     /// \endcond
 };
+
+//---------------------------------------------------------
+//   endOpenBatches
+///   \cond PLUGIN_API \private \endcond
+///   \internal
+///   Ends the batches a plugin left open, e.g. because it
+///   threw in the middle of one. Called when a plugin finishes.
+//---------------------------------------------------------
+
+extern void endOpenBatches();
+
+//---------------------------------------------------------
+//   dropBatch
+///   \cond PLUGIN_API \private \endcond
+///   \internal
+///   Forgets the batch of a deleted score.
+//---------------------------------------------------------
+
+extern void dropBatch(const Ms::EngravingObject* e);
 } // namespace PluginAPI
 } // namespace Ms
 #endif
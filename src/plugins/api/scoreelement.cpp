@@ -21,6 +21,13 @@
  */
 
 #include "scoreelement.h"
+
+#include <atomic>
+#include <mutex>
+
+#include <QHash>
+#include <private/qqmldata_p.h>
+
 #include "elements.h"
 #include "score.h"
 #include "fraction.h"
@@ -32,12 +39,98 @@ using namespace mu::engraving;
 
 namespace Ms {
 namespace PluginAPI {
+//---------------------------------------------------------
+//   WrapperCache
+//    Living wrappers of score-owned elements. Wrappers
+//    remove themselves when collected by the JS engine,
+//    entries of deleted elements are dropped by the
+//    EngravingObject delete listener. Elements can be
+//    deleted on any thread, hence the lock. A wrapper
+//    collected by the JS engine is only deleted later,
+//    so it is skipped and evicted until then.
+//---------------------------------------------------------
+
+namespace {
+struct WrapperCache {
+    std::mutex mutex;
+    QMultiHash<const Ms::EngravingObject*, ScoreElement*> wrappers;
+    std::atomic<bool> empty { true };
+};
+
+WrapperCache& wrapperCache()
+{
+    static WrapperCache cache;
+    return cache;
+}
+
+void onElementDeleted(const Ms::EngravingObject* e)
+{
+    dropBatch(e);
+
+    WrapperCache& cache = wrapperCache();
+    if (cache.empty.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.wrappers.remove(e);
+    cache.empty.store(cache.wrappers.isEmpty(), std::memory_order_release);
+}
+}
+
+ScoreElement* cachedWrapper(const Ms::EngravingObject* e, const QMetaObject* type)
+{
+    WrapperCache& cache = wrapperCache();
+    if (cache.empty.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (auto it = cache.wrappers.find(e); it != cache.wrappers.end() && it.key() == e;) {
+        ScoreElement* w = it.value();
+        if (QQmlData::wasDeleted(w)) {
+            w->_cachedAs = nullptr;
+            it = cache.wrappers.erase(it);
+            continue;
+        }
+        if (w->_cachedAs == type) {
+            return w;
+        }
+        ++it;
+    }
+    cache.empty.store(cache.wrappers.isEmpty(), std::memory_order_release);
+    return nullptr;
+}
+
+void cacheWrapper(ScoreElement* w, const QMetaObject* type)
+{
+    static const bool listenerSet = [] {
+        Ms::EngravingObject::setDeleteListener(&onElementDeleted);
+        return true;
+    }();
+    Q_UNUSED(listenerSet);
+
+    WrapperCache& cache = wrapperCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    w->_cachedAs = type;
+    cache.wrappers.insert(w->element(), w);
+    cache.empty.store(false, std::memory_order_release);
+}
+
 //---------------------------------------------------------
 //   ScoreElement
 //---------------------------------------------------------
 
 ScoreElement::~ScoreElement()
 {
+    if (_cachedAs) {
+        //! NOTE Does nothing if the element has been deleted already
+        WrapperCache& cache = wrapperCache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.wrappers.remove(e, this);
+        cache.empty.store(cache.wrappers.isEmpty(), std::memory_order_release);
+    }
+
     if (_ownership == Ownership::PLUGIN) {
         delete e;
     }
@@ -67,9 +67,14 @@ class ScoreElement : public QObject
     Q_PROPERTY(QString name READ name)
 
     Ownership _ownership;
+    /// Wrapper type this object is registered with in the wrapper cache
+    const QMetaObject* _cachedAs = nullptr;
 
     qreal spatium() const;
 
+    friend ScoreElement* cachedWrapper(const Ms::EngravingObject*, const QMetaObject*);
+    friend void cacheWrapper(ScoreElement*, const QMetaObject*);
+
 protected:
     /// \cond MS_INTERNAL
     Ms::EngravingObject* const e;
@@ -101,19 +106,45 @@ public:
     Q_INVOKABLE bool is(Ms::PluginAPI::ScoreElement* other) { return other && element() == other->element(); }
 };
 
+//---------------------------------------------------------
+//   cachedWrapper
+///   \cond PLUGIN_API \private \endcond
+///   \internal
+///   Returns the living wrapper of the given type created
+///   for a score-owned element, if any.
+//---------------------------------------------------------
+
+extern ScoreElement* cachedWrapper(const Ms::EngravingObject* e, const QMetaObject* type);
+extern void cacheWrapper(ScoreElement* w, const QMetaObject* type);
+
 //---------------------------------------------------------
 //   wrap
 ///   \cond PLUGIN_API \private \endcond
 ///   \internal
 ///   \relates ScoreElement
+///   Wrappers of score-owned elements are reused while
+///   they are alive, so walking a score does not allocate
+///   a new object on every access and `===` compares
+///   elements as expected.
 //---------------------------------------------------------
 
 template<class Wrapper, class T>
 Wrapper* wrap(T* t, Ownership own = Ownership::SCORE)
 {
-    Wrapper* w = t ? new Wrapper(t, own) : nullptr;
+    if (!t) {
+        return nullptr;
+    }
+    if (own == Ownership::SCORE) {
+        if (ScoreElement* w = cachedWrapper(t, &Wrapper::staticMetaObject)) {
+            return static_cast<Wrapper*>(w);
+        }
+    }
+    Wrapper* w = new Wrapper(t, own);
     // All wrapper objects should belong to JavaScript code.
     QQmlEngine::setObjectOwnership(w, QQmlEngine::JavaScriptOwnership);
+    if (own == Ownership::SCORE) {
+        cacheWrapper(w, &Wrapper::staticMetaObject);
+    }
     return w;
 }
 
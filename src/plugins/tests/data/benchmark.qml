@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+import QtQuick 2.0
+import MuseScore 3.0
+
+// Not shipped with the application. The plugins_benchmark target (BUILD_BENCHMARKS)
+// calls fill(), walk() and noteCount() on its own score and reports their timings.
+// It can also be run from the application after copying it to the plugins folder.
+MuseScore {
+    version: "4.0"
+    description: "This test plugin measures the speed of the plugin API on a 2000 measure score"
+    menuPath: "Plugins.Benchmark"
+    requiresScore: false;
+
+    property int measureCount: 2000
+
+    function elapsed(start) {
+        return (Date.now() - start) + " ms";
+    }
+
+    function fill(score) {
+        score.startBatch();
+        var cursor = score.newCursor();
+        cursor.track = 0;
+        cursor.rewind(0);
+        cursor.setDuration(1, 4);
+        for (var i = 0; i < measureCount * 4; ++i) {
+            cursor.addNote(60 + i % 12);
+        }
+        score.endBatch();
+    }
+
+    function walk(score) {
+        var noteCount = 0;
+        var measure = score.firstMeasure;
+        while (measure) {
+            var segment = measure.firstSegment;
+            while (segment) {
+                for (var t = 0; t < score.ntracks; ++t) {
+                    var el = segment.elementAt(t);
+                    if (el && el.type == Element.CHORD) {
+                        noteCount += el.notes.length;
+                    }
+                }
+                segment = segment.nextInMeasure;
+            }
+            measure = measure.nextMeasure;
+        }
+        return noteCount;
+    }
+
+    function noteCount(score) {
+        return score.notesInRange().pitch.length;
+    }
+
+    onRun: {
+        var score = newScore("Benchmark", "piano", measureCount);
+
+        var start = Date.now();
+        fill(score);
+        console.log("fill in one batch: " + elapsed(start));
+
+        start = Date.now();
+        var walked = walk(score);
+        console.log("walk: " + walked + " notes, " + elapsed(start));
+
+        start = Date.now();
+        walked = walk(score);
+        console.log("second walk: " + walked + " notes, " + elapsed(start));
+
+        start = Date.now();
+        var notes = noteCount(score);
+        console.log("notesInRange: " + notes + " notes, " + elapsed(start));
+
+        console.log("same wrapper for the same element: " + (score.firstMeasure === score.firstMeasure));
+
+        Qt.quit(); // WARNING: this kills off ALL active plugins!
+    }
+}
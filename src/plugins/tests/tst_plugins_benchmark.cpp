@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <QQmlComponent>
+#include <QQmlEngine>
+
+#include "testing/qtestsuite.h"
+
+#include "compat/scoreaccess.h"
+#include "libmscore/masterscore.h"
+
+#include "plugins/api/qmlpluginapi.h"
+#include "plugins/api/score.h"
+
+static const QString BENCHMARK_PLUGIN("/data/benchmark.qml");
+
+using namespace Ms;
+
+//---------------------------------------------------------
+//   BenchPlugins
+//    the benchmark plugin, which is not shipped with the
+//    application, run on a score created like its
+//    newScore() call does: filling the score in one batch,
+//    walking it element by element through the wrappers
+//    and reading all its notes at once
+//---------------------------------------------------------
+
+class BenchPlugins : public QObject
+{
+    Q_OBJECT
+
+    QQmlEngine* m_engine = nullptr;
+    QObject* m_plugin = nullptr;
+    MasterScore* m_score = nullptr;
+    int m_measureCount = 0;
+
+    QVariant call(const char* function) const;
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void fill();
+    void walk();
+    void notesInRange();
+};
+
+//---------------------------------------------------------
+//   initTestCase
+//---------------------------------------------------------
+
+void BenchPlugins::initTestCase()
+{
+    PluginAPI::PluginAPI::registerQmlTypes();
+
+    m_engine = new QQmlEngine(this);
+    QQmlComponent component(m_engine, QUrl::fromLocalFile(QString(plugins_benchmark_DATA_ROOT) + BENCHMARK_PLUGIN));
+    m_plugin = component.create();
+    QVERIFY2(m_plugin, qPrintable(component.errorString()));
+
+    m_measureCount = m_plugin->property("measureCount").toInt();
+    QVERIFY(m_measureCount > 0);
+
+    m_score = mu::engraving::compat::ScoreAccess::createMasterScoreWithDefaultStyle();
+    m_score->setName("Benchmark");
+    m_score->appendPart(PluginAPI::Score::instrTemplateFromName("piano"));
+    m_score->appendMeasures(m_measureCount);
+    m_score->doLayout();
+}
+
+void BenchPlugins::cleanupTestCase()
+{
+    delete m_plugin;
+    m_plugin = nullptr;
+
+    delete m_engine;
+    m_engine = nullptr;
+
+    delete m_score;
+    m_score = nullptr;
+}
+
+//---------------------------------------------------------
+//   call
+//    calls a function of the plugin with the score
+//---------------------------------------------------------
+
+QVariant BenchPlugins::call(const char* function) const
+{
+    QObject* score = PluginAPI::wrap<PluginAPI::Score>(m_score, PluginAPI::Ownership::SCORE);
+
+    QVariant result;
+    bool ok = QMetaObject::invokeMethod(m_plugin, function, Q_RETURN_ARG(QVariant, result),
+                                        Q_ARG(QVariant, QVariant::fromValue(score)));
+    if (!ok) {
+        qWarning() << "failed call plugin function:" << function;
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   fill
+//    a quarter note per beat, added with a cursor
+//    in one batch laid out once at the end
+//---------------------------------------------------------
+
+void BenchPlugins::fill()
+{
+    QBENCHMARK_ONCE {
+        call("fill");
+    }
+
+    QCOMPARE(call("noteCount").toInt(), m_measureCount * 4);
+}
+
+//---------------------------------------------------------
+//   walk
+//    measures, segments and tracks of the whole score,
+//    the way analysis plugins usually read it
+//---------------------------------------------------------
+
+void BenchPlugins::walk()
+{
+    int noteCount = 0;
+    QBENCHMARK {
+        noteCount = call("walk").toInt();
+    }
+
+    QCOMPARE(noteCount, m_measureCount * 4);
+    qInfo() << "walked notes:" << noteCount;
+}
+
+//---------------------------------------------------------
+//   notesInRange
+//    the same notes, read as arrays in one call
+//---------------------------------------------------------
+
+void BenchPlugins::notesInRange()
+{
+    int noteCount = 0;
+    QBENCHMARK {
+        noteCount = call("noteCount").toInt();
+    }
+
+    QCOMPARE(noteCount, m_measureCount * 4);
+    qInfo() << "notesInRange notes:" << noteCount;
+}
+
+QTEST_MAIN(BenchPlugins)
+#include "tst_plugins_benchmark.moc"
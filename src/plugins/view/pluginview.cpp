@@ -25,6 +25,7 @@
 #include <QQmlComponent>
 
 #include "api/qmlplugin.h"
+#include "api/score.h"
 
 #include "log.h"
 
@@ -41,6 +42,8 @@ PluginView::~PluginView()
 {
     destroyView();
     delete m_component;
+
+    Ms::PluginAPI::endOpenBatches();
 }
 
 void PluginView::destroyView()
@@ -104,5 +107,11 @@ void PluginView::run()
     connect(m_view, SIGNAL(closing(QQuickCloseEvent*)), this, SIGNAL(finished()));
 
     m_qmlPlugin->runPlugin();
+
+    //! NOTE A plugin without a UI is finished once onRun returns, also when it has thrown
+    if (m_qmlPlugin->pluginType().isEmpty()) {
+        Ms::PluginAPI::endOpenBatches();
+    }
+
     m_view->show();
 }
@@ -26,6 +26,7 @@
 
 #include "io/path.h"
 #include "ret.h"
+#include "async/channel.h"
 
 #include "projecttypes.h"
 #include "notation/imasternotation.h"
@@ -47,6 +48,10 @@ public:
     virtual ValNt<bool> needSave() const = 0;
 
     virtual Ret save(const io::path& path = io::path(), SaveMode saveMode = SaveMode::Save) = 0;
+
+    //! NOTE The result of a successful SaveMode::AutoSave is sent here,
+    //! once the file is written (in the background for MSCZ projects)
+    virtual async::Channel<Ret> autoSaveFinished() const = 0;
     virtual Ret writeToDevice(io::Device* device) = 0;
 
     virtual ProjectMeta metaInfo() const = 0;
@@ -21,6 +21,7 @@
  */
 #include "mscmetareader.h"
 
+#include <memory>
 #include <sstream>
 
 #include <QBuffer>
@@ -36,6 +37,19 @@ using namespace mu::framework;
 using namespace mu::system;
 using namespace mu::engraving;
 
+void MscMetaReader::init()
+{
+    //! NOTE readMeta is called from several threads, so the dependencies are resolved here
+    fileSystem();
+
+    m_cache.load(configuration()->projectMetaCachePath());
+}
+
+void MscMetaReader::deinit()
+{
+    m_cache.save();
+}
+
 mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
 {
     RetVal<ProjectMeta> meta;
@@ -46,6 +60,11 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
         return meta;
     }
 
+    if (m_cache.meta(filePath, meta.val)) {
+        meta.val.filePath = filePath;
+        return meta;
+    }
+
     MscReader::Params params;
     params.filePath = filePath.toQString();
     params.mode = mscIoModeBySuffix(io::suffix(filePath));
@@ -59,11 +78,17 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
     }
 
     // Read score meta
-    QByteArray scoreData = msczReader.readScoreFile();
-    framework::XmlReader xmlReader(scoreData);
+    // The score file is inflated as it is parsed, and parsing stops after the score header
+    std::unique_ptr<QIODevice> scoreDevice(msczReader.openScoreFile());
+    if (!scoreDevice) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    framework::XmlReader xmlReader(scoreDevice.get());
     doReadMeta(xmlReader, meta.val);
 
     // Read thumbnail
+    // Decoded to a QImage: meta is read on pool threads, where QPixmap can't be used
     QByteArray thumbnailData = msczReader.readThumbnailFile();
     if (thumbnailData.isEmpty()) {
         LOGD() << "Can't find thumbnail";
@@ -77,6 +102,8 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path& filePath) const
 
     meta.val.filePath = filePath;
 
+    m_cache.setMeta(filePath, meta.val, thumbnailData);
+
     return meta;
 }
 
@@ -173,6 +200,8 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(framework::XmlReader& xmlRea
                 xmlReader.skipCurrentElement();
             }
         } else if (tag == "Staff") {
+            //! NOTE The title frames are in the first staff, and everything else we need is above it,
+            //! so the rest of the score isn't read
             if (meta.titleStyle.isEmpty()) {
                 while (xmlReader.readNextStartElement()) {
                     std::string boxTag(xmlReader.tagName());
@@ -195,9 +224,8 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(framework::XmlReader& xmlRea
                         xmlReader.skipCurrentElement();
                     }
                 }
-            } else {
-                xmlReader.skipCurrentElement();
             }
+            break;
         } else if (tag == "Part") {
             meta.partsCount++;
             xmlReader.skipCurrentElement();
@@ -212,18 +240,21 @@ MscMetaReader::RawMeta MscMetaReader::doReadRawMeta(framework::XmlReader& xmlRea
 void MscMetaReader::doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const
 {
     RawMeta rawMeta;
+    bool scoreRead = false;
 
-    while (xmlReader.readNextStartElement()) {
+    while (!scoreRead && xmlReader.readNextStartElement()) {
         if (xmlReader.tagName() == "museScore") {
             std::string version = xmlReader.attribute("version");
             bool suitedVersion = version.rfind("1", 0) == 0;
 
             if (suitedVersion) {
                 rawMeta = doReadRawMeta(xmlReader);
+                scoreRead = true;
             } else {
-                while (xmlReader.readNextStartElement()) {
+                while (!scoreRead && xmlReader.readNextStartElement()) {
                     if (xmlReader.tagName() == "Score") {
                         rawMeta = doReadRawMeta(xmlReader);
+                        scoreRead = true;
                     } else {
                         xmlReader.skipCurrentElement();
                     }
@@ -26,6 +26,8 @@
 
 #include "system/ifilesystem.h"
 #include "modularity/ioc.h"
+#include "iprojectconfiguration.h"
+#include "projectmetacache.h"
 
 namespace mu::framework {
 class XmlReader;
@@ -35,8 +37,12 @@ namespace mu::project {
 class MscMetaReader : public IMscMetaReader
 {
     INJECT(project, system::IFileSystem, fileSystem)
+    INJECT(project, IProjectConfiguration, configuration)
 
 public:
+    void init();
+    void deinit();
+
     RetVal<ProjectMeta> readMeta(const io::path& filePath) const;
 
 private:
@@ -79,6 +85,8 @@ private:
 
     QString readText(framework::XmlReader& xmlReader) const;
     QString readMetaTagText(framework::XmlReader& xmlReader) const;
+
+    mutable ProjectMetaCache m_cache;
 };
 }
 
@@ -24,6 +24,11 @@
 #include <QBuffer>
 #include <QFileInfo>
 #include <QFile>
+#include <QSaveFile>
+#include <QtConcurrent>
+
+#include "thirdparty/qzip/qzipreader_p.h"
+#include "thirdparty/qzip/qzipwriter_p.h"
 
 #include "engraving/engravingproject.h"
 #include "engraving/compat/scoreaccess.h"
@@ -31,6 +36,8 @@
 #include "engraving/infrastructure/io/mscio.h"
 #include "engraving/engravingerrors.h"
 #include "engraving/style/defaultstyle.h"
+#include "engraving/libmscore/editjournal.h"
+#include "engraving/libmscore/masterscore.h"
 
 #include "notation/notationerrors.h"
 #include "projectaudiosettings.h"
@@ -104,6 +111,19 @@ NotationProject::NotationProject()
     m_masterNotation = std::shared_ptr<MasterNotation>(new MasterNotation());
     m_projectAudioSettings = std::shared_ptr<ProjectAudioSettings>(new ProjectAudioSettings());
     m_viewSettings = std::shared_ptr<ProjectViewSettings>(new ProjectViewSettings());
+
+    QObject::connect(&m_autoSaveWatcher, &QFutureWatcherBase::finished, [this]() {
+        m_autoSaveFinished.send(m_autoSaveWatcher.result());
+    });
+}
+
+NotationProject::~NotationProject()
+{
+    m_autoSaveFuture.waitForFinished();
+
+    if (m_engravingProject && m_engravingProject->masterScore()) {
+        m_engravingProject->masterScore()->setEditJournal(nullptr);
+    }
 }
 
 mu::io::path NotationProject::path() const
@@ -125,8 +145,9 @@ mu::Ret NotationProject::load(const io::path& path, const io::path& stylePath, b
     MscReader::Params params;
 
     bool needRestoreUnsavedChanges = projectAutoSaver()->projectHasUnsavedChanges(path);
-    if (needRestoreUnsavedChanges) {
-        params.filePath = projectAutoSaver()->projectAutoSavePath(path).toQString();
+    io::path autoSavePath = projectAutoSaver()->projectAutoSavePath(path);
+    if (needRestoreUnsavedChanges && fileSystem()->exists(autoSavePath)) {
+        params.filePath = autoSavePath.toQString();
     } else {
         params.filePath = path.toQString();
     }
@@ -148,9 +169,20 @@ mu::Ret NotationProject::load(const io::path& path, const io::path& stylePath, b
 
     if (needRestoreUnsavedChanges) {
         m_engravingProject->setPath(path.toQString());
+
+        // replay the commands done after the last snapshot
+        QString journalPath = projectAutoSaver()->projectJournalPath(path).toQString();
+        Ms::EditJournal::ReplayResult replay = Ms::EditJournal::replay(journalPath, m_engravingProject->masterScore());
+        LOGI() << "replayed " << replay.replayed << " commands from: " << journalPath;
+        if (!replay.complete) {
+            LOGW() << "the unsaved changes were restored only partially, the last autosave has been used for the rest";
+        }
+
         m_masterNotation->score()->setSaved(false);
     }
 
+    setupEditJournal(needRestoreUnsavedChanges);
+
     return ret;
 }
 
@@ -348,6 +380,10 @@ mu::Ret NotationProject::loadTemplate(const ProjectCreateOptions& projectOptions
 mu::Ret NotationProject::save(const io::path& path, SaveMode saveMode)
 {
     TRACEFUNC;
+
+    // Don't let a pending autosave write over (or recreate) files behind this save
+    m_autoSaveFuture.waitForFinished();
+
     switch (saveMode) {
     case SaveMode::SaveSelection:
         return saveSelectionOnScore(path);
@@ -369,6 +405,7 @@ mu::Ret NotationProject::save(const io::path& path, SaveMode saveMode)
         if (ret) {
             if (saveMode != SaveMode::SaveCopy || oldFilePath == savePath) {
                 m_masterNotation->onSaveCopy();
+                setupEditJournal(false);
             }
         }
 
@@ -378,7 +415,22 @@ mu::Ret NotationProject::save(const io::path& path, SaveMode saveMode)
         io::path originalPath = projectAutoSaver()->projectOriginalPath(path);
         std::string suffix = io::suffix(originalPath);
 
-        Ret ret = saveScore(path, suffix);
+        Ret ret;
+        if (mscIoModeBySuffix(suffix) == MscIoMode::Zip) {
+            ret = doAutoSave(path);
+        } else {
+            qint64 journalMark = m_editJournal ? m_editJournal->size() : 0;
+            ret = saveScore(path, suffix);
+            if (ret && m_editJournal) {
+                m_editJournal->discardUntil(journalMark);
+            }
+
+            //! NOTE Written synchronously, report it the same way as a background write
+            if (ret) {
+                m_autoSaveFinished.send(ret);
+            }
+        }
+
         if (ret) {
             m_masterNotation->score()->setSaved(false);
         }
@@ -441,6 +493,11 @@ mu::Ret NotationProject::doSave(const io::path& path, bool generateBackup, engra
             return make_ret(Ret::Code::InternalError);
         }
 
+        // reuse the entries that have not changed since the file was last written
+        if (ioMode == MscIoMode::Zip && QFileInfo::exists(currentPath)) {
+            params.previousFilePath = currentPath;
+        }
+
         MscWriter msczWriter(params);
         Ret ret = writeProject(msczWriter, false);
         if (!ret) {
@@ -448,7 +505,9 @@ mu::Ret NotationProject::doSave(const io::path& path, bool generateBackup, engra
             return ret;
         }
 
-        msczWriter.close();
+        if (!msczWriter.close()) {
+            return make_ret(notation::Err::UnknownError);
+        }
     }
 
     // Step 3: create backup if need
@@ -476,6 +535,123 @@ mu::Ret NotationProject::doSave(const io::path& path, bool generateBackup, engra
     return make_ret(Ret::Code::Ok);
 }
 
+mu::Ret NotationProject::doAutoSave(const io::path& path)
+{
+    // Step 1: take a snapshot of the project.
+    // The score isn't thread safe, so it is serialized here, on the main thread,
+    // but the entries are only stored: compression is the expensive part
+    QByteArray snapshot;
+    {
+        QBuffer buffer(&snapshot);
+
+        MscWriter::Params params;
+        params.device = &buffer;
+        params.filePath = path.toQString();
+        params.mode = MscIoMode::Zip;
+        params.compression = MscWriter::Compression::Store;
+
+        MscWriter msczWriter(params);
+        Ret ret = writeProject(msczWriter, false);
+        if (!ret) {
+            LOGE() << "failed write project snapshot";
+            return ret;
+        }
+
+        if (!msczWriter.close()) {
+            return make_ret(notation::Err::UnknownError);
+        }
+    }
+
+    // Step 2: compress and write the snapshot in the background,
+    // then drop the journal entries it contains
+    qint64 journalMark = m_editJournal ? m_editJournal->size() : 0;
+    m_autoSaveFuture = QtConcurrent::run(&NotationProject::th_writeAutoSave, snapshot, path.toQString(),
+                                         m_editJournal.get(), journalMark);
+    m_autoSaveWatcher.setFuture(m_autoSaveFuture);
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret NotationProject::th_writeAutoSave(const QByteArray& snapshot, const QString& path, Ms::EditJournal* journal,
+                                          qint64 journalMark)
+{
+    TRACEFUNC;
+
+    QByteArray compressed;
+    {
+        QBuffer srcBuffer(const_cast<QByteArray*>(&snapshot));
+        srcBuffer.open(QIODevice::ReadOnly);
+        MQZipReader reader(&srcBuffer);
+
+        QBuffer dstBuffer(&compressed);
+        dstBuffer.open(QIODevice::WriteOnly);
+        MQZipWriter writer(&dstBuffer);
+        // autosaves favour speed over size
+        writer.setCompressionLevel(1);
+
+        for (const MQZipReader::FileInfo& fi : reader.fileInfoList()) {
+            if (fi.isFile) {
+                writer.addFile(fi.filePath, reader.fileData(fi.filePath));
+            }
+        }
+
+        writer.close();
+        if (writer.status() != MQZipWriter::NoError) {
+            LOGE() << "[autosave] failed compress snapshot, status: " << writer.status();
+            return make_ret(notation::Err::UnknownError);
+        }
+    }
+
+    // QSaveFile writes to a temporary file and renames it over the target on commit
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "[autosave] failed open file: " << path;
+        return make_ret(notation::Err::FileOpenError);
+    }
+
+    file.write(compressed);
+    if (!file.commit()) {
+        LOGE() << "[autosave] failed write file: " << path << ", err: " << file.errorString();
+        return make_ret(notation::Err::UnknownError);
+    }
+
+    if (journal) {
+        journal->discardUntil(journalMark);
+    }
+
+    LOGD() << "[autosave] success save file: " << path;
+    return make_ret(Ret::Code::Ok);
+}
+
+void NotationProject::setupEditJournal(bool keepEntries)
+{
+    m_autoSaveFuture.waitForFinished();
+
+    Ms::MasterScore* score = m_engravingProject->masterScore();
+    if (score) {
+        score->setEditJournal(nullptr);
+    }
+
+    io::path projectPath = m_engravingProject->path();
+    QString journalPath = projectAutoSaver()->projectJournalPath(projectPath).toQString();
+
+    if (m_editJournal && m_editJournal->filePath() != journalPath) {
+        m_editJournal->reset();
+    }
+    m_editJournal.reset();
+
+    if (!score || !configuration()->isAutoSaveEnabled() || !created().val || !isMuseScoreFile(io::suffix(projectPath))) {
+        return;
+    }
+
+    m_editJournal = std::make_unique<Ms::EditJournal>(journalPath);
+    if (!keepEntries) {
+        m_editJournal->reset();
+    }
+
+    score->setEditJournal(m_editJournal.get());
+}
+
 mu::Ret NotationProject::makeCurrentFileAsBackup()
 {
     if (!created().val) {
@@ -603,6 +779,11 @@ mu::RetVal<bool> NotationProject::created() const
     return m_masterNotation->created();
 }
 
+mu::async::Channel<mu::Ret> NotationProject::autoSaveFinished() const
+{
+    return m_autoSaveFinished;
+}
+
 mu::ValNt<bool> NotationProject::needSave() const
 {
     return m_masterNotation->needSave();
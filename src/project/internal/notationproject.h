@@ -22,6 +22,9 @@
 #ifndef MU_PROJECT_NOTATIONPROJECT_H
 #define MU_PROJECT_NOTATIONPROJECT_H
 
+#include <QFuture>
+#include <QFutureWatcher>
+
 #include "../inotationproject.h"
 
 #include "modularity/ioc.h"
@@ -29,6 +32,7 @@
 #include "inotationreadersregister.h"
 #include "inotationwritersregister.h"
 #include "iprojectautosaver.h"
+#include "iprojectconfiguration.h"
 
 #include "engraving/engravingproject.h"
 
@@ -42,6 +46,10 @@ class MscReader;
 class MscWriter;
 }
 
+namespace Ms {
+class EditJournal;
+}
+
 namespace mu::project {
 class NotationProject : public INotationProject
 {
@@ -50,9 +58,11 @@ class NotationProject : public INotationProject
     INJECT(project, INotationWritersRegister, writers)
     INJECT(project, IProjectMigrator, migrator)
     INJECT(project, IProjectAutoSaver, projectAutoSaver)
+    INJECT(project, IProjectConfiguration, configuration)
 
 public:
     NotationProject();
+    ~NotationProject();
 
     io::path path() const override;
 
@@ -63,6 +73,7 @@ public:
     ValNt<bool> needSave() const override;
 
     Ret save(const io::path& path = io::path(), SaveMode saveMode = SaveMode::Save) override;
+    async::Channel<Ret> autoSaveFinished() const override;
     Ret writeToDevice(io::Device* device) override;
 
     ProjectMeta metaInfo() const override;
@@ -82,6 +93,9 @@ private:
     Ret saveSelectionOnScore(const io::path& path = io::path());
     Ret exportProject(const io::path& path, const std::string& suffix);
     Ret doSave(const io::path& path, bool generateBackup, engraving::MscIoMode ioMode);
+    Ret doAutoSave(const io::path& path);
+    static Ret th_writeAutoSave(const QByteArray& snapshot, const QString& path, Ms::EditJournal* journal, qint64 journalMark);
+    void setupEditJournal(bool keepEntries);
     Ret makeCurrentFileAsBackup();
     Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection);
 
@@ -89,6 +103,11 @@ private:
     notation::MasterNotationPtr m_masterNotation = nullptr;
     ProjectAudioSettingsPtr m_projectAudioSettings = nullptr;
     ProjectViewSettingsPtr m_viewSettings = nullptr;
+
+    std::unique_ptr<Ms::EditJournal> m_editJournal;
+    QFuture<Ret> m_autoSaveFuture;
+    QFutureWatcher<Ret> m_autoSaveWatcher;
+    async::Channel<Ret> m_autoSaveFinished;
 };
 }
 
@@ -21,9 +21,12 @@
  */
 #include "projectautosaver.h"
 
+#include "engraving/libmscore/editjournal.h"
+
 #include "log.h"
 
 static const std::string AUTOSAVE_SUFFIX = ".autosave";
+static const std::string JOURNAL_SUFFIX = ".journal";
 
 using namespace mu::project;
 
@@ -58,6 +61,22 @@ void ProjectAutoSaver::init()
             return;
         }
 
+        m_changedSinceAutoSave = true;
+        m_autoSaveRunning = false;
+
+        currentProject->masterNotation()->undoStack()->stackChanged().onNotify(this, [this]() {
+            m_changedSinceAutoSave = true;
+            m_changedDuringAutoSave = true;
+        });
+
+        INotationProject* project = currentProject.get();
+        currentProject->autoSaveFinished().onReceive(this, [this, project](const Ret& ret) {
+            if (project != globalContext()->currentProject().get()) {
+                return;
+            }
+            onAutoSaveFinished(ret);
+        });
+
         currentProject->needSave().notification.onNotify(this, [this, currentProject](){
             if (!currentProject->needSave().val) {
                 removeProjectUnsavedChanges(currentProject->path());
@@ -69,12 +88,21 @@ void ProjectAutoSaver::init()
 bool ProjectAutoSaver::projectHasUnsavedChanges(const io::path& projectPath) const
 {
     io::path autoSavePath = projectAutoSavePath(projectPath);
-    return fileSystem()->exists(autoSavePath);
+    if (fileSystem()->exists(autoSavePath)) {
+        return true;
+    }
+
+    return Ms::EditJournal::hasEntries(projectJournalPath(projectPath).toQString());
 }
 
 void ProjectAutoSaver::removeProjectUnsavedChanges(const io::path& projectPath)
 {
     fileSystem()->remove(projectAutoSavePath(projectPath));
+
+    io::path journalPath = projectJournalPath(projectPath);
+    if (fileSystem()->exists(journalPath)) {
+        fileSystem()->remove(journalPath);
+    }
 }
 
 mu::io::path ProjectAutoSaver::projectOriginalPath(const mu::io::path& projectAutoSavePath) const
@@ -87,6 +115,11 @@ mu::io::path ProjectAutoSaver::projectAutoSavePath(const io::path& projectPath)
     return projectPath + AUTOSAVE_SUFFIX;
 }
 
+mu::io::path ProjectAutoSaver::projectJournalPath(const io::path& projectPath) const
+{
+    return projectPath + JOURNAL_SUFFIX;
+}
+
 void ProjectAutoSaver::onTrySave()
 {
     INotationProjectPtr project = globalContext()->currentProject();
@@ -105,13 +138,42 @@ void ProjectAutoSaver::onTrySave()
         return;
     }
 
+    if (!m_changedSinceAutoSave) {
+        LOGD() << "[autosave] project has not changed since the last autosave";
+        return;
+    }
+
+    if (m_autoSaveRunning) {
+        LOGD() << "[autosave] previous autosave is still being written";
+        return;
+    }
+
     io::path savePath = projectAutoSavePath(project->path());
 
+    //! NOTE Cleared in onAutoSaveFinished(), which is called before save() returns
+    //! when the project is not written in the background
+    m_autoSaveRunning = true;
+    m_changedDuringAutoSave = false;
+
     Ret ret = project->save(savePath, SaveMode::AutoSave);
     if (!ret) {
         LOGE() << "[autosave] failed to save project, err: " << ret.toString();
+        m_autoSaveRunning = false;
+        return;
+    }
+}
+
+void ProjectAutoSaver::onAutoSaveFinished(const Ret& ret)
+{
+    m_autoSaveRunning = false;
+
+    if (!ret) {
+        LOGE() << "[autosave] failed to write autosave, err: " << ret.toString();
         return;
     }
 
+    // edits made while the file was written are not in it
+    m_changedSinceAutoSave = m_changedDuringAutoSave;
+
     LOGD() << "[autosave] successfully saved project";
 }
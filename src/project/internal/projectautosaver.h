@@ -50,11 +50,16 @@ public:
 
     io::path projectOriginalPath(const io::path& projectAutoSavePath) const override;
     io::path projectAutoSavePath(const io::path& projectPath) const override;
+    io::path projectJournalPath(const io::path& projectPath) const override;
 
 private:
     void onTrySave();
+    void onAutoSaveFinished(const Ret& ret);
 
     QTimer m_timer;
+    bool m_changedSinceAutoSave = false;
+    bool m_changedDuringAutoSave = false;
+    bool m_autoSaveRunning = false;
 };
 }
 
@@ -203,6 +203,11 @@ io::path ProjectConfiguration::defaultSavingFilePath(const io::path& fileName) c
     return userProjectsPath() + "/" + fileName + DEFAULT_FILE_SUFFIX;
 }
 
+io::path ProjectConfiguration::projectMetaCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/projectmeta.cache";
+}
+
 QColor ProjectConfiguration::templatePreviewBackgroundColor() const
 {
     return notationConfiguration()->backgroundColor();
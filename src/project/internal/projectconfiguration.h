@@ -63,6 +63,8 @@ public:
 
     io::path defaultSavingFilePath(const io::path& fileName) const override;
 
+    io::path projectMetaCachePath() const override;
+
     QColor templatePreviewBackgroundColor() const override;
     async::Notification templatePreviewBackgroundChanged() const override;
 
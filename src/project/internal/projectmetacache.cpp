@@ -0,0 +1,256 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "projectmetacache.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QTimer>
+
+#include "log.h"
+
+using namespace mu::project;
+
+static constexpr quint32 CACHE_MAGIC = 0x4d534d43; // MSMC
+static constexpr quint32 CACHE_VERSION = 1;
+static constexpr int MAX_ENTRIES = 2000;
+static constexpr int SAVE_DELAY_MS = 2000;
+
+static void writeMeta(QDataStream& stream, const ProjectMeta& meta)
+{
+    stream << meta.fileName.toQString()
+           << meta.title
+           << meta.subtitle
+           << meta.composer
+           << meta.lyricist
+           << meta.copyright
+           << meta.translator
+           << meta.arranger
+           << quint64(meta.partsCount)
+           << meta.creationDate
+           << meta.source
+           << meta.platform
+           << meta.musescoreVersion
+           << qint32(meta.musescoreRevision)
+           << qint32(meta.mscVersion)
+           << meta.additionalTags;
+}
+
+static void readMeta(QDataStream& stream, ProjectMeta& meta)
+{
+    QString fileName;
+    quint64 partsCount = 0;
+    qint32 musescoreRevision = 0;
+    qint32 mscVersion = 0;
+
+    stream >> fileName
+    >> meta.title
+    >> meta.subtitle
+    >> meta.composer
+    >> meta.lyricist
+    >> meta.copyright
+    >> meta.translator
+    >> meta.arranger
+    >> partsCount
+    >> meta.creationDate
+    >> meta.source
+    >> meta.platform
+    >> meta.musescoreVersion
+    >> musescoreRevision
+    >> mscVersion
+    >> meta.additionalTags;
+
+    meta.fileName = fileName;
+    meta.partsCount = partsCount;
+    meta.musescoreRevision = musescoreRevision;
+    meta.mscVersion = mscVersion;
+}
+
+ProjectMetaCache::FileStamp ProjectMetaCache::fileStamp(const QString& filePath)
+{
+    QFileInfo info(filePath);
+    return { info.lastModified().toMSecsSinceEpoch(), info.size() };
+}
+
+void ProjectMetaCache::load(const io::path& cachePath)
+{
+    TRACEFUNC;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_cachePath = cachePath;
+    m_entries.clear();
+    m_changed = false;
+
+    QFile file(cachePath.toQString());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_9);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint32 count = 0;
+    stream >> magic >> version >> count;
+    if (magic != CACHE_MAGIC || version != CACHE_VERSION) {
+        LOGD() << "unsupported cache: " << cachePath;
+        return;
+    }
+
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString filePath;
+        Entry entry;
+        stream >> filePath >> entry.stamp.lastModified >> entry.stamp.size;
+        readMeta(stream, entry.meta);
+        stream >> entry.thumbnailData;
+
+        if (stream.status() == QDataStream::Ok) {
+            entry.meta.filePath = filePath;
+            m_entries.insert(filePath, entry);
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        LOGW() << "cache is damaged, ignored: " << cachePath;
+        m_entries.clear();
+    }
+}
+
+void ProjectMetaCache::save()
+{
+    TRACEFUNC;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_saveScheduled = false;
+
+    if (!m_changed || m_cachePath.empty()) {
+        return;
+    }
+
+    // entries of files not shown in this session go first
+    if (m_entries.size() > MAX_ENTRIES) {
+        for (auto it = m_entries.begin(); it != m_entries.end() && m_entries.size() > MAX_ENTRIES;) {
+            it = it->used ? std::next(it) : m_entries.erase(it);
+        }
+    }
+
+    QSaveFile file(m_cachePath.toQString());
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << m_cachePath;
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_9);
+    stream << CACHE_MAGIC << CACHE_VERSION << qint32(m_entries.size());
+
+    for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it) {
+        stream << it.key() << it->stamp.lastModified << it->stamp.size;
+        writeMeta(stream, it->meta);
+        stream << it->thumbnailData;
+    }
+
+    if (!file.commit()) {
+        LOGE() << "failed write file: " << m_cachePath << ", err: " << file.errorString();
+        return;
+    }
+
+    m_changed = false;
+}
+
+void ProjectMetaCache::scheduleSave()
+{
+    // called with m_mutex locked, possibly from a pool thread;
+    // the changes made until the timer fires are written at once
+    if (m_saveScheduled || !qApp) {
+        return;
+    }
+
+    m_saveScheduled = true;
+    QMetaObject::invokeMethod(qApp, [this]() {
+        QTimer::singleShot(SAVE_DELAY_MS, qApp, [this]() {
+            save();
+        });
+    }, Qt::QueuedConnection);
+}
+
+bool ProjectMetaCache::meta(const io::path& filePath, ProjectMeta& meta)
+{
+    QString path = filePath.toQString();
+    FileStamp stamp = fileStamp(path);
+
+    QByteArray thumbnailData;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_entries.find(path);
+        if (it == m_entries.end() || !(it->stamp == stamp)) {
+            return false;
+        }
+
+        it->used = true;
+        meta = it->meta;
+        if (it->thumbnailDecoded) {
+            return true;
+        }
+
+        thumbnailData = it->thumbnailData;
+    }
+
+    // the thumbnail is decoded on the first hit only, and outside the lock
+    if (!thumbnailData.isEmpty()) {
+        meta.thumbnail.loadFromData(thumbnailData, "PNG");
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(path);
+    if (it != m_entries.end() && it->stamp == stamp) {
+        it->meta.thumbnail = meta.thumbnail;
+        it->thumbnailDecoded = true;
+    }
+
+    return true;
+}
+
+void ProjectMetaCache::setMeta(const io::path& filePath, const ProjectMeta& meta, const QByteArray& thumbnailData)
+{
+    QString path = filePath.toQString();
+
+    Entry entry;
+    entry.stamp = fileStamp(path);
+    entry.meta = meta;
+    entry.thumbnailData = thumbnailData;
+    entry.thumbnailDecoded = true;
+    entry.used = true;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.insert(path, entry);
+    m_changed = true;
+
+    scheduleSave();
+}
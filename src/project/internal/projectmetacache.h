@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PROJECT_PROJECTMETACACHE_H
+#define MU_PROJECT_PROJECTMETACACHE_H
+
+#include <mutex>
+
+#include <QHash>
+
+#include "io/path.h"
+#include "projecttypes.h"
+
+namespace mu::project {
+//! NOTE Persistent cache of the project meta shown by the Home page and the New Score dialog,
+//! so that unchanged files don't need to be opened again.
+//! Entries are keyed by the file path and validated by the file modification time and size.
+//! The cache is written back shortly after it changed, so that a crash doesn't lose it.
+class ProjectMetaCache
+{
+public:
+    void load(const io::path& cachePath);
+    void save();
+
+    bool meta(const io::path& filePath, ProjectMeta& meta);
+    void setMeta(const io::path& filePath, const ProjectMeta& meta, const QByteArray& thumbnailData);
+
+private:
+    struct FileStamp {
+        qint64 lastModified = 0;
+        qint64 size = 0;
+
+        bool operator==(const FileStamp& other) const { return lastModified == other.lastModified && size == other.size; }
+    };
+
+    struct Entry {
+        FileStamp stamp;
+        ProjectMeta meta;
+        QByteArray thumbnailData;
+        bool thumbnailDecoded = false;
+        bool used = false;
+    };
+
+    static FileStamp fileStamp(const QString& filePath);
+
+    void scheduleSave();
+
+    io::path m_cachePath;
+    QHash<QString, Entry> m_entries;
+    bool m_changed = false;
+    bool m_saveScheduled = false;
+    std::mutex m_mutex;
+};
+}
+
+#endif // MU_PROJECT_PROJECTMETACACHE_H
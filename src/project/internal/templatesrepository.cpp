@@ -29,6 +29,7 @@
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QtConcurrent>
 
 using namespace mu::project;
 
@@ -87,21 +88,32 @@ Templates TemplatesRepository::readTemplates(const io::paths& files, const QStri
 {
     TRACEFUNC;
 
-    Templates templates;
+    using TemplateMeta = std::pair<io::path, RetVal<ProjectMeta> >;
 
+    std::vector<TemplateMeta> metas;
     for (const io::path& file : files) {
-        io::path path = dirPath.empty() ? file : dirPath + "/" + file;
-        RetVal<ProjectMeta> meta = mscReader()->readMeta(path);
-        if (!meta.ret) {
+        metas.emplace_back(dirPath.empty() ? file : dirPath + "/" + file, RetVal<ProjectMeta>());
+    }
+
+    // Templates are independent files, so they are read in parallel
+    std::shared_ptr<IMscMetaReader> reader = mscReader();
+    QtConcurrent::blockingMap(metas, [reader](TemplateMeta& meta) {
+        meta.second = reader->readMeta(meta.first);
+    });
+
+    Templates templates;
+
+    for (TemplateMeta& meta : metas) {
+        if (!meta.second.ret) {
             LOGE() << QString("failed read template %1: %2")
-                .arg(path.toQString())
-                .arg(QString::fromStdString(meta.ret.toString()));
+                .arg(meta.first.toQString())
+                .arg(QString::fromStdString(meta.second.ret.toString()));
             continue;
         }
 
         Template templ;
         templ.categoryTitle = category;
-        templ.meta = std::move(meta.val);
+        templ.meta = std::move(meta.second.val);
 
         templates << templ;
     }
@@ -39,6 +39,7 @@ public:
 
     virtual io::path projectOriginalPath(const io::path& projectAutoSavePath) const = 0;
     virtual io::path projectAutoSavePath(const io::path& projectPath) const = 0;
+    virtual io::path projectJournalPath(const io::path& projectPath) const = 0;
 };
 }
 
@@ -58,6 +58,8 @@ public:
 
     virtual io::path defaultSavingFilePath(const io::path& fileName) const = 0;
 
+    virtual io::path projectMetaCachePath() const = 0;
+
     virtual QColor templatePreviewBackgroundColor() const = 0;
     virtual async::Notification templatePreviewBackgroundChanged() const = 0;
 
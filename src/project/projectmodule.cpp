@@ -64,6 +64,7 @@ static std::shared_ptr<ProjectConfiguration> s_configuration = std::make_shared<
 static std::shared_ptr<ProjectActionsController> s_actionsController = std::make_shared<ProjectActionsController>();
 static std::shared_ptr<RecentProjectsProvider> s_recentProjectsProvider = std::make_shared<RecentProjectsProvider>();
 static std::shared_ptr<ProjectAutoSaver> s_projectAutoSaver = std::make_shared<ProjectAutoSaver>();
+static std::shared_ptr<MscMetaReader> s_mscMetaReader = std::make_shared<MscMetaReader>();
 
 static void project_init_qrc()
 {
@@ -84,7 +85,7 @@ void ProjectModule::registerExports()
     ioc()->registerExport<IProjectFilesController>(moduleName(), s_actionsController);
     ioc()->registerExport<IExportProjectScenario>(moduleName(), new ExportProjectScenario());
     ioc()->registerExport<IRecentProjectsProvider>(moduleName(), s_recentProjectsProvider);
-    ioc()->registerExport<IMscMetaReader>(moduleName(), new MscMetaReader());
+    ioc()->registerExport<IMscMetaReader>(moduleName(), s_mscMetaReader);
     ioc()->registerExport<ITemplatesRepository>(moduleName(), new TemplatesRepository());
     ioc()->registerExport<IProjectMigrator>(moduleName(), new ProjectMigrator());
     ioc()->registerExport<IProjectAutoSaver>(moduleName(), s_projectAutoSaver);
@@ -140,4 +141,10 @@ void ProjectModule::onInit(const framework::IApplication::RunMode& mode)
     s_actionsController->init();
     s_recentProjectsProvider->init();
     s_projectAutoSaver->init();
+    s_mscMetaReader->init();
+}
+
+void ProjectModule::onDeinit()
+{
+    s_mscMetaReader->deinit();
 }
@@ -23,6 +23,7 @@
 #define MU_PROJECT_PROJECTTYPES_H
 
 #include <QString>
+#include <QImage>
 
 #include "io/path.h"
 
@@ -77,7 +78,7 @@ struct ProjectMeta
     QString translator;
     QString arranger;
     size_t partsCount = 0;
-    QPixmap thumbnail;
+    QImage thumbnail;
     QDate creationDate;
 
     QString source;
@@ -49,6 +49,8 @@ public:
 
     MOCK_METHOD(io::path, defaultSavingFilePath, (const io::path&), (const, override));
 
+    MOCK_METHOD(io::path, projectMetaCachePath, (), (const, override));
+
     MOCK_METHOD(QColor, templatePreviewBackgroundColor, (), (const, override));
     MOCK_METHOD(async::Notification, templatePreviewBackgroundChanged, (), (const, override));
 
@@ -0,0 +1,181 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QBuffer>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QImage>
+#include <QTemporaryDir>
+
+#include "project/internal/projectmetacache.h"
+
+using namespace mu;
+using namespace mu::project;
+
+class ProjectMetaCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(m_dir.isValid());
+
+        m_cachePath = m_dir.filePath("projectmetacache");
+        m_projectPath = m_dir.filePath("project.mscz");
+
+        writeProject("project data");
+    }
+
+    void writeProject(const QByteArray& data)
+    {
+        QFile file(m_projectPath.toQString());
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(data);
+    }
+
+    static ProjectMeta projectMeta()
+    {
+        ProjectMeta meta;
+        meta.fileName = "project";
+        meta.title = "Title";
+        meta.composer = "Composer";
+        meta.partsCount = 3;
+        meta.mscVersion = 400;
+        return meta;
+    }
+
+    static QByteArray thumbnailPng()
+    {
+        QImage image(4, 2, QImage::Format_ARGB32);
+        image.fill(Qt::red);
+
+        QByteArray data;
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::WriteOnly);
+        image.save(&buffer, "PNG");
+        return data;
+    }
+
+    QTemporaryDir m_dir;
+    io::path m_cachePath;
+    io::path m_projectPath;
+};
+
+TEST_F(ProjectMetaCacheTest, Hit)
+{
+    // [GIVEN] The meta of a project stored in the cache, which is then saved and loaded again
+    {
+        ProjectMetaCache cache;
+        cache.load(m_cachePath);
+        cache.setMeta(m_projectPath, projectMeta(), thumbnailPng());
+        cache.save();
+    }
+
+    ProjectMetaCache cache;
+    cache.load(m_cachePath);
+
+    // [WHEN] The meta of the unchanged project is requested
+    ProjectMeta meta;
+    bool found = cache.meta(m_projectPath, meta);
+
+    // [THEN] It is found, with its thumbnail
+    EXPECT_TRUE(found);
+    EXPECT_EQ(meta.title, "Title");
+    EXPECT_EQ(meta.composer, "Composer");
+    EXPECT_EQ(meta.partsCount, size_t(3));
+    EXPECT_EQ(meta.mscVersion, 400);
+    EXPECT_EQ(meta.thumbnail.size(), QSize(4, 2));
+
+    // [THEN] The thumbnail decoded by the first hit is reused
+    ProjectMeta second;
+    EXPECT_TRUE(cache.meta(m_projectPath, second));
+    EXPECT_EQ(second.thumbnail.cacheKey(), meta.thumbnail.cacheKey());
+}
+
+TEST_F(ProjectMetaCacheTest, InvalidatedBySize)
+{
+    // [GIVEN] The meta of a project stored in the cache
+    ProjectMetaCache cache;
+    cache.load(m_cachePath);
+    cache.setMeta(m_projectPath, projectMeta(), QByteArray());
+
+    // [WHEN] The project file changes size
+    writeProject("project data, changed");
+
+    // [THEN] The cached meta isn't used
+    ProjectMeta meta;
+    EXPECT_FALSE(cache.meta(m_projectPath, meta));
+}
+
+TEST_F(ProjectMetaCacheTest, InvalidatedByModificationTime)
+{
+    // [GIVEN] The meta of a project stored in the cache
+    ProjectMetaCache cache;
+    cache.load(m_cachePath);
+    cache.setMeta(m_projectPath, projectMeta(), QByteArray());
+
+    // [WHEN] The project file is modified, keeping its size
+    QFile file(m_projectPath.toQString());
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    QDateTime modified = QFileInfo(file).lastModified().addSecs(-60);
+    ASSERT_TRUE(file.setFileTime(modified, QFileDevice::FileModificationTime));
+    file.close();
+
+    // [THEN] The cached meta isn't used
+    ProjectMeta meta;
+    EXPECT_FALSE(cache.meta(m_projectPath, meta));
+}
+
+TEST_F(ProjectMetaCacheTest, CorruptFile)
+{
+    // [GIVEN] A saved cache, whose file then gets truncated
+    {
+        ProjectMetaCache cache;
+        cache.load(m_cachePath);
+        cache.setMeta(m_projectPath, projectMeta(), thumbnailPng());
+        cache.save();
+    }
+
+    QFile file(m_cachePath.toQString());
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    ASSERT_TRUE(file.resize(file.size() - 10));
+    file.close();
+
+    // [WHEN] The cache is loaded
+    ProjectMetaCache cache;
+    cache.load(m_cachePath);
+
+    // [THEN] The damaged cache is ignored
+    ProjectMeta meta;
+    EXPECT_FALSE(cache.meta(m_projectPath, meta));
+
+    // [GIVEN] A cache file that isn't a cache at all
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("not a cache");
+    file.close();
+
+    // [THEN] It is ignored too
+    cache.load(m_cachePath);
+    EXPECT_FALSE(cache.meta(m_projectPath, meta));
+}
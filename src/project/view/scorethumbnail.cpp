@@ -30,13 +30,15 @@ ScoreThumbnail::ScoreThumbnail(QQuickItem* parent)
 {
 }
 
-void ScoreThumbnail::setThumbnail(QVariant pixmap)
+void ScoreThumbnail::setThumbnail(QVariant thumbnail)
 {
-    if (pixmap.isNull()) {
+    if (thumbnail.isNull()) {
         return;
     }
 
-    m_thumbnail = pixmap.value<QPixmap>();
+    //! NOTE The thumbnail is read as a QImage, possibly on a worker thread,
+    //! QPixmap may only be created here, on the GUI thread
+    m_thumbnail = QPixmap::fromImage(thumbnail.value<QImage>());
     update();
 }
 
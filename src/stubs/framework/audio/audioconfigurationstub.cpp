@@ -52,6 +52,15 @@ void AudioConfigurationStub::setIsShowControlsInMixer(bool)
 {
 }
 
+bool AudioConfigurationStub::isRealtimeModeEnabled() const
+{
+    return false;
+}
+
+void AudioConfigurationStub::setRealtimeModeEnabled(bool)
+{
+}
+
 // synthesizers
 std::vector<io::path> AudioConfigurationStub::soundFontPaths() const
 {
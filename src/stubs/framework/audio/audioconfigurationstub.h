@@ -40,6 +40,9 @@ public:
     bool isShowControlsInMixer() const override;
     void setIsShowControlsInMixer(bool show) override;
 
+    bool isRealtimeModeEnabled() const override;
+    void setRealtimeModeEnabled(bool enabled) override;
+
     // synthesizers
     std::vector<io::path> soundFontPaths() const override;
     const synth::SynthesizerState& synthesizerState() const override;
@@ -69,3 +69,8 @@ void AudioDriverStub::resume()
 void AudioDriverStub::suspend()
 {
 }
+
+uint64_t AudioDriverStub::xrunsCount() const
+{
+    return 0;
+}
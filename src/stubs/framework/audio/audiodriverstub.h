@@ -40,6 +40,8 @@ public:
 
     void resume() override;
     void suspend() override;
+
+    uint64_t xrunsCount() const override;
 };
 }
 
@@ -9,6 +9,7 @@ set (ASYNC_SRC
     ${CMAKE_CURRENT_LIST_DIR}/changednotify.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/abstractinvoker.cpp
     ${CMAKE_CURRENT_LIST_DIR}/internal/abstractinvoker.h
+    ${CMAKE_CURRENT_LIST_DIR}/internal/mpscqueue.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/queuedinvoker.cpp
     ${CMAKE_CURRENT_LIST_DIR}/internal/queuedinvoker.h
     ${CMAKE_CURRENT_LIST_DIR}/internal/asyncimpl.cpp
@@ -1,33 +1,50 @@
-#ifndef DETO_ASYNC_ASYNC_H
-#define DETO_ASYNC_ASYNC_H
-
-#include "asyncable.h"
-#include "internal/asyncimpl.h"
-
-namespace deto {
-namespace async {
-class Async
-{
-public:
-
-    template<typename F>
-    static void call(const Asyncable* caller, F f, const std::thread::id& th = std::this_thread::get_id())
-    {
-        AsyncImpl::instance()->call(const_cast<Asyncable*>(caller), new AsyncImpl::Functor<F>(f), th);
-    }
-
-    template<typename F, typename Arg1>
-    static void call(const Asyncable* caller, F f, Arg1 a1, const std::thread::id& th = std::this_thread::get_id())
-    {
-        AsyncImpl::instance()->call(const_cast<Asyncable*>(caller), new AsyncImpl::FunctorArg1<F, Arg1>(f, a1), th);
-    }
-
-    static void disconnectAsync(Asyncable* a)
-    {
-        AsyncImpl::instance()->disconnectAsync(a);
-    }
-};
-}
-}
-
-#endif // DETO_ASYNC_ASYNC_H
+#ifndef DETO_ASYNC_ASYNC_H
+#define DETO_ASYNC_ASYNC_H
+
+#include <thread>
+#include <utility>
+
+#include "asyncable.h"
+#include "internal/asyncimpl.h"
+#include "internal/queuedinvoker.h"
+
+namespace deto {
+namespace async {
+class Async
+{
+public:
+
+    //! NOTE The call is queued together with the caller's token, it is skipped if the caller
+    //! has been destroyed in the meantime. Neither queueing nor running it allocates,
+    //! as long as the callable fits into a slot of QueuedInvoker
+    template<typename F>
+    static void call(const Asyncable* caller, F f, const std::thread::id& th = std::this_thread::get_id())
+    {
+        AsyncImpl::Token token = AsyncImpl::instance()->token(const_cast<Asyncable*>(caller));
+        QueuedInvoker::instance()->invoke(th, [f = std::move(f), token]() mutable {
+            if (AsyncImpl::instance()->isAlive(token)) {
+                f();
+            }
+        }, true);
+    }
+
+    template<typename F, typename Arg1>
+    static void call(const Asyncable* caller, F f, Arg1 a1, const std::thread::id& th = std::this_thread::get_id())
+    {
+        AsyncImpl::Token token = AsyncImpl::instance()->token(const_cast<Asyncable*>(caller));
+        QueuedInvoker::instance()->invoke(th, [f = std::move(f), a1 = std::move(a1), token]() mutable {
+            if (AsyncImpl::instance()->isAlive(token)) {
+                f(a1);
+            }
+        }, true);
+    }
+
+    static void disconnectAsync(Asyncable* a)
+    {
+        AsyncImpl::instance()->disconnectAsync(a);
+    }
+};
+}
+}
+
+#endif // DETO_ASYNC_ASYNC_H
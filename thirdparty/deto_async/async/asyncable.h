@@ -15,6 +15,18 @@ public:
         AsyncSetRepeat
     };
 
+    Asyncable() = default;
+
+    //! NOTE A copy has no pending calls of its own, so the token is not copied
+    Asyncable(const Asyncable& other)
+        : m_connects(other.m_connects) {}
+
+    Asyncable& operator=(const Asyncable& other)
+    {
+        m_connects = other.m_connects;
+        return *this;
+    }
+
     virtual ~Asyncable()
     {
         disconnectAll();
@@ -47,8 +59,13 @@ public:
         }
     }
 
+    //! NOTE Cancellation token of the pending Async::call()s, see AsyncImpl
+    uint64_t asyncToken() const { return m_asyncToken; }
+    void setAsyncToken(uint64_t token) { m_asyncToken = token; }
+
 private:
     std::set<IConnectable*> m_connects;
+    uint64_t m_asyncToken = 0;
 };
 }
 }
@@ -13,9 +13,10 @@ AbstractInvoker::AbstractInvoker()
 
 AbstractInvoker::~AbstractInvoker()
 {
-    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    for (QInvoker* qi : m_qInvokers) {
-        qi->invalidate();
+    for (auto it = m_callbacks.begin(); it != m_callbacks.end(); ++it) {
+        for (CallBack& c : it->second) {
+            c.alive->store(false);
+        }
     }
 }
 
@@ -44,10 +45,11 @@ void AbstractInvoker::invoke(int type, const NotifyData& data)
         if (c.threadID == threadID) {
             invokeCallback(type, c, data);
         } else {
-            QInvoker* qi = new QInvoker(this, type, c, data);
-            QueuedInvoker::instance()->invoke(c.threadID, [qi]() {
-                qi->invoke();
-                delete qi;
+            //! NOTE The invocation is queued by value, it fits into a queue slot and doesn't allocate
+            QueuedInvoker::instance()->invoke(c.threadID, [this, type, c, data]() {
+                if (c.alive->load()) {
+                    invokeCallback(type, c, data);
+                }
             });
         }
     }
@@ -117,15 +119,7 @@ void AbstractInvoker::removeCallBack(int type, Asyncable* receiver)
     }
     callbacks.erase(callbacks.begin() + index);
 
-    {
-        std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-        for (QInvoker* qi : m_qInvokers) {
-            if (qi->call.call == c.call) {
-                qi->invalidate();
-                break;
-            }
-        }
-    }
+    c.alive->store(false);
 
     deleteCall(type, c.call);
 }
@@ -138,6 +132,7 @@ void AbstractInvoker::removeAllCallBacks()
                 c.receiver->disconnectAsync(this);
             }
 
+            c.alive->store(false);
             deleteCall(c.type, c.call);
         }
     }
@@ -181,15 +176,3 @@ void AbstractInvoker::disconnectAsync(Asyncable* receiver)
         removeCallBack(type, receiver);
     }
 }
-
-void AbstractInvoker::addQInvoker(QInvoker* qi)
-{
-    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    m_qInvokers.push_back(qi);
-}
-
-void AbstractInvoker::removeQInvoker(QInvoker* qi)
-{
-    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
-    m_qInvokers.remove(qi);
-}
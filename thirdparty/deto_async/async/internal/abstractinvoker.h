@@ -1,9 +1,9 @@
 #ifndef DETO_ASYNC_ABSTRACTINVOKER_H
 #define DETO_ASYNC_ABSTRACTINVOKER_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
-#include <list>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -78,9 +78,11 @@ protected:
         int type = 0;
         Asyncable* receiver = nullptr;
         void* call = nullptr;
+        //! NOTE Cleared when the callback is removed, the queued invocations of it are skipped then
+        std::shared_ptr<std::atomic<bool> > alive;
         CallBack() {}
         CallBack(std::thread::id threadID, int t, Asyncable* cr, void* c)
-            : threadID(threadID), type(t), receiver(cr), call(c) {}
+            : threadID(threadID), type(t), receiver(cr), call(c), alive(std::make_shared<std::atomic<bool> >(true)) {}
     };
 
     class CallBacks : public std::vector<CallBack>
@@ -90,60 +92,13 @@ protected:
         bool containsReceiver(Asyncable* receiver) const;
     };
 
-    struct QInvoker
-    {
-        std::mutex mutex;
-        AbstractInvoker* invoker = nullptr;
-        int type = -1;
-        CallBack call;
-        NotifyData data;
-
-        QInvoker(AbstractInvoker* i, int t, CallBack c, NotifyData d)
-            : invoker(i), type(t), call(c), data(d)
-        {
-            invoker->addQInvoker(this);
-        }
-
-        ~QInvoker()
-        {
-            if (invoker) {
-                invoker->removeQInvoker(this);
-            }
-        }
-
-        void invoke()
-        {
-            AbstractInvoker* inv = nullptr;
-            {
-                std::lock_guard<std::mutex> lock(mutex);
-                inv = invoker;
-            }
-
-            if (inv) {
-                inv->invokeCallback(type, call, data);
-            }
-        }
-
-        void invalidate()
-        {
-            std::lock_guard<std::mutex> lock(mutex);
-            invoker = nullptr;
-        }
-    };
-
     void invokeCallback(int type, const CallBack& c, const NotifyData& data);
 
     void addCallBack(int type, Asyncable* receiver, void* call, Asyncable::AsyncMode mode = Asyncable::AsyncMode::AsyncSetRepeat);
     void removeCallBack(int type, Asyncable* receiver);
     void removeAllCallBacks();
 
-    void addQInvoker(QInvoker* qi);
-    void removeQInvoker(QInvoker* qi);
-
     std::map<int /*type*/, CallBacks > m_callbacks;
-
-    std::mutex m_qInvokersMutex;
-    std::list<QInvoker*> m_qInvokers;
 };
 
 inline void processEvents()
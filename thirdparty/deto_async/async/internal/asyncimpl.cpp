@@ -1,69 +1,98 @@
-#include "asyncimpl.h"
-
-#include "queuedinvoker.h"
-
-using namespace deto::async;
-
-AsyncImpl* AsyncImpl::instance()
-{
-    static AsyncImpl a;
-    return &a;
-}
-
-void AsyncImpl::disconnectAsync(Asyncable* caller)
-{
-    std::lock_guard locker(m_mutex);
-    uint64_t key = 0;
-    std::map<uint64_t, Call>::const_iterator it = m_calls.cbegin(), end = m_calls.cend();
-    for (; it != end; ++it) {
-        if (it->second.caller == caller) {
-            key = it->first;
-            break;
-        }
-    }
-
-    if (key) {
-        m_calls.erase(key);
-    }
-}
-
-void AsyncImpl::call(Asyncable* caller, IFunction* f, const std::thread::id& th)
-{
-    if (caller) {
-        caller->connectAsync(this);
-    }
-
-    uint64_t key = reinterpret_cast<uint64_t>(f);
-    {
-        std::lock_guard locker(m_mutex);
-        m_calls[key] = Call(caller, f);
-    }
-
-    auto functor = [this, key]() { onCall(key); };
-    QueuedInvoker::instance()->invoke(th, functor, true);
-}
-
-void AsyncImpl::onCall(uint64_t key)
-{
-    Call c;
-    {
-        std::lock_guard locker(m_mutex);
-        auto it = m_calls.find(key);
-
-        //! NOTE Probably disconnected
-        if (it == m_calls.end()) {
-            return;
-        }
-
-        c = it->second;
-        m_calls.erase(it);
-    }
-
-    c.f->call();
-
-    if (c.caller) {
-        c.caller->disconnectAsync(this);
-    }
-
-    delete c.f;
-}
+#include "asyncimpl.h"
+
+#include <cassert>
+
+using namespace deto::async;
+
+static AsyncImpl::Token makeToken(uint32_t index, uint32_t generation)
+{
+    return (AsyncImpl::Token(index) << 32) | generation;
+}
+
+AsyncImpl* AsyncImpl::instance()
+{
+    static AsyncImpl a;
+    return &a;
+}
+
+AsyncImpl::~AsyncImpl()
+{
+    for (std::atomic<Generation*>& chunk : m_chunks) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+AsyncImpl::Generation* AsyncImpl::generation(uint32_t index) const
+{
+    Generation* chunk = m_chunks[index / CHUNK_SIZE].load(std::memory_order_acquire);
+    return chunk ? &chunk[index % CHUNK_SIZE] : nullptr;
+}
+
+AsyncImpl::Token AsyncImpl::token(Asyncable* caller)
+{
+    if (!caller) {
+        return NO_TOKEN;
+    }
+
+    Token token = caller->asyncToken();
+    if (token != NO_TOKEN) {
+        return token;
+    }
+
+    uint32_t index = 0;
+    {
+        std::lock_guard locker(m_mutex);
+        if (!m_freeIndices.empty()) {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        } else {
+            if (m_indexCount == CHUNK_SIZE * MAX_CHUNKS) {
+                assert(false && "too many callers with pending calls");
+                return NO_TOKEN;
+            }
+
+            index = m_indexCount++;
+            if (index % CHUNK_SIZE == 0) {
+                Generation* chunk = new Generation[CHUNK_SIZE];
+                for (uint32_t i = 0; i < CHUNK_SIZE; ++i) {
+                    chunk[i].store(1, std::memory_order_relaxed);
+                }
+                m_chunks[index / CHUNK_SIZE].store(chunk, std::memory_order_release);
+            }
+        }
+    }
+
+    token = makeToken(index, generation(index)->load(std::memory_order_relaxed));
+    caller->setAsyncToken(token);
+    caller->connectAsync(this);
+    return token;
+}
+
+bool AsyncImpl::isAlive(Token token) const
+{
+    if (token == NO_TOKEN) {
+        return true;
+    }
+
+    const Generation* gen = generation(uint32_t(token >> 32));
+    return gen && gen->load(std::memory_order_acquire) == uint32_t(token);
+}
+
+void AsyncImpl::disconnectAsync(Asyncable* caller)
+{
+    const Token token = caller->asyncToken();
+    if (token == NO_TOKEN) {
+        return;
+    }
+
+    const uint32_t index = uint32_t(token >> 32);
+    uint32_t next = uint32_t(token) + 1;
+    if (next == 0) {
+        next = 1; // 0 would make the token of index 0 equal to NO_TOKEN
+    }
+    generation(index)->store(next, std::memory_order_release);
+    caller->setAsyncToken(NO_TOKEN);
+
+    std::lock_guard locker(m_mutex);
+    m_freeIndices.push_back(index);
+}
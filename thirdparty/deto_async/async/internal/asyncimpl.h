@@ -1,61 +1,55 @@
-#ifndef DETO_ASYNC_ASYNCIMPL_H
-#define DETO_ASYNC_ASYNCIMPL_H
-
-#include <mutex>
-#include <map>
-#include <thread>
-#include "../asyncable.h"
-
-namespace deto {
-namespace async {
-class AsyncImpl : public Asyncable::IConnectable
-{
-public:
-
-    static AsyncImpl* instance();
-
-    struct IFunction {
-        virtual ~IFunction() {}
-        virtual void call() = 0;
-    };
-
-    template<typename F>
-    struct Functor : public IFunction {
-        F functor;
-        Functor(const F fn)
-            : functor(fn) {}
-        void call() { functor(); }
-    };
-
-    template<typename F, typename Arg1>
-    struct FunctorArg1 : public IFunction {
-        F functor;
-        Arg1 arg1;
-        FunctorArg1(const F fn, Arg1 a1)
-            : functor(fn), arg1(a1) {}
-        void call() { functor(arg1); }
-    };
-
-    void call(Asyncable* caller, IFunction* f, const std::thread::id& th = std::this_thread::get_id());
-    void disconnectAsync(Asyncable* caller);
-
-private:
-    AsyncImpl() = default;
-
-    void onCall(uint64_t key);
-
-    struct Call {
-        Asyncable* caller = nullptr;
-        IFunction* f = nullptr;
-        Call() {}
-        Call(Asyncable* c, IFunction* _f)
-            : caller(c), f(_f) {}
-    };
-
-    std::mutex m_mutex;
-    std::map<uint64_t, Call> m_calls;
-};
-}
-}
-
-#endif // DETO_ASYNC_ASYNCIMPL_H
+#ifndef DETO_ASYNC_ASYNCIMPL_H
+#define DETO_ASYNC_ASYNCIMPL_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "../asyncable.h"
+
+namespace deto {
+namespace async {
+//! NOTE Keeps the cancellation tokens of Async::call().
+//! A caller gets a token on its first call, the queued calls carry it by value
+//! and are skipped once the caller is destroyed. Checking a token neither locks
+//! nor allocates, so calls can be queued to the audio thread.
+class AsyncImpl : public Asyncable::IConnectable
+{
+public:
+
+    static AsyncImpl* instance();
+
+    using Token = uint64_t;
+    static constexpr Token NO_TOKEN = 0;
+
+    //! NOTE Caller thread
+    Token token(Asyncable* caller);
+
+    //! NOTE Any thread, lock-free
+    bool isAlive(Token token) const;
+
+    void disconnectAsync(Asyncable* caller) override;
+
+private:
+    AsyncImpl() = default;
+    ~AsyncImpl();
+
+    static constexpr uint32_t CHUNK_SIZE = 1024;
+    static constexpr uint32_t MAX_CHUNKS = 1024;
+
+    //! NOTE The generation of a token index, advanced when its caller is gone
+    using Generation = std::atomic<uint32_t>;
+
+    Generation* generation(uint32_t index) const;
+
+    //! NOTE Chunks are only added, never moved, so isAlive() needs no lock
+    std::atomic<Generation*> m_chunks[MAX_CHUNKS] = {};
+
+    std::mutex m_mutex;
+    std::vector<uint32_t> m_freeIndices;
+    uint32_t m_indexCount = 0;
+};
+}
+}
+
+#endif // DETO_ASYNC_ASYNCIMPL_H
@@ -0,0 +1,145 @@
+#ifndef DETO_ASYNC_MPSCQUEUE_H
+#define DETO_ASYNC_MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace deto {
+namespace async {
+//! NOTE Bounded lock-free queue for many producers and a single consumer.
+//! Messages are type-erased callables constructed in place in preallocated
+//! fixed-size slots, so neither pushing nor processing allocates.
+//! The slot sequencing follows the bounded MPMC queue by Dmitry Vyukov.
+template<size_t Capacity, size_t SlotSize = 64>
+class MpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscQueue()
+    {
+        for (size_t i = 0; i < Capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpscQueue()
+    {
+        while (pop(false)) {
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    template<typename F>
+    static constexpr bool fits()
+    {
+        using T = typename std::decay<F>::type;
+        return sizeof(T) <= SlotSize
+               && alignof(T) <= alignof(std::max_align_t)
+               && std::is_nothrow_move_constructible<T>::value;
+    }
+
+    //! NOTE Can be called from any thread.
+    //! Returns false if the queue is full, the callable is left untouched then
+    template<typename F>
+    bool push(F&& f)
+    {
+        using T = typename std::decay<F>::type;
+        static_assert(fits<F>(), "The callable does not fit into a slot");
+
+        Slot* slot = nullptr;
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            slot = &m_slots[pos & (Capacity - 1)];
+            const size_t seq = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (slot->storage) T(std::forward<F>(f));
+        slot->call = [](void* p) { (*static_cast<T*>(p))(); };
+        slot->destroy = [](void* p) { static_cast<T*>(p)->~T(); };
+        slot->relocate = [](void* dst, void* src) {
+            new (dst) T(std::move(*static_cast<T*>(src)));
+            static_cast<T*>(src)->~T();
+        };
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! NOTE Consumer thread only.
+    //! Calls the messages pushed before this call, messages pushed by them
+    //! are left for the next call. Returns the number of called messages.
+    //! A message may call process() again, it is not called twice
+    size_t process()
+    {
+        const size_t end = m_enqueuePos.load(std::memory_order_acquire);
+        size_t count = 0;
+        while (intptr_t(end - m_dequeuePos) > 0 && pop(true)) {
+            ++count;
+        }
+        return count;
+    }
+
+    //! NOTE Consumer thread only
+    bool empty() const
+    {
+        const Slot& slot = m_slots[m_dequeuePos & (Capacity - 1)];
+        return slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence { 0 };
+        void (* call)(void*) = nullptr;
+        void (* destroy)(void*) = nullptr;
+        void (* relocate)(void*, void*) = nullptr;
+        alignas(std::max_align_t) unsigned char storage[SlotSize];
+    };
+
+    bool pop(bool call)
+    {
+        Slot& slot = m_slots[m_dequeuePos & (Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            return false;
+        }
+
+        //! NOTE The message is moved out and its slot released before it is called,
+        //! so that a reentrant process() doesn't see it again
+        alignas(std::max_align_t) unsigned char storage[SlotSize];
+        void (* callFn)(void*) = slot.call;
+        void (* destroyFn)(void*) = slot.destroy;
+        slot.relocate(storage, slot.storage);
+
+        slot.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+        ++m_dequeuePos;
+
+        if (call) {
+            callFn(storage);
+        }
+        destroyFn(storage);
+        return true;
+    }
+
+    alignas(64) std::atomic<size_t> m_enqueuePos { 0 };
+    alignas(64) size_t m_dequeuePos = 0;
+    Slot m_slots[Capacity];
+};
+}
+}
+
+#endif // DETO_ASYNC_MPSCQUEUE_H
@@ -8,34 +8,75 @@ QueuedInvoker* QueuedInvoker::instance()
     return &i;
 }
 
-void QueuedInvoker::invoke(const std::thread::id& th, const Functor& f, bool isAlwaysQueued)
+QueuedInvoker::~QueuedInvoker()
 {
-    if (m_onMainThreadInvoke) {
-        if (th == m_mainThreadID) {
-            m_onMainThreadInvoke(f, isAlwaysQueued);
+    ThreadQueue* q = m_queues.load(std::memory_order_acquire);
+    while (q) {
+        ThreadQueue* next = q->next;
+        delete q;
+        q = next;
+    }
+}
+
+QueuedInvoker::ThreadQueue* QueuedInvoker::queue(const std::thread::id& th)
+{
+    for (ThreadQueue* q = m_queues.load(std::memory_order_acquire); q; q = q->next) {
+        if (q->threadID == th) {
+            return q;
         }
     }
 
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    m_queues[th].push(f);
+    std::lock_guard<std::mutex> lock(m_queuesMutex);
+
+    //! NOTE Could have been added while waiting for the lock
+    ThreadQueue* head = m_queues.load(std::memory_order_acquire);
+    for (ThreadQueue* q = head; q; q = q->next) {
+        if (q->threadID == th) {
+            return q;
+        }
+    }
+
+    ThreadQueue* q = new ThreadQueue();
+    q->threadID = th;
+    q->next = head;
+    m_queues.store(q, std::memory_order_release);
+    return q;
+}
+
+void QueuedInvoker::pushOverflow(ThreadQueue* q, Functor&& f)
+{
+    std::lock_guard<std::mutex> lock(q->overflowMutex);
+    q->overflow.push(std::move(f));
+    q->hasOverflow.store(true, std::memory_order_release);
 }
 
 void QueuedInvoker::processEvents()
 {
-    Queue q;
+    thread_local ThreadQueue* q = nullptr;
+    if (!q) {
+        q = queue(std::this_thread::get_id());
+    }
+
+    q->queue.process();
+
+    //! NOTE The overflow messages are newer than the ones in the queue
+    if (!q->hasOverflow.load(std::memory_order_acquire) || !q->queue.empty()) {
+        return;
+    }
+
+    std::queue<Functor> overflow;
     {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
-        auto n = m_queues.extract(std::this_thread::get_id());
-        if (!n.empty()) {
-            q = n.mapped();
-        }
+        std::lock_guard<std::mutex> lock(q->overflowMutex);
+        overflow.swap(q->overflow);
+        q->hasOverflow.store(false, std::memory_order_release);
     }
-    while (!q.empty()) {
-        const auto& f = q.front();
+
+    while (!overflow.empty()) {
+        const auto& f = overflow.front();
         if (f) {
             f();
         }
-        q.pop();
+        overflow.pop();
     }
 }
 
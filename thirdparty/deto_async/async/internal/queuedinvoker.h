@@ -1,11 +1,14 @@
 #ifndef DETO_ASYNC_QUEUEDINVOKER_H
 #define DETO_ASYNC_QUEUEDINVOKER_H
 
+#include <atomic>
 #include <functional>
 #include <queue>
-#include <map>
 #include <mutex>
 #include <thread>
+#include <type_traits>
+
+#include "mpscqueue.h"
 
 namespace deto {
 namespace async {
@@ -17,18 +20,62 @@ public:
 
     using Functor = std::function<void ()>;
 
-    void invoke(const std::thread::id& th, const Functor& f, bool isAlwaysQueued = false);
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+    static constexpr size_t SLOT_SIZE = 128;
+
+    template<typename F>
+    void invoke(const std::thread::id& th, F&& f, bool isAlwaysQueued = false)
+    {
+        if (m_onMainThreadInvoke && th == m_mainThreadID) {
+            m_onMainThreadInvoke(Functor(std::forward<F>(f)), isAlwaysQueued);
+            return;
+        }
+
+        ThreadQueue* q = queue(th);
+
+        //! NOTE Once a message went to the overflow queue, the following ones
+        //! go there too until the thread has processed it, to keep the order
+        if (!q->hasOverflow.load(std::memory_order_acquire)) {
+            if constexpr (Queue::fits<F>()) {
+                //! NOTE push() leaves the callable untouched if it fails
+                if (q->queue.push(std::forward<F>(f))) {
+                    return;
+                }
+            }
+        }
+
+        pushOverflow(q, Functor(std::forward<F>(f)));
+    }
+
     void processEvents();
     void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
 
 private:
 
     QueuedInvoker() = default;
+    ~QueuedInvoker();
+
+    using Queue = MpscQueue<QUEUE_CAPACITY, SLOT_SIZE>;
+
+    //! NOTE The messages of one thread. Messages that do not fit into
+    //! a slot or do not fit into the full queue go to the overflow queue
+    struct ThreadQueue {
+        std::thread::id threadID;
+        ThreadQueue* next = nullptr;
+
+        Queue queue;
+
+        std::atomic<bool> hasOverflow { false };
+        std::mutex overflowMutex;
+        std::queue<Functor> overflow;
+    };
 
-    using Queue = std::queue<Functor>;
+    ThreadQueue* queue(const std::thread::id& th);
+    void pushOverflow(ThreadQueue* q, Functor&& f);
 
-    std::recursive_mutex m_mutex;
-    std::map<std::thread::id, Queue > m_queues;
+    //! NOTE Queues are only added, never removed, so lookups need no lock
+    std::atomic<ThreadQueue*> m_queues { nullptr };
+    std::mutex m_queuesMutex;
 
     std::function<void(const std::function<void()>&, bool)> m_onMainThreadInvoke;
     std::thread::id m_mainThreadID;
@@ -10,6 +10,7 @@
 using namespace haw::profiler;
 
 Profiler::Options Profiler::m_options;
+std::atomic<bool> Profiler::m_traceEnabled{ false };
 
 constexpr int MAIN_THREAD_INDEX(0);
 
@@ -21,6 +22,7 @@ Profiler* Profiler::instance()
 
 Profiler::Profiler()
 {
+    m_trace.startTime = std::chrono::steady_clock::now();
     setup(Options(), new Printer());
 }
 
@@ -170,6 +172,8 @@ void Profiler::clear()
         }
         m_steps.timers.clear();
     }
+
+    clearTrace();
 }
 
 Profiler::Data Profiler::threadsData(Data::Mode mode) const
@@ -253,6 +257,239 @@ bool Profiler::save(const std::string& filePath)
     return ok;
 }
 
+void Profiler::setTraceEnabled(bool enabled)
+{
+    //! NOTE The named threads get their buffers here, so they do not allocate when they record the first event
+    if (enabled) {
+        std::lock_guard<std::mutex> lock(m_trace.mutex);
+        for (const auto& threadName : m_trace.threadNames) {
+            registerTraceBuffer(threadName.first);
+        }
+    }
+
+    m_traceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint32_t Profiler::traceId(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    m_trace.names.push_back(name);
+    return static_cast<uint32_t>(m_trace.names.size() - 1);
+}
+
+void Profiler::traceBegin(uint32_t id)
+{
+    pushTraceEvent(TraceEventType::Begin, id, 0.);
+}
+
+void Profiler::traceEnd(uint32_t id)
+{
+    pushTraceEvent(TraceEventType::End, id, 0.);
+}
+
+void Profiler::traceCounter(const FuncInfo& counter, double value)
+{
+    pushTraceEvent(TraceEventType::Counter, counter.id, value);
+}
+
+void Profiler::setTraceThreadName(const std::string& name)
+{
+    //! NOTE While the tracing is off the buffer is only named if it exists,
+    //! the threads that are never traced should not take memory
+    std::thread::id th = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    m_trace.threadNames[th] = name;
+
+    if (isTraceEnabled()) {
+        registerTraceBuffer(th);
+    }
+
+    for (const std::unique_ptr<TraceBuffer>& buf : m_trace.buffers) {
+        if (buf->thread == th) {
+            buf->name = name;
+        }
+    }
+}
+
+Profiler::TraceBuffer* Profiler::registerTraceBuffer(std::thread::id th)
+{
+    //! NOTE Must be called under the trace mutex.
+    //! A finished thread leaves its buffer to the next thread that gets the same id
+    for (const std::unique_ptr<TraceBuffer>& buf : m_trace.buffers) {
+        if (buf->thread == th) {
+            return buf.get();
+        }
+    }
+
+    if (m_trace.buffers.size() >= m_options.traceMaxThreadCount) {
+        return nullptr;
+    }
+
+    m_trace.buffers.push_back(std::make_unique<TraceBuffer>(th, m_options.traceEventsPerThread));
+    TraceBuffer* buf = m_trace.buffers.back().get();
+
+    auto it = m_trace.threadNames.find(th);
+    if (it != m_trace.threadNames.end()) {
+        buf->name = it->second;
+    }
+
+    return buf;
+}
+
+Profiler::TraceBuffer* Profiler::threadTraceBuffer()
+{
+    //! NOTE Buffers are never deleted, so the pointer stays valid for the lifetime of the thread.
+    //! It is looked up once per thread, null if there are too many threads
+    thread_local TraceBuffer* buf = nullptr;
+    thread_local bool resolved = false;
+    if (!resolved) {
+        std::lock_guard<std::mutex> lock(m_trace.mutex);
+        buf = registerTraceBuffer(std::this_thread::get_id());
+        resolved = true;
+    }
+    return buf;
+}
+
+void Profiler::pushTraceEvent(TraceEventType type, uint32_t id, double value)
+{
+    TraceBuffer* buf = threadTraceBuffer();
+    if (!buf) {
+        return;
+    }
+
+    TraceEvent e;
+    e.timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_trace.startTime).count();
+    e.value = value;
+    e.id = id;
+    e.type = type;
+
+    buf->push(e);
+}
+
+void Profiler::clearTrace()
+{
+    std::lock_guard<std::mutex> lock(m_trace.mutex);
+    for (const std::unique_ptr<TraceBuffer>& buf : m_trace.buffers) {
+        buf->clear();
+    }
+}
+
+static void appendJsonString(std::string& out, const std::string& str)
+{
+    out += '"';
+    for (char c : str) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+std::string Profiler::traceJson() const
+{
+    struct ThreadTrace {
+        std::string name;
+        std::vector<TraceEvent> events;
+    };
+
+    std::vector<std::string> names;
+    std::vector<ThreadTrace> threads;
+    {
+        std::lock_guard<std::mutex> lock(m_trace.mutex);
+        names = m_trace.names;
+
+        std::thread::id mainThread = m_funcs.threads[MAIN_THREAD_INDEX];
+        for (const std::unique_ptr<TraceBuffer>& buf : m_trace.buffers) {
+            ThreadTrace tt;
+            if (!buf->name.empty()) {
+                tt.name = buf->name;
+            } else if (buf->thread == mainThread) {
+                tt.name = "Main thread";
+            } else {
+                tt.name = "Thread " + std::to_string(threads.size());
+            }
+            tt.events = buf->events();
+            threads.push_back(std::move(tt));
+        }
+    }
+
+    std::string out;
+    out.reserve(1024 * 1024);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    auto beginEvent = [&out, &first](const char* ph, size_t tid) {
+        out += first ? "\n" : ",\n";
+        first = false;
+        out += "{\"ph\":\"";
+        out += ph;
+        out += "\",\"pid\":1,\"tid\":";
+        out += std::to_string(tid);
+    };
+
+    char ts[32];
+    for (size_t tid = 0; tid < threads.size(); ++tid) {
+        const ThreadTrace& tt = threads[tid];
+
+        beginEvent("M", tid);
+        out += ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        appendJsonString(out, tt.name);
+        out += "}}";
+
+        //! NOTE The beginning of the trace may have been overwritten, the ends without a begin are skipped
+        size_t depth = 0;
+        for (const TraceEvent& e : tt.events) {
+            if (e.type == TraceEventType::End) {
+                if (depth == 0) {
+                    continue;
+                }
+                --depth;
+            } else if (e.type == TraceEventType::Begin) {
+                ++depth;
+            }
+
+            const char* ph = e.type == TraceEventType::Begin ? "B" : (e.type == TraceEventType::End ? "E" : "C");
+            beginEvent(ph, tid);
+
+            snprintf(ts, sizeof(ts), "%.3f", static_cast<double>(e.timeNs) / 1000.);
+            out += ",\"ts\":";
+            out += ts;
+
+            out += ",\"name\":";
+            appendJsonString(out, e.id < names.size() ? names[e.id] : std::string());
+
+            if (e.type == TraceEventType::Counter) {
+                snprintf(ts, sizeof(ts), "%.6g", e.value);
+                out += ",\"args\":{\"value\":";
+                out += ts;
+                out += "}";
+            }
+
+            out += "}";
+        }
+    }
+
+    out += "\n]}\n";
+    return out;
+}
+
+bool Profiler::saveTrace(const std::string& filePath) const
+{
+    return save_file(filePath, traceJson());
+}
+
 bool Profiler::save_file(const std::string& path, const std::string& content)
 {
     FILE* pFile = fopen(path.c_str(), "w");
@@ -304,6 +541,53 @@ std::string FuncMarker::formatSig(const std::string& sig)
     return str;
 }
 
+Profiler::TraceBuffer::TraceBuffer(std::thread::id th, size_t capacity)
+    : thread(th)
+{
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    m_events.reset(new TraceEvent[size]);
+    m_mask = size - 1;
+}
+
+void Profiler::TraceBuffer::push(const TraceEvent& e)
+{
+    size_t head = m_head.load(std::memory_order_relaxed);
+    m_events[head & m_mask] = e;
+    m_head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<Profiler::TraceEvent> Profiler::TraceBuffer::events() const
+{
+    const size_t capacity = m_mask + 1;
+    size_t end = m_head.load(std::memory_order_acquire);
+    size_t begin = std::max(m_tail.load(std::memory_order_relaxed), end > capacity ? end - capacity : 0);
+
+    std::vector<TraceEvent> result;
+    result.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        result.push_back(m_events[i & m_mask]);
+    }
+
+    //! NOTE The thread could have overwritten the oldest events while they were copied.
+    //! The slot of the index written - capacity is the one it may be writing right now
+    size_t written = m_head.load(std::memory_order_acquire);
+    if (written >= capacity && written - capacity + 1 > begin) {
+        size_t overwritten = std::min(written - capacity + 1 - begin, result.size());
+        result.erase(result.begin(), result.begin() + overwritten);
+    }
+
+    return result;
+}
+
+void Profiler::TraceBuffer::clear()
+{
+    m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
 double Profiler::StepTimer::beginMs() const
 {
     return beginTime.mlsecsElapsed();
@@ -10,6 +10,9 @@
 #include <mutex>
 #include <chrono>
 #include <sstream>
+#include <atomic>
+#include <memory>
+#include <cstdint>
 
 #define HAW_PROFILER_ENABLED
 
@@ -25,16 +28,30 @@
 
 #ifndef TRACEFUNC
 #define TRACEFUNC \
-    static std::string __func_info(haw::profiler::FuncMarker::formatSig(FUNC_INFO)); \
+    static const haw::profiler::FuncInfo __func_info(haw::profiler::FuncMarker::formatSig(FUNC_INFO)); \
     haw::profiler::FuncMarker __funcMarker(__func_info);
 #endif
 
 #ifndef TRACEFUNC_C
 #define TRACEFUNC_C(info) \
-    static std::string __func_info(info); \
+    static const haw::profiler::FuncInfo __func_info(info); \
     haw::profiler::FuncMarker __funcMarkerInfo(__func_info);
 #endif
 
+#ifndef TRACE_COUNTER
+#define TRACE_COUNTER(name, value) \
+    do { \
+        if (haw::profiler::Profiler::isTraceEnabled()) { \
+            static const haw::profiler::FuncInfo __counter_info(name); \
+            haw::profiler::Profiler::instance()->traceCounter(__counter_info, static_cast<double>(value)); \
+        } \
+    } while (0)
+#endif
+
+#ifndef TRACE_THREAD_NAME
+#define TRACE_THREAD_NAME(name) haw::profiler::Profiler::instance()->setTraceThreadName(name)
+#endif
+
 #ifndef BEGIN_STEP_TIME
 #define BEGIN_STEP_TIME(tag) \
     if (haw::profiler::Profiler::options().stepTimeEnabled) \
@@ -59,6 +76,8 @@
 
 #define TRACEFUNC
 #define TRACEFUNC_C(info)
+#define TRACE_COUNTER(name, value)
+#define TRACE_THREAD_NAME(name)
 #define BEGIN_STEP_TIME
 #define STEP_TIME
 #define PROFILER_CLEAR
@@ -67,6 +86,8 @@
 #endif
 
 namespace haw::profiler {
+struct FuncInfo;
+
 class Profiler
 {
 public:
@@ -79,6 +100,8 @@ public:
         bool funcsTraceEnabled{ false };
         size_t funcsMaxThreadCount{ 100 };
         int dataTopCount{ 150 };
+        size_t traceEventsPerThread{ 1 << 16 }; //! NOTE Rounded up to a power of two, the oldest events are overwritten
+        size_t traceMaxThreadCount{ 32 }; //! NOTE The threads started beyond it are not traced
         Options() {}
     };
 
@@ -163,6 +186,22 @@ public:
 
     bool save(const std::string& filePath);
 
+    // Tracing
+    //! NOTE Records the begin and end of every marked function in a ring buffer of the calling thread,
+    //! the recording does not lock or allocate, so it can be switched on at any time, also in release builds
+    static bool isTraceEnabled() { return m_traceEnabled.load(std::memory_order_relaxed); }
+    void setTraceEnabled(bool enabled);
+
+    uint32_t traceId(const std::string& name); //! NOTE Interns the name, called once per marker
+    void traceBegin(uint32_t id);
+    void traceEnd(uint32_t id);
+    void traceCounter(const FuncInfo& counter, double value);
+    void setTraceThreadName(const std::string& name);
+
+    void clearTrace();
+    std::string traceJson() const; //! NOTE Chrome trace event format, for chrome://tracing or ui.perfetto.dev
+    bool saveTrace(const std::string& filePath) const;
+
 private:
     Profiler();
     ~Profiler();
@@ -170,6 +209,7 @@ private:
     friend struct FuncMarker;
 
     static Options m_options;
+    static std::atomic<bool> m_traceEnabled;
 
     struct StepTimer {
         ElapsedTimer beginTime;
@@ -199,37 +239,101 @@ private:
         int addThread(std::thread::id th);
     };
 
-    bool save_file(const std::string& path, const std::string& content);
+    enum class TraceEventType : uint8_t {
+        Begin,
+        End,
+        Counter
+    };
+
+    struct TraceEvent {
+        int64_t timeNs{ 0 };
+        double value{ 0. };
+        uint32_t id{ 0 };
+        TraceEventType type{ TraceEventType::Begin };
+    };
+
+    //! NOTE Written only by its thread, read by the thread that dumps the trace
+    struct TraceBuffer {
+        TraceBuffer(std::thread::id th, size_t capacity);
+
+        void push(const TraceEvent& e);
+        std::vector<TraceEvent> events() const;
+        void clear();
+
+        std::thread::id thread;
+        std::string name;
+
+    private:
+        std::unique_ptr<TraceEvent[]> m_events;
+        size_t m_mask{ 0 };
+        std::atomic<size_t> m_head{ 0 };
+        std::atomic<size_t> m_tail{ 0 };
+    };
+
+    struct TraceData {
+        mutable std::mutex mutex;
+        std::vector<std::string> names;
+        std::vector<std::unique_ptr<TraceBuffer> > buffers;
+        std::unordered_map<std::thread::id, std::string> threadNames;
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    TraceBuffer* threadTraceBuffer();
+    TraceBuffer* registerTraceBuffer(std::thread::id th);
+    void pushTraceEvent(TraceEventType type, uint32_t id, double value);
+
+    static bool save_file(const std::string& path, const std::string& content);
 
     Printer* m_printer{ nullptr };
 
     StepsData m_steps;
     mutable FuncsData m_funcs;
+    TraceData m_trace;
 
     size_t m_stackCounter{ 0 };
 };
 
+struct FuncInfo
+{
+    explicit FuncInfo(const std::string& n)
+        : name(n), id(Profiler::instance()->traceId(name)) {}
+
+    const std::string name;
+    const uint32_t id;
+};
+
 struct FuncMarker
 {
-    explicit FuncMarker(const std::string& fn)
-        : func(fn)
+    explicit FuncMarker(const FuncInfo& fi)
+        : func(fi)
     {
         if (Profiler::m_options.funcsTimeEnabled) {
-            timer = Profiler::instance()->beginFunc(fn);
+            timer = Profiler::instance()->beginFunc(fi.name);
+        }
+
+        if (Profiler::isTraceEnabled()) {
+            traced = true;
+            Profiler::instance()->traceBegin(fi.id);
         }
     }
 
     ~FuncMarker()
     {
+        //! NOTE The end is recorded even if the tracing was switched off meanwhile, to keep the events paired
+        if (traced) {
+            Profiler::instance()->traceEnd(func.id);
+        }
+
         if (Profiler::m_options.funcsTimeEnabled) {
-            Profiler::instance()->endFunc(timer, func);
+            Profiler::instance()->endFunc(timer, func.name);
         }
     }
 
     static std::string formatSig(const std::string& sig);
 
     Profiler::FuncTimer* timer{ nullptr };
-    const std::string& func;
+    bool traced{ false };
+    const FuncInfo& func;
 };
 }
 
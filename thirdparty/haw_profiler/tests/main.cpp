@@ -39,13 +39,17 @@ public:
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
 
         STEP_TIME("mark1", "end body func4");
+        TRACE_COUNTER("func4 calls", ++m_func4Count);
 
         func3();
     }
 
     void example()
     {
-        std::thread th(th_func);
+        std::thread th([]() {
+            TRACE_THREAD_NAME("Example thread");
+            th_func();
+        });
 
         TRACEFUNC;
         func1();
@@ -68,17 +72,25 @@ public:
 
         th.join();
     }
+
+private:
+    int m_func4Count = 0;
 };
 
 int main(int argc, char* argv[])
 {
     std::clog << "Hello World, I am Profiler\n";
 
+    haw::profiler::Profiler::instance()->setTraceEnabled(true);
+
     Example t;
     t.example();
 
     PROFILER_PRINT;
 
+    //! NOTE Open in chrome://tracing or ui.perfetto.dev
+    haw::profiler::Profiler::instance()->saveTrace("haw_profiler_trace.json");
+
     /* Output:
         mark1 : 0.000/0.000 ms: Begin
         mark1 : 21.582/21.545 ms: end call func2 10 times
@@ -39,6 +39,7 @@
 
 #ifndef QT_NO_TEXTODFWRITER
 
+#include <QBuffer>
 #include <QDir>
 #include <QDebug>
 #include <QFileInfo>
@@ -163,7 +164,7 @@ static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourc
     return err;
 }
 
-static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen, int level, int strategy = Z_DEFAULT_STRATEGY)
 {
     z_stream stream;
     int err;
@@ -180,7 +181,7 @@ static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourc
     stream.zfree = (free_func)0;
     stream.opaque = (voidpf)0;
 
-    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    err = deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, strategy);
     if (err != Z_OK) {
         return err;
     }
@@ -196,6 +197,34 @@ static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourc
     return err;
 }
 
+static QByteArray deflateContents(const QByteArray& contents, int level, int strategy = Z_DEFAULT_STRATEGY)
+{
+    QByteArray data;
+    ulong len = contents.length();
+    // shamelessly copied form zlib
+    len += (len >> 12) + (len >> 14) + 11;
+    int res;
+    do {
+        data.resize(len);
+        res = deflate((uchar*)data.data(), &len, (const uchar*)contents.constData(), contents.length(), level, strategy);
+
+        switch (res) {
+        case Z_OK:
+            data.resize(len);
+            break;
+        case Z_MEM_ERROR:
+            qWarning("QZip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
+            data.resize(0);
+            break;
+        case Z_BUF_ERROR:
+            len *= 2;
+            break;
+        }
+    } while (res == Z_BUF_ERROR);
+
+    return data;
+}
+
 namespace WindowsFileAttributes {
 enum {
     Dir        = 0x10, // FILE_ATTRIBUTE_DIRECTORY
@@ -546,6 +575,8 @@ public:
     MQZipReader::Status status;
 };
 
+class MQZipEntryDevice;
+
 class MQZipWriterPrivate : public MQZipPrivate
 {
 public:
@@ -557,17 +588,219 @@ public:
     {
     }
 
+    ~MQZipWriterPrivate();
+
     MQZipWriter::Status status;
     QFile::Permissions permissions;
     MQZipWriter::CompressionPolicy compressionPolicy;
+    int compressionLevel = Z_DEFAULT_COMPRESSION;
+    MQZipEntryDevice* openEntry = nullptr;
 
     enum EntryType {
         Directory, File, Symlink
     };
 
+    void initHeader(FileHeader& header, EntryType type, const QString& fileName) const;
+    bool beginEntry();
+    void writeEntry(FileHeader& header, const QByteArray& data);
     void addEntry(EntryType type, const QString& fileName, const QByteArray& contents);
+    void addRawEntry(const QString& fileName, const QByteArray& rawData, bool deflated, uint crc, qint64 size);
+
+    QIODevice* openEntryDevice(const QString& fileName);
+    bool closeEntryDevice();
+};
+
+//---------------------------------------------------------
+//   MQZipEntryDevice
+//    write-only device feeding one archive entry; the data
+//    is deflated in chunks straight into the zip device, so
+//    the uncompressed entry is never held in memory
+//---------------------------------------------------------
+
+class MQZipEntryDevice : public QIODevice
+{
+public:
+    MQZipEntryDevice(QIODevice* zipDevice, bool compress, int level)
+        : m_zipDevice(zipDevice), m_compress(compress)
+    {
+        m_crc = ::crc32(0, 0, 0);
+        if (m_compress) {
+            memset(&m_stream, 0, sizeof(m_stream));
+            m_compress = deflateInit2(&m_stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+            m_outBuffer.resize(OUT_BUFFER_SIZE);
+        }
+        open(QIODevice::WriteOnly);
+    }
+
+    ~MQZipEntryDevice() override
+    {
+        if (m_compress && !m_finished) {
+            deflateEnd(&m_stream);
+        }
+    }
+
+    bool isSequential() const override { return true; }
+
+    bool compressed() const { return m_compress; }
+    uint crc() const { return m_crc; }
+    quint64 uncompressedSize() const { return m_uncompressedSize; }
+    quint64 compressedSize() const { return m_compressedSize; }
+    bool hasError() const { return m_error; }
+
+    bool finish()
+    {
+        if (m_finished) {
+            return !m_error;
+        }
+        m_finished = true;
+        if (m_compress) {
+            int res = Z_OK;
+            while (res == Z_OK && !m_error) {
+                res = deflateChunk(Z_FINISH);
+            }
+            if (res != Z_STREAM_END) {
+                m_error = true;
+            }
+            deflateEnd(&m_stream);
+        }
+        close();
+        return !m_error;
+    }
+
+protected:
+    qint64 readData(char*, qint64) override { return -1; }
+
+    qint64 writeData(const char* data, qint64 len) override
+    {
+        if (m_finished || m_error) {
+            return -1;
+        }
+
+        m_crc = ::crc32(m_crc, reinterpret_cast<const uchar*>(data), uInt(len));
+        m_uncompressedSize += len;
+
+        if (!m_compress) {
+            if (m_zipDevice->write(data, len) != len) {
+                m_error = true;
+                return -1;
+            }
+            m_compressedSize += len;
+            return len;
+        }
+
+        m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        m_stream.avail_in = uInt(len);
+        while (m_stream.avail_in > 0 && !m_error) {
+            if (deflateChunk(Z_NO_FLUSH) == Z_STREAM_ERROR) {
+                m_error = true;
+            }
+        }
+        return m_error ? -1 : len;
+    }
+
+private:
+    static constexpr int OUT_BUFFER_SIZE = 64 * 1024;
+
+    int deflateChunk(int flush)
+    {
+        m_stream.next_out = reinterpret_cast<Bytef*>(m_outBuffer.data());
+        m_stream.avail_out = uInt(m_outBuffer.size());
+        int res = deflate(&m_stream, flush);
+        const qint64 produced = m_outBuffer.size() - m_stream.avail_out;
+        if (produced > 0) {
+            if (m_zipDevice->write(m_outBuffer.constData(), produced) != produced) {
+                m_error = true;
+            }
+            m_compressedSize += produced;
+        }
+        return res;
+    }
+
+    QIODevice* m_zipDevice = nullptr;
+    bool m_compress = false;
+    bool m_finished = false;
+    bool m_error = false;
+    z_stream m_stream;
+    QByteArray m_outBuffer;
+    uint m_crc = 0;
+    quint64 m_uncompressedSize = 0;
+    quint64 m_compressedSize = 0;
+};
+
+//---------------------------------------------------------
+//   MQZipInflateDevice
+//    read-only device over one deflated archive entry; the
+//    data is inflated on demand, so a reader that stops early
+//    doesn't pay for inflating the whole entry
+//---------------------------------------------------------
+
+class MQZipInflateDevice : public QIODevice
+{
+public:
+    MQZipInflateDevice(const QByteArray& rawData)
+        : m_rawData(rawData)
+    {
+        memset(&m_stream, 0, sizeof(m_stream));
+        m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(m_rawData.constData()));
+        m_stream.avail_in = uInt(m_rawData.size());
+        m_finished = inflateInit2(&m_stream, -MAX_WBITS) != Z_OK;
+        m_initialized = !m_finished;
+        open(QIODevice::ReadOnly);
+    }
+
+    ~MQZipInflateDevice() override
+    {
+        if (m_initialized) {
+            inflateEnd(&m_stream);
+        }
+    }
+
+    bool isSequential() const override { return true; }
+
+    bool atEnd() const override
+    {
+        return m_finished && QIODevice::bytesAvailable() == 0;
+    }
+
+protected:
+    qint64 readData(char* data, qint64 maxlen) override
+    {
+        if (m_finished) {
+            return -1;
+        }
+
+        m_stream.next_out = reinterpret_cast<Bytef*>(data);
+        m_stream.avail_out = uInt(maxlen);
+        int res = inflate(&m_stream, Z_NO_FLUSH);
+        const qint64 produced = maxlen - m_stream.avail_out;
+
+        if (res != Z_OK) {
+            if (res != Z_STREAM_END) {
+                qWarning("QZip: Z_DATA_ERROR: Input data is corrupted");
+            }
+            m_finished = true;
+        }
+
+        if (produced == 0 && m_finished) {
+            return -1;
+        }
+        return produced;
+    }
+
+    qint64 writeData(const char*, qint64) override { return -1; }
+
+private:
+    QByteArray m_rawData;
+    z_stream m_stream;
+    bool m_initialized = false;
+    bool m_finished = false;
 };
 
+MQZipWriterPrivate::~MQZipWriterPrivate()
+{
+    delete openEntry;
+}
+
 LocalFileHeader CentralFileHeader::toLocalHeader() const
 {
     LocalFileHeader h;
@@ -675,72 +908,13 @@ void MQZipReaderPrivate::scanFiles()
     }
 }
 
-void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
-                                  const QByteArray& contents /*, QFile::Permissions permissions, QZip::Method m*/)
+void MQZipWriterPrivate::initHeader(FileHeader& header, EntryType type, const QString& fileName) const
 {
-#ifndef NDEBUG
-    static const char* const entryTypes[] = {
-        "directory",
-        "file     ",
-        "symlink  " };
-    ZDEBUG() << "adding" << entryTypes[type] << ":" << fileName.toUtf8().data()
-             << (type == 2 ? QByteArray(" -> " + contents).constData() : "");
-#endif
-
-    if (!(device->isOpen() || device->open(QIODevice::WriteOnly))) {
-        status = MQZipWriter::FileOpenError;
-        return;
-    }
-    device->seek(start_of_directory);
-
-    // don't compress small files
-    MQZipWriter::CompressionPolicy compression = compressionPolicy;
-    if (compressionPolicy == MQZipWriter::AutoCompress) {
-        if (contents.length() < 64) {
-            compression = MQZipWriter::NeverCompress;
-        } else {
-            compression = MQZipWriter::AlwaysCompress;
-        }
-    }
-
-    FileHeader header;
     memset(&header.h, 0, sizeof(CentralFileHeader));
     writeUInt(header.h.signature, 0x02014b50);
 
     writeUShort(header.h.version_needed, ZIP_VERSION);
-    writeUInt(header.h.uncompressed_size, contents.length());
     writeMSDosDate(header.h.last_mod_file, QDateTime::currentDateTime());
-    QByteArray data = contents;
-    if (compression == MQZipWriter::AlwaysCompress) {
-        writeUShort(header.h.compression_method, CompressionMethodDeflated);
-
-        ulong len = contents.length();
-        // shamelessly copied form zlib
-        len += (len >> 12) + (len >> 14) + 11;
-        int res;
-        do {
-            data.resize(len);
-            res = deflate((uchar*)data.data(), &len, (const uchar*)contents.constData(), contents.length());
-
-            switch (res) {
-            case Z_OK:
-                data.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                qWarning("QZip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
-                data.resize(0);
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
-    }
-// TODO add a check if data.length() > contents.length().  Then try to store the original and revert the compression method to be uncompressed
-    writeUInt(header.h.compressed_size, data.length());
-    uint crc_32 = ::crc32(0, 0, 0);
-    crc_32 = ::crc32(crc_32, (const uchar*)contents.constData(), contents.length());
-    writeUInt(header.h.crc_32, crc_32);
 
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
     ushort general_purpose_bits = Utf8Names; // always use utf-8
@@ -779,7 +953,69 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     }
     writeUInt(header.h.external_file_attributes, mode << 16);
     writeUInt(header.h.offset_local_header, start_of_directory);
+}
 
+void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
+                                  const QByteArray& contents /*, QFile::Permissions permissions, QZip::Method m*/)
+{
+#ifndef NDEBUG
+    static const char* const entryTypes[] = {
+        "directory",
+        "file     ",
+        "symlink  " };
+    ZDEBUG() << "adding" << entryTypes[type] << ":" << fileName.toUtf8().data()
+             << (type == 2 ? QByteArray(" -> " + contents).constData() : "");
+#endif
+
+    if (!beginEntry()) {
+        return;
+    }
+
+    // don't compress small files
+    MQZipWriter::CompressionPolicy compression = compressionPolicy;
+    if (compressionPolicy == MQZipWriter::AutoCompress) {
+        if (contents.length() < 64) {
+            compression = MQZipWriter::NeverCompress;
+        } else {
+            compression = MQZipWriter::AlwaysCompress;
+        }
+    }
+
+    FileHeader header;
+    initHeader(header, type, fileName);
+
+    writeUInt(header.h.uncompressed_size, contents.length());
+    QByteArray data = contents;
+    if (compression == MQZipWriter::AlwaysCompress) {
+        writeUShort(header.h.compression_method, CompressionMethodDeflated);
+        data = deflateContents(contents, compressionLevel);
+    }
+// TODO add a check if data.length() > contents.length().  Then try to store the original and revert the compression method to be uncompressed
+    writeUInt(header.h.compressed_size, data.length());
+    uint crc_32 = ::crc32(0, 0, 0);
+    crc_32 = ::crc32(crc_32, (const uchar*)contents.constData(), contents.length());
+    writeUInt(header.h.crc_32, crc_32);
+
+    writeEntry(header, data);
+}
+
+bool MQZipWriterPrivate::beginEntry()
+{
+    if (openEntry) {
+        qWarning("QZip: an entry is still open for writing, closing it");
+        closeEntryDevice();
+    }
+
+    if (!(device->isOpen() || device->open(QIODevice::WriteOnly))) {
+        status = MQZipWriter::FileOpenError;
+        return false;
+    }
+    device->seek(start_of_directory);
+    return true;
+}
+
+void MQZipWriterPrivate::writeEntry(FileHeader& header, const QByteArray& data)
+{
     fileHeaders.append(header);
 
     LocalFileHeader h = header.h.toLocalHeader();
@@ -790,6 +1026,77 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     dirtyFileTree = true;
 }
 
+void MQZipWriterPrivate::addRawEntry(const QString& fileName, const QByteArray& rawData, bool deflated, uint crc, qint64 size)
+{
+    ZDEBUG() << "adding raw entry:" << fileName.toUtf8().data();
+
+    if (!beginEntry()) {
+        return;
+    }
+
+    FileHeader header;
+    initHeader(header, File, fileName);
+
+    writeUShort(header.h.compression_method, deflated ? CompressionMethodDeflated : CompressionMethodStored);
+    writeUInt(header.h.uncompressed_size, size);
+    writeUInt(header.h.compressed_size, rawData.length());
+    writeUInt(header.h.crc_32, crc);
+
+    writeEntry(header, rawData);
+}
+
+QIODevice* MQZipWriterPrivate::openEntryDevice(const QString& fileName)
+{
+    if (!beginEntry()) {
+        return nullptr;
+    }
+
+    // the size is not known up front, so AutoCompress always compresses
+    const bool compress = compressionPolicy != MQZipWriter::NeverCompress;
+
+    FileHeader header;
+    initHeader(header, File, fileName);
+    writeUShort(header.h.compression_method, compress ? CompressionMethodDeflated : CompressionMethodStored);
+    fileHeaders.append(header);
+
+    // sizes and crc are patched in closeEntryDevice()
+    LocalFileHeader h = header.h.toLocalHeader();
+    device->write((const char*)&h, sizeof(LocalFileHeader));
+    device->write(header.file_name);
+
+    openEntry = new MQZipEntryDevice(device, compress, compressionLevel);
+    return openEntry;
+}
+
+bool MQZipWriterPrivate::closeEntryDevice()
+{
+    if (!openEntry) {
+        return false;
+    }
+
+    bool ok = openEntry->finish();
+    FileHeader& header = fileHeaders.last();
+    writeUShort(header.h.compression_method, openEntry->compressed() ? CompressionMethodDeflated : CompressionMethodStored);
+    writeUInt(header.h.crc_32, openEntry->crc());
+    writeUInt(header.h.compressed_size, uint(openEntry->compressedSize()));
+    writeUInt(header.h.uncompressed_size, uint(openEntry->uncompressedSize()));
+    delete openEntry;
+    openEntry = nullptr;
+
+    const qint64 end = device->pos();
+    LocalFileHeader h = header.h.toLocalHeader();
+    ok = ok && device->seek(readUInt(header.h.offset_local_header));
+    ok = ok && device->write((const char*)&h, sizeof(LocalFileHeader)) == qint64(sizeof(LocalFileHeader));
+    ok = ok && device->seek(end);
+    if (!ok) {
+        status = MQZipWriter::FileWriteError;
+    }
+
+    start_of_directory = end;
+    dirtyFileTree = true;
+    return ok;
+}
+
 //////////////////////////////  Reader
 
 /*!
@@ -1051,6 +1358,84 @@ QByteArray MQZipReader::fileData(const QString& fileName) const
     return QByteArray();
 }
 
+/*!
+    Returns the contents of the file \a fileName as stored in the archive,
+    without decompressing it. \a deflated is set to whether the data is
+    deflated or stored. The crc and the uncompressed size of the file are
+    available from its FileInfo.
+    Returns a null byte array if the file isn't found or can't be copied.
+
+    \sa MQZipWriter::addRawFile()
+*/
+QByteArray MQZipReader::rawFileData(const QString& fileName, bool* deflated) const
+{
+    d->scanFiles();
+    int i;
+    for (i = 0; i < d->fileHeaders.size(); ++i) {
+        if (QString::fromUtf8(d->fileHeaders.at(i).file_name) == fileName) {
+            break;
+        }
+    }
+    if (i == d->fileHeaders.size()) {
+        return QByteArray();
+    }
+
+    const FileHeader& header = d->fileHeaders.at(i);
+    if ((readUShort(header.h.general_purpose_bits) & Encrypted) != 0) {
+        return QByteArray();
+    }
+
+    int compressed_size = readUInt(header.h.compressed_size);
+    int start = readUInt(header.h.offset_local_header);
+
+    d->device->seek(start);
+    LocalFileHeader lh;
+    d->device->read((char*)&lh, sizeof(LocalFileHeader));
+    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+    d->device->seek(d->device->pos() + skip);
+
+    int compression_method = readUShort(lh.compression_method);
+    if (compression_method != CompressionMethodStored && compression_method != CompressionMethodDeflated) {
+        return QByteArray();
+    }
+
+    QByteArray raw = d->device->read(compressed_size);
+    if (raw.size() != compressed_size) {
+        return QByteArray();
+    }
+
+    if (deflated) {
+        *deflated = compression_method == CompressionMethodDeflated;
+    }
+    return raw;
+}
+
+/*!
+    Returns a read-only device over the contents of the file \a fileName.
+    Deflated data is inflated as it is read, so reading only the start of
+    a large file is cheap. The caller takes ownership of the device.
+    Returns \c nullptr if the file isn't found or can't be read.
+
+    \sa fileData()
+*/
+QIODevice* MQZipReader::openFile(const QString& fileName) const
+{
+    bool deflated = false;
+    QByteArray raw = rawFileData(fileName, &deflated);
+    if (raw.isNull()) {
+        return nullptr;
+    }
+
+    if (deflated) {
+        return new MQZipInflateDevice(raw);
+    }
+
+    QBuffer* buffer = new QBuffer();
+    buffer->setData(raw);
+    buffer->open(QIODevice::ReadOnly);
+    return buffer;
+}
+
 /*!
     Extracts the full contents of the zip file into \a destinationDir on
     the local filesystem.
@@ -1280,6 +1665,41 @@ MQZipWriter::CompressionPolicy MQZipWriter::compressionPolicy() const
     return d->compressionPolicy;
 }
 
+/*!
+    Sets the zlib compression \a level used for newly added files,
+    from 1 (fastest) to 9 (smallest), or -1 for the zlib default.
+
+    \sa compressionLevel()
+*/
+void MQZipWriter::setCompressionLevel(int level)
+{
+    d->compressionLevel = level;
+}
+
+/*!
+    Returns the zlib compression level used for newly added files.
+    \sa setCompressionLevel()
+*/
+int MQZipWriter::compressionLevel() const
+{
+    return d->compressionLevel;
+}
+
+/*!
+    Returns \a data deflated at the compression \a level, in the form
+    addRawFile() expects. The function is reentrant, so entries can be
+    compressed on worker threads and added to the archive afterwards.
+
+    \sa addRawFile()
+*/
+QByteArray MQZipWriter::deflateData(const QByteArray& data, int level, DeflateStrategy strategy)
+{
+    static_assert(DefaultStrategy == Z_DEFAULT_STRATEGY && FilteredStrategy == Z_FILTERED
+                  && HuffmanOnlyStrategy == Z_HUFFMAN_ONLY && RleStrategy == Z_RLE, "must match the zlib strategies");
+
+    return deflateContents(data, level, strategy);
+}
+
 /*!
     Sets the permissions that will be used for newly added files.
 
@@ -1321,6 +1741,29 @@ void MQZipWriter::addFile(const QString& fileName, const QByteArray& data)
     d->addEntry(MQZipWriterPrivate::File, QDir::fromNativeSeparators(fileName), data);
 }
 
+/*!
+    Add a file to the archive from its already compressed bytes \a rawData,
+    as returned by MQZipReader::rawFileData(). \a deflated, \a crc and \a size
+    describe the data and are written to the headers as is, the data is
+    neither compressed nor checked. This allows copying unchanged entries
+    from another archive without inflating and deflating them again.
+
+    \sa MQZipReader::rawFileData()
+*/
+void MQZipWriter::addRawFile(const QString& fileName, const QByteArray& rawData, bool deflated, uint crc, qint64 size)
+{
+    d->addRawEntry(QDir::fromNativeSeparators(fileName), rawData, deflated, crc, size);
+}
+
+/*!
+    Returns the zip (CRC-32) checksum of \a data, as stored in the archive headers.
+*/
+uint MQZipWriter::crc32(const QByteArray& data)
+{
+    uint crc = ::crc32(0, 0, 0);
+    return ::crc32(crc, (const uchar*)data.constData(), data.length());
+}
+
 /*!
     Add a file to the archive with \a device as the source of the contents.
     The contents returned from QIODevice::readAll() will be used as the
@@ -1346,6 +1789,30 @@ void MQZipWriter::addFile(const QString& fileName, QIODevice* device)
     }
 }
 
+/*!
+    Start a new file entry in the archive named \a fileName and return a
+    write-only device for its contents. The data written to the device is
+    compressed and written to the archive as it arrives, so large entries
+    never need to be held in memory. The device is owned by the writer and
+    stays valid until closeFile() is called; the archive device must be
+    seekable, since the entry sizes are patched into the local header then.
+
+    \sa closeFile()
+*/
+QIODevice* MQZipWriter::openFile(const QString& fileName)
+{
+    return d->openEntryDevice(QDir::fromNativeSeparators(fileName));
+}
+
+/*!
+    Finish the entry started with openFile(). Returns \c false if no entry
+    was open or the entry could not be written completely.
+*/
+bool MQZipWriter::closeFile()
+{
+    return d->closeEntryDevice();
+}
+
 /*!
     Create a new directory in the archive with the specified \a dirName and
     the \a permissions;
@@ -1375,6 +1842,10 @@ void MQZipWriter::addSymLink(const QString& fileName, const QString& destination
 */
 void MQZipWriter::close()
 {
+    if (d->openEntry) {
+        d->closeEntryDevice();
+    }
+
     if (!(d->device->openMode() & QIODevice::WriteOnly)) {
         d->device->close();
         return;
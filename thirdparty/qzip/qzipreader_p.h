@@ -99,6 +99,8 @@ public:
 
     FileInfo entryInfoAt(int index) const;
     QByteArray fileData(const QString &fileName) const;
+    QByteArray rawFileData(const QString &fileName, bool *deflated = nullptr) const;
+    QIODevice* openFile(const QString &fileName) const;
     bool extractAll(const QString &destinationDir) const;
 
     enum Status {
@@ -94,12 +94,29 @@ public:
     void setCompressionPolicy(CompressionPolicy policy);
     CompressionPolicy compressionPolicy() const;
 
+    void setCompressionLevel(int level);
+    int compressionLevel() const;
+
+    // the zlib deflate strategies
+    enum DeflateStrategy {
+        DefaultStrategy,
+        FilteredStrategy,
+        HuffmanOnlyStrategy,
+        RleStrategy
+    };
+
     void setCreationPermissions(QFile::Permissions permissions);
     QFile::Permissions creationPermissions() const;
 
     void addFile(const QString &fileName, const QByteArray &data);
 
     void addFile(const QString &fileName, QIODevice *device);
+    void addRawFile(const QString &fileName, const QByteArray &rawData, bool deflated, uint crc, qint64 size);
+    static uint crc32(const QByteArray &data);
+    static QByteArray deflateData(const QByteArray &data, int level, DeflateStrategy strategy = DefaultStrategy);
+
+    QIODevice* openFile(const QString &fileName);
+    bool closeFile();
 
     void addDirectory(const QString &dirName);
 